@@ -503,3 +503,66 @@ int MPI_Scatterv(void *sendbuf, int *sendcounts, int *displs,
   memcpy(recvbuf,sendbuf,n);
   return 0;
 }
+
+/* ---------------------------------------------------------------------- */
+
+/* MPI-IO is mapped to stdio, only MPI_BYTE/MPI_CHAR data is supported */
+
+int MPI_File_open(MPI_Comm comm, const char *filename, int amode,
+                  MPI_Info info, MPI_File *fh)
+{
+  if (amode & MPI_MODE_RDONLY) *fh = fopen(filename,"rb");
+  else {
+    *fh = fopen(filename,"r+b");
+    if (*fh == NULL && (amode & MPI_MODE_CREATE)) *fh = fopen(filename,"w+b");
+  }
+  if (*fh == NULL) return 1;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int MPI_File_close(MPI_File *fh)
+{
+  if (*fh) fclose(*fh);
+  *fh = NULL;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+/* only truncation to zero length is supported */
+
+int MPI_File_set_size(MPI_File fh, MPI_Offset size)
+{
+  if (size != 0 || freopen(NULL,"w+b",fh) == NULL) return 1;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int MPI_File_get_size(MPI_File fh, MPI_Offset *size)
+{
+  if (fseeko(fh,0,SEEK_END)) return 1;
+  *size = ftello(fh);
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int MPI_File_write_at(MPI_File fh, MPI_Offset offset, void *buf,
+                      int count, MPI_Datatype datatype, MPI_Status *status)
+{
+  if (datatype != MPI_BYTE && datatype != MPI_CHAR) return 1;
+  if (fseeko(fh,offset,SEEK_SET)) return 1;
+  if (count && fwrite(buf,1,count,fh) != (size_t) count) return 1;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, void *buf,
+                          int count, MPI_Datatype datatype, MPI_Status *status)
+{
+  return MPI_File_write_at(fh,offset,buf,count,datatype,status);
+}
@@ -47,6 +47,7 @@
 #define MPI_STUBS
 
 #include <stdlib.h>
+#include <stdio.h>
 
 /* use C bindings for MPI interface */
 
@@ -90,6 +91,16 @@ extern "C" {
 
 #define MPI_MAX_PROCESSOR_NAME 128
 
+#define MPI_MODE_CREATE 1
+#define MPI_MODE_RDONLY 2
+#define MPI_MODE_WRONLY 4
+#define MPI_INFO_NULL 0
+#define MPI_STATUS_IGNORE NULL
+
+#define MPI_Info int
+#define MPI_Offset long long
+#define MPI_File FILE *
+
 /* MPI data structs */
 
 struct _MPI_Status {
@@ -171,6 +182,18 @@ int MPI_Scatterv(void *sendbuf, int *sendcounts, int *displs,
                  MPI_Datatype sendtype, void *recvbuf, int recvcount,
                  MPI_Datatype recvtype, int root, MPI_Comm comm);
 
+/* MPI-IO, only byte-wise access is supported */
+
+int MPI_File_open(MPI_Comm comm, const char *filename, int amode,
+                  MPI_Info info, MPI_File *fh);
+int MPI_File_close(MPI_File *fh);
+int MPI_File_set_size(MPI_File fh, MPI_Offset size);
+int MPI_File_get_size(MPI_File fh, MPI_Offset *size);
+int MPI_File_write_at(MPI_File fh, MPI_Offset offset, void *buf,
+                      int count, MPI_Datatype datatype, MPI_Status *status);
+int MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, void *buf,
+                          int count, MPI_Datatype datatype, MPI_Status *status);
+
 #ifdef __cplusplus
 }
 #endif
@@ -112,7 +112,7 @@ class AssociativePointerArray
         inline int pushElemListToBuffer(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> * properties, double *dlo, double *dhi,bool scale,bool translate, bool rotate);
         inline int popElemListFromBuffer(int first, int n, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate);
         inline int pushElemListToBufferReverse(int first, int n, double *buf, int operation, std::list<std::string> *properties,bool scale,bool translate, bool rotate);
-        inline int popElemListFromBufferReverse(int n, int *list, double *buf, int operation, std::list<std::string> *properties, bool scale,bool translate, bool rotate);
+        inline int popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> *properties, double *dlo, double *dhi, bool scale,bool translate, bool rotate);
 
         inline int elemBufSize(int operation, std::list<std::string> * properties, bool scale,bool translate,bool rotate);
         inline int pushElemToBuffer(int n, double *buf, int operation,bool scale,bool translate, bool rotate);
@@ -514,13 +514,13 @@
   }
 
   template<typename T>
-  int AssociativePointerArray<T>::popElemListFromBufferReverse(int n, int *list, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate)
+  int AssociativePointerArray<T>::popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> * properties, double *dlo, double *dhi, bool scale,bool translate, bool rotate)
   {
       int nrecv = 0;
       for(int i=0;i<numElem_;i++)
       {
           if (!properties || getBasePointerByIndex(i)->matches_any_id(properties))
-              nrecv += getBasePointerByIndex(i)->popElemListFromBufferReverse(n,list,&buf[nrecv],operation,scale,translate,rotate);
+              nrecv += getBasePointerByIndex(i)->popElemListFromBufferReverse(n,list,wraplist,&buf[nrecv],operation,dlo,dhi,scale,translate,rotate);
       }
       return nrecv;
   }
@@ -196,6 +196,9 @@ void AtomVecSphere::copy(int i, int j, int delflag)
 int AtomVecSphere::pack_comm(int n, int *list, double *buf,
                                int pbc_flag, int *pbc)
 {
+  if(dynamic_cast<DomainWedge*>(domain))
+    return pack_comm_wedge(n,list,buf,pbc_flag,pbc);
+
   int i,j,m;
   double dx,dy,dz;
 
@@ -603,6 +606,9 @@ int AtomVecSphere::unpack_reverse_hybrid(int n, int *list, double *buf)
 int AtomVecSphere::pack_border(int n, int *list, double *buf,
                                  int pbc_flag, int *pbc)
 {
+  if(dynamic_cast<DomainWedge*>(domain))
+    return pack_border_wedge(n,list,buf,pbc_flag,pbc);
+
   int i,j,m;
   double dx,dy,dz;
 
@@ -73,6 +73,7 @@ class AtomVecSphere : public AtomVec {
   void grow_reset();
   void copy(int, int, int);
   int pack_comm(int, int *, double *, int, int *);
+  int pack_comm_wedge(int, int *, double *, int, int *);
   int pack_comm_vel(int, int *, double *, int, int *);
   int pack_comm_vel_wedge(int, int *, double *, int, int *); 
   int pack_comm_hybrid(int, int *, double *);
@@ -84,6 +85,7 @@ class AtomVecSphere : public AtomVec {
   void unpack_reverse(int, int *, double *);
   int unpack_reverse_hybrid(int, int *, double *);
   int pack_border(int, int *, double *, int, int *);
+  int pack_border_wedge(int, int *, double *, int, int *);
   int pack_border_vel(int, int *, double *, int, int *);
   int pack_border_vel_wedge(int, int *, double *, int, int *); 
   int pack_border_hybrid(int, int *, double *);
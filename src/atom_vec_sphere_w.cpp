@@ -40,19 +40,77 @@
 ------------------------------------------------------------------------- */
 
 #include "atom_vec_sphere.h"
-#include "domain_wedge.h"
 
-#ifndef DOMAIN_WEDGE_REAL_H
-#define DOMAIN_WEDGE_REAL_H
+#include "atom_vec_sphere.h"
+#include "atom.h"
+#include "modify.h"
+#include "fix.h"
+#include "domain_wedge.h"
 
 using namespace LAMMPS_NS;
 
+/* ----------------------------------------------------------------------
+   communication for domain wedge
+   pbc[iphi] = +1/-1 rotates the image by +/- the wedge angle around the
+   wedge axis, pbc[iaxis] translates it along the periodic axis
+   positions are rotated as points, v and omega as vectors
+------------------------------------------------------------------------- */
+
+namespace {
+
+inline void wedge_image(const DomainWedge *dw, int rot, double daxis,
+                        const double *x, double *xi)
+{
+  xi[0] = x[0];
+  xi[1] = x[1];
+  xi[2] = x[2];
+  if (rot) dw->rotate_point(xi,rot);
+  xi[dw->index_axis()] += daxis;
+}
+
+inline void wedge_vector(const DomainWedge *dw, int rot,
+                         const double *v, double *vi)
+{
+  vi[0] = v[0];
+  vi[1] = v[1];
+  vi[2] = v[2];
+  if (rot) dw->rotate_vector(vi,rot);
+}
+
+}
+
 /* ---------------------------------------------------------------------- */
 
-int AtomVecSphere::pack_border_vel_wedge(int n, int *list, double *buf,
-                                     int pbc_flag, int *pbc)
+int AtomVecSphere::pack_comm_wedge(int n, int *list, double *buf,
+                                   int pbc_flag, int *pbc)
 {
-    return 0;
+  const DomainWedge *dw = static_cast<DomainWedge*>(domain);
+  int i,j,m;
+  int rot = 0;
+  double daxis = 0.;
+  double xi[3];
+
+  if (pbc_flag) {
+    rot = pbc[dw->index_phi()];
+    daxis = pbc[dw->index_axis()]*domain->prd[dw->index_axis()];
+  }
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    wedge_image(dw,rot,daxis,x[j],xi);
+    buf[m++] = xi[0];
+    buf[m++] = xi[1];
+    buf[m++] = xi[2];
+    if (radvary) {
+      buf[m++] = ubuf(type[j]).d;
+      buf[m++] = radius[j];
+      buf[m++] = rmass[j];
+      buf[m++] = density[j];
+    }
+  }
+
+  return m;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -60,7 +118,123 @@ int AtomVecSphere::pack_border_vel_wedge(int n, int *list, double *buf,
 int AtomVecSphere::pack_comm_vel_wedge(int n, int *list, double *buf,
                                    int pbc_flag, int *pbc)
 {
-    return 0;
+  const DomainWedge *dw = static_cast<DomainWedge*>(domain);
+  int i,j,m;
+  int rot = 0;
+  double daxis = 0.;
+  double xi[3],vi[3],omegai[3];
+
+  if (pbc_flag) {
+    rot = pbc[dw->index_phi()];
+    daxis = pbc[dw->index_axis()]*domain->prd[dw->index_axis()];
+  }
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    wedge_image(dw,rot,daxis,x[j],xi);
+    wedge_vector(dw,rot,v[j],vi);
+    wedge_vector(dw,rot,omega[j],omegai);
+    buf[m++] = xi[0];
+    buf[m++] = xi[1];
+    buf[m++] = xi[2];
+    if (radvary) {
+      buf[m++] = ubuf(type[j]).d;
+      buf[m++] = radius[j];
+      buf[m++] = rmass[j];
+      buf[m++] = density[j];
+    }
+    buf[m++] = vi[0];
+    buf[m++] = vi[1];
+    buf[m++] = vi[2];
+    buf[m++] = omegai[0];
+    buf[m++] = omegai[1];
+    buf[m++] = omegai[2];
+  }
+
+  return m;
 }
 
-#endif
+/* ---------------------------------------------------------------------- */
+
+int AtomVecSphere::pack_border_wedge(int n, int *list, double *buf,
+                                     int pbc_flag, int *pbc)
+{
+  const DomainWedge *dw = static_cast<DomainWedge*>(domain);
+  int i,j,m;
+  int rot = 0;
+  double daxis = 0.;
+  double xi[3];
+
+  if (pbc_flag) {
+    rot = pbc[dw->index_phi()];
+    daxis = pbc[dw->index_axis()]*domain->prd[dw->index_axis()];
+  }
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    wedge_image(dw,rot,daxis,x[j],xi);
+    buf[m++] = xi[0];
+    buf[m++] = xi[1];
+    buf[m++] = xi[2];
+    buf[m++] = ubuf(tag[j]).d;
+    buf[m++] = ubuf(type[j]).d;
+    buf[m++] = ubuf(mask[j]).d;
+    buf[m++] = radius[j];
+    buf[m++] = rmass[j];
+    buf[m++] = density[j];
+  }
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->pack_border(n,list,&buf[m]);
+
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int AtomVecSphere::pack_border_vel_wedge(int n, int *list, double *buf,
+                                     int pbc_flag, int *pbc)
+{
+  const DomainWedge *dw = static_cast<DomainWedge*>(domain);
+  int i,j,m;
+  int rot = 0;
+  double daxis = 0.;
+  double xi[3],vi[3],omegai[3];
+
+  if (pbc_flag) {
+    rot = pbc[dw->index_phi()];
+    daxis = pbc[dw->index_axis()]*domain->prd[dw->index_axis()];
+  }
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    wedge_image(dw,rot,daxis,x[j],xi);
+    wedge_vector(dw,rot,v[j],vi);
+    wedge_vector(dw,rot,omega[j],omegai);
+    buf[m++] = xi[0];
+    buf[m++] = xi[1];
+    buf[m++] = xi[2];
+    buf[m++] = ubuf(tag[j]).d;
+    buf[m++] = ubuf(type[j]).d;
+    buf[m++] = ubuf(mask[j]).d;
+    buf[m++] = radius[j];
+    buf[m++] = rmass[j];
+    buf[m++] = density[j];
+    buf[m++] = vi[0];
+    buf[m++] = vi[1];
+    buf[m++] = vi[2];
+    buf[m++] = omegai[0];
+    buf[m++] = omegai[1];
+    buf[m++] = omegai[2];
+  }
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->pack_border(n,list,&buf[m]);
+
+  return m;
+}
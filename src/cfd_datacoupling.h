@@ -50,7 +50,7 @@ class CfdDatacoupling : protected Pointers {
  public:
 
   CfdDatacoupling(class LAMMPS *lmp, int jarg, int narg, char **arg, class FixCfdCoupling* fc);
-  ~CfdDatacoupling();
+  virtual ~CfdDatacoupling();
 
   int get_iarg() {return iarg_;}
 
@@ -65,7 +65,7 @@ class CfdDatacoupling : protected Pointers {
   virtual void allocate_external(int    **&data, int len2,const char *keyword,int initvalue);
   virtual void allocate_external(double **&data, int len2,const char *keyword,double initvalue);
 
-  void init();
+  virtual void init();
   virtual void post_create() {}
 
   virtual bool error_push()
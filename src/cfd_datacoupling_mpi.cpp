@@ -74,12 +74,88 @@ CfdDatacouplingMPI::CfdDatacouplingMPI(LAMMPS *lmp,int iarg, int narg, char **ar
   len_allred_int = 0;
   allred_int = NULL;
 
+  batch_ = false;
+  nslots_batch_ = 0;
+  push_batched_ = NULL;
+  push_len_ = NULL;
+  push_offset_ = NULL;
+  push_dirty_ = NULL;
+  push_hash_ = NULL;
+  push_batch_valid_ = false;
+  len_push_result_ = 0;
+  push_result_ = NULL;
+  len_batch_ = 0;
+  batch_send_ = NULL;
+  batch_recv_ = NULL;
+  npull_pending_ = 0;
+  pull_pending_slot_ = NULL;
+  pull_pending_len_ = NULL;
+  len_pull_stage_ = 0;
+  pull_stage_ = NULL;
+  nbatch_push_ = nbatch_pull_ = 0;
+  nvalues_skipped_ = 0;
+
+  if(iarg_ < narg && strcmp(arg[iarg_],"batch") == 0)
+  {
+      if(narg < iarg_+2)
+          error->all(FLERR,"Fix couple/cfd: not enough arguments for keyword 'batch'");
+      if(strcmp(arg[iarg_+1],"yes") == 0)
+          batch_ = true;
+      else if(strcmp(arg[iarg_+1],"no") == 0)
+          batch_ = false;
+      else
+          error->all(FLERR,"Fix couple/cfd: expecting 'yes' or 'no' after keyword 'batch'");
+      iarg_ += 2;
+  }
 }
 
 CfdDatacouplingMPI::~CfdDatacouplingMPI()
 {
     memory->sfree(allred_double);
     memory->sfree(allred_int);
+
+    memory->destroy(push_batched_);
+    memory->destroy(push_len_);
+    memory->destroy(push_offset_);
+    memory->destroy(push_dirty_);
+    memory->sfree(push_hash_);
+    memory->sfree(push_result_);
+    memory->sfree(batch_send_);
+    memory->sfree(batch_recv_);
+    memory->destroy(pull_pending_slot_);
+    memory->destroy(pull_pending_len_);
+    memory->sfree(pull_stage_);
+}
+
+/* ----------------------------------------------------------------------
+   called at the beginning of each run, i.e. after the calling program
+   has pushed and pulled all data of this coupling step
+------------------------------------------------------------------------- */
+
+void CfdDatacouplingMPI::init()
+{
+    // queued pull transfers have to be applied before the run starts
+    // data pushed in batch mode is out of date as soon as the run starts
+
+    if(batch_)
+    {
+        flush_pull_batch();
+        push_batch_valid_ = false;
+
+        if(comm->me == 0 && (nbatch_push_ > 0 || nbatch_pull_ > 0))
+        {
+            if(screen)
+                fprintf(screen,"CFD coupling (batch mode): %d push and %d pull transfers so far, "
+                               BIGINT_FORMAT " unchanged values not re-sent\n",
+                               nbatch_push_,nbatch_pull_,nvalues_skipped_);
+            if(logfile)
+                fprintf(logfile,"CFD coupling (batch mode): %d push and %d pull transfers so far, "
+                               BIGINT_FORMAT " unchanged values not re-sent\n",
+                               nbatch_push_,nbatch_pull_,nvalues_skipped_);
+        }
+    }
+
+    CfdDatacoupling::init();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -96,7 +172,39 @@ void CfdDatacouplingMPI::pull(const char *name,const char *type,void *&from,cons
     CfdDatacoupling::pull(name,type,from,datatype);
 
     if(strcmp(datatype,"double") == 0)
+    {
+        if(batch_)
+        {
+            // queue transfer, is communicated together with all
+            // other queued properties in flush_pull_batch()
+            // data is copied right away since the caller may re-use
+            // or free its buffer before the next run
+            int islot = find_slot(pullnames_,pulltypes_,npull_,name,type);
+            int len1 = -1, len2 = -1;
+            find_pull_target(name,type,len1,len2);
+            if(len1*len2 < 1) return;
+
+            grow_batch_slots();
+            if(npull_pending_ == nslots_batch_)
+                flush_pull_batch();
+
+            int offset = 0;
+            for(int i = 0; i < npull_pending_; i++)
+                offset += pull_pending_len_[i];
+            if(offset + len1*len2 > len_pull_stage_)
+            {
+                len_pull_stage_ = offset + len1*len2;
+                pull_stage_ = (double*) memory->srealloc(pull_stage_,len_pull_stage_*sizeof(double),"CfdDatacouplingMPI:pull_stage_");
+            }
+            memcpy(&(pull_stage_[offset]),&(((double**)from)[0][0]),len1*len2*sizeof(double));
+
+            pull_pending_slot_[npull_pending_] = islot;
+            pull_pending_len_[npull_pending_] = len1*len2;
+            npull_pending_++;
+            return;
+        }
         pull_mpi<double>(name,type,from);
+    }
     else if(strcmp(datatype,"int") == 0)
         pull_mpi<int>(name,type,from);
     else error->one(FLERR,"Illegal call to CfdDatacouplingMPI::pull, valid datatypes are 'int' and double'");
@@ -109,12 +217,281 @@ void CfdDatacouplingMPI::push(const char *name,const char *type,void *&to,const
     CfdDatacoupling::push(name,type,to,datatype);
 
     if(strcmp(datatype,"double") == 0)
+    {
+        if(batch_)
+        {
+            int islot = find_slot(pushnames_,pushtypes_,npush_,name,type);
+            if(islot >= 0)
+            {
+                grow_batch_slots();
+
+                // property was seen before, so it is part of the batch
+                if(push_batched_[islot])
+                {
+                    if(!push_batch_valid_)
+                        push_batch();
+                    if(push_len_[islot] > 0)
+                        memcpy(&(((double**)to)[0][0]),&(push_result_[push_offset_[islot]]),push_len_[islot]*sizeof(double));
+                    return;
+                }
+
+                // first transfer of this property is done individually,
+                // afterwards it is included in the batch
+                push_batched_[islot] = 1;
+            }
+        }
         push_mpi<double>(name,type,to);
+    }
     else if(strcmp(datatype,"int") == 0)
         push_mpi<int>(name,type,to);
     else error->one(FLERR,"Illegal call to CfdDatacouplingMPI::pull, valid datatypes are 'int' and double'");
 }
 
+/* ----------------------------------------------------------------------
+   find property to write pulled data to, error if not found
+------------------------------------------------------------------------- */
+
+void* CfdDatacouplingMPI::find_pull_target(const char *name,const char *type,int &len1,int &len2)
+{
+    void * to = find_pull_property(name,type,len1,len2);
+
+    if (atom->nlocal && (!to || len1 < 0 || len2 < 0))
+    {
+        if(screen) fprintf(screen,"LIGGGHTS could not find property %s to write data from calling program to.\n",name);
+
+        if(!to && len2 > 0)
+            if(screen) fprintf(screen,"Detailed info: reason is that len2 = %d, but pointer is empty. \n"
+                                      "The reason could be that property is not allocated within LIGGGHTS. \n"
+                                      "This hints to a NON allocated atom property (i.e., a deep error in your simulation setup). \n"
+                                      "Ensure that your atom properties do not collide with property/atom \n"
+                                      "(i.e., use a different property/atom name, or change your atom_style)!\n", len2);
+        lmp->error->one(FLERR,"This is fatal");
+    }
+
+    return to;
+}
+
+/* ----------------------------------------------------------------------
+   find property to read pushed data from, error if not found
+------------------------------------------------------------------------- */
+
+void* CfdDatacouplingMPI::find_push_source(const char *name,const char *type,int &len1,int &len2)
+{
+    void * from = find_push_property(name,type,len1,len2);
+
+    if (atom->nlocal && (!from || len1 < 0 || len2 < 0))
+    {
+        
+        if(screen) fprintf(screen,"LIGGGHTS could not find property %s to write data from calling program to.\n",name);
+        if(!from && len2 > 0)
+            if(screen) fprintf(screen,"Detailed info: reason is that len2 = %d, but pointer is empty. \n"
+                                      "The reason could be that property is not allocated within LIGGGHTS. \n"
+                                      "This hints to a NON allocated atom property (i.e., a deep error in your simulation setup). \n"
+                                      "Ensure that your atom properties do not collide with property/atom \n"
+                                      "(i.e., use a different property/atom name, or change your atom_style)!\n", len2);
+        lmp->error->one(FLERR,"This is fatal");
+    }
+
+    return from;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int CfdDatacouplingMPI::find_slot(char **names,char **types,int n,const char *name,const char *type)
+{
+    for(int i = 0; i < n; i++)
+        if(strcmp(name,names[i]) == 0 && strcmp(type,types[i]) == 0)
+            return i;
+    return -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CfdDatacouplingMPI::grow_batch_slots()
+{
+    if(nslots_batch_ >= nvalues_max_)
+        return;
+
+    memory->grow(push_batched_,nvalues_max_,"CfdDatacouplingMPI:push_batched_");
+    memory->grow(push_len_,nvalues_max_,"CfdDatacouplingMPI:push_len_");
+    memory->grow(push_offset_,nvalues_max_,"CfdDatacouplingMPI:push_offset_");
+    memory->grow(push_dirty_,nvalues_max_,"CfdDatacouplingMPI:push_dirty_");
+    push_hash_ = (uint64_t*) memory->srealloc(push_hash_,nvalues_max_*sizeof(uint64_t),"CfdDatacouplingMPI:push_hash_");
+    memory->grow(pull_pending_slot_,nvalues_max_,"CfdDatacouplingMPI:pull_pending_slot_");
+    memory->grow(pull_pending_len_,nvalues_max_,"CfdDatacouplingMPI:pull_pending_len_");
+
+    for(int i = nslots_batch_; i < nvalues_max_; i++)
+    {
+        push_batched_[i] = 0;
+        push_len_[i] = -1;
+        push_offset_[i] = 0;
+        push_dirty_[i] = 1;
+        push_hash_[i] = 0;
+    }
+    nslots_batch_ = nvalues_max_;
+}
+
+/* ----------------------------------------------------------------------
+   hash of local contribution to a pushed property
+   used to detect properties which did not change since the last batch
+------------------------------------------------------------------------- */
+
+uint64_t CfdDatacouplingMPI::hash_segment(const double *data,int len)
+{
+    // FNV-1a over the raw bytes
+    const unsigned char *bytes = (const unsigned char*) data;
+    const size_t nbytes = len*sizeof(double);
+    uint64_t hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < nbytes; i++)
+    {
+        hash ^= (uint64_t) bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* ----------------------------------------------------------------------
+   pack all properties registered for batch push in one message
+   properties whose data did not change on any proc since the last batch
+   are not communicated again, the old result is still valid for them
+------------------------------------------------------------------------- */
+
+void CfdDatacouplingMPI::push_batch()
+{
+    int len1,len2;
+    bool layout_changed = false;
+
+    // lengths and offsets of all properties in the batch
+
+    int len_total = 0;
+    for(int i = 0; i < npush_; i++)
+    {
+        int len = 0;
+        if(push_batched_[i])
+        {
+            len1 = len2 = -1;
+            find_push_source(pushnames_[i],pushtypes_[i],len1,len2);
+            len = len1*len2 < 1 ? 0 : len1*len2;
+        }
+        if(len != push_len_[i] || len_total != push_offset_[i])
+            layout_changed = true;
+        push_len_[i] = len;
+        push_offset_[i] = len_total;
+        len_total += len;
+    }
+
+    if(len_total > len_batch_)
+    {
+        len_batch_ = len_total;
+        batch_send_ = (double*) memory->srealloc(batch_send_,len_batch_*sizeof(double),"CfdDatacouplingMPI:batch_send_");
+        batch_recv_ = (double*) memory->srealloc(batch_recv_,len_batch_*sizeof(double),"CfdDatacouplingMPI:batch_recv_");
+    }
+    if(len_total > len_push_result_)
+    {
+        len_push_result_ = len_total;
+        push_result_ = (double*) memory->srealloc(push_result_,len_push_result_*sizeof(double),"CfdDatacouplingMPI:push_result_");
+    }
+
+    // pack local contributions and check which ones changed
+
+    vectorZeroizeN(batch_send_,len_total);
+    for(int i = 0; i < npush_; i++)
+    {
+        push_dirty_[i] = 0;
+        if(push_len_[i] < 1)
+            continue;
+
+        len1 = len2 = -1;
+        void *from = find_push_source(pushnames_[i],pushtypes_[i],len1,len2);
+        double *segment = &(batch_send_[push_offset_[i]]);
+        pack_push<double>(pushtypes_[i],from,segment,len1,len2);
+
+        uint64_t hash = hash_segment(segment,push_len_[i]);
+        if(layout_changed || hash != push_hash_[i])
+            push_dirty_[i] = 1;
+        push_hash_[i] = hash;
+    }
+
+    int *dirty_all = check_grow<int>(npush_);
+    MPI_Allreduce(push_dirty_,dirty_all,npush_,MPI_INT,MPI_MAX,world);
+    for(int i = 0; i < npush_; i++)
+        push_dirty_[i] = dirty_all[i];
+
+    // move dirty segments to the front of the send buffer
+
+    int len_send = 0;
+    for(int i = 0; i < npush_; i++)
+    {
+        if(!push_dirty_[i] || push_len_[i] < 1)
+            continue;
+        if(len_send != push_offset_[i])
+            memmove(&(batch_send_[len_send]),&(batch_send_[push_offset_[i]]),push_len_[i]*sizeof(double));
+        len_send += push_len_[i];
+    }
+
+    // single allreduce for all properties that changed
+
+    if(len_send > 0)
+        MPI_Allreduce(batch_send_,batch_recv_,len_send,MPI_DOUBLE,MPI_SUM,world);
+
+    len_send = 0;
+    for(int i = 0; i < npush_; i++)
+    {
+        if(push_len_[i] < 1)
+            continue;
+        if(!push_dirty_[i])
+        {
+            nvalues_skipped_ += push_len_[i];
+            continue;
+        }
+        memcpy(&(push_result_[push_offset_[i]]),&(batch_recv_[len_send]),push_len_[i]*sizeof(double));
+        len_send += push_len_[i];
+    }
+
+    nbatch_push_++;
+    push_batch_valid_ = true;
+}
+
+/* ----------------------------------------------------------------------
+   communicate all queued pull transfers with a single allreduce
+------------------------------------------------------------------------- */
+
+void CfdDatacouplingMPI::flush_pull_batch()
+{
+    int len1,len2;
+
+    int len_total = 0;
+    for(int i = 0; i < npull_pending_; i++)
+        len_total += pull_pending_len_[i];
+
+    if(len_total > len_batch_)
+    {
+        len_batch_ = len_total;
+        batch_send_ = (double*) memory->srealloc(batch_send_,len_batch_*sizeof(double),"CfdDatacouplingMPI:batch_send_");
+        batch_recv_ = (double*) memory->srealloc(batch_recv_,len_batch_*sizeof(double),"CfdDatacouplingMPI:batch_recv_");
+    }
+
+    if(len_total > 0)
+    {
+        MPI_Allreduce(pull_stage_,batch_recv_,len_total,MPI_DOUBLE,MPI_SUM,world);
+        nbatch_pull_++;
+    }
+
+    int offset = 0;
+    for(int i = 0; i < npull_pending_; i++)
+    {
+        int islot = pull_pending_slot_[i];
+        len1 = len2 = -1;
+        void *to = find_pull_target(pullnames_[islot],pulltypes_[islot],len1,len2);
+        if(len1*len2 != pull_pending_len_[i])
+            error->one(FLERR,"CFD coupling (batch mode): size of pulled property changed before the run");
+        unpack_pull<double>(pulltypes_[islot],to,&(batch_recv_[offset]),len1,len2);
+        offset += pull_pending_len_[i];
+    }
+
+    npull_pending_ = 0;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void CfdDatacouplingMPI::allocate_external(int **&data, int len2,int len1,int initvalue)
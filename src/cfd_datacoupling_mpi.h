@@ -61,6 +61,7 @@ class CfdDatacouplingMPI : public CfdDatacoupling {
   CfdDatacouplingMPI(class LAMMPS *, int,int, char **,class FixCfdCoupling*);
   ~CfdDatacouplingMPI();
 
+  void init();
   void exchange();
 
   virtual void pull(const char *name, const char *type, void *&ptr, const char *datatype);
@@ -81,12 +82,61 @@ class CfdDatacouplingMPI : public CfdDatacoupling {
   template <typename T> T* check_grow(int len);
   template <typename T> MPI_Datatype mpi_type_dc();
 
+  void* find_pull_target(const char *name,const char *type,int &len1,int &len2);
+  void* find_push_source(const char *name,const char *type,int &len1,int &len2);
+  template <typename T> void unpack_pull(const char *type,void *to,const T *allred,int len1,int len2);
+  template <typename T> void pack_push(const char *type,void *from,T *allred,int len1,int len2);
+
+  // batched coupling
+  int find_slot(char **names,char **types,int n,const char *name,const char *type);
+  void grow_batch_slots();
+  void push_batch();
+  void flush_pull_batch();
+  uint64_t hash_segment(const double *data,int len);
+
   // 1D helper array needed to allreduce the quantities
   int len_allred_double;
   double *allred_double;
 
   int len_allred_int;
   int *allred_int;
+
+  // batched mode: all double properties of one exchange are
+  // communicated with a single allreduce each way
+  bool batch_;
+
+  // per push property: 1 if registered for batch transfer,
+  // length and offset in push_result_, hash of local contribution
+  int nslots_batch_;
+  int *push_batched_;
+  int *push_len_;
+  int *push_offset_;
+  int *push_dirty_;
+  uint64_t *push_hash_;
+
+  // push_result_ holds the reduced data of the last batch,
+  // it is valid until the next run is initialized
+  bool push_batch_valid_;
+  int len_push_result_;
+  double *push_result_;
+
+  // send and receive buffers for batch transfer
+  int len_batch_;
+  double *batch_send_;
+  double *batch_recv_;
+
+  // pull transfers queued until the next init()
+  // data is copied to pull_stage_ when pull() is called
+  int npull_pending_;
+  int *pull_pending_slot_;
+  int *pull_pending_len_;
+  int len_pull_stage_;
+  double *pull_stage_;
+
+  // statistics
+  int nbatch_push_;
+  int nbatch_pull_;
+  bigint nvalues_skipped_;
 };
 
 /* ---------------------------------------------------------------------- */
@@ -94,23 +144,10 @@ class CfdDatacouplingMPI : public CfdDatacoupling {
 template <typename T>
 void CfdDatacouplingMPI::pull_mpi(const char *name,const char *type,void *&from)
 {
-    int len1 = -1, len2 = -1, m;
+    int len1 = -1, len2 = -1;
 
     // get reference where to write the data
-    void * to = find_pull_property(name,type,len1,len2);
-
-    if (atom->nlocal && (!to || len1 < 0 || len2 < 0))
-    {
-        if(screen) fprintf(screen,"LIGGGHTS could not find property %s to write data from calling program to.\n",name);
-
-        if(!to && len2 > 0)
-            if(screen) fprintf(screen,"Detailed info: reason is that len2 = %d, but pointer is empty. \n"
-                                      "The reason could be that property is not allocated within LIGGGHTS. \n"
-                                      "This hints to a NON allocated atom property (i.e., a deep error in your simulation setup). \n"
-                                      "Ensure that your atom properties do not collide with property/atom \n"
-                                      "(i.e., use a different property/atom name, or change your atom_style)!\n", len2);
-        lmp->error->one(FLERR,"This is fatal");
-    }
+    void * to = find_pull_target(name,type,len1,len2);
 
     // return if no data to transmit
     if(len1*len2 < 1) return;
@@ -125,7 +162,19 @@ void CfdDatacouplingMPI::pull_mpi(const char *name,const char *type,void *&from)
     T **from_t = (T**)from;
     MPI_Allreduce(&(from_t[0][0]),&(allred[0]),len1*len2,mpi_type_dc<T>(),MPI_SUM,world);
 
-    // copy data - loops over max # global atoms, bodies
+    unpack_pull<T>(type,to,allred,len1,len2);
+}
+
+/* ----------------------------------------------------------------------
+   copy allreduced data to local atoms / bodies
+   loops over max # global atoms, bodies
+------------------------------------------------------------------------- */
+
+template <typename T>
+void CfdDatacouplingMPI::unpack_pull(const char *type,void *to,const T *allred,int len1,int len2)
+{
+    int m;
+
     if(strcmp(type,"scalar-atom") == 0)
     {
         T *to_t = (T*) to;
@@ -177,30 +226,10 @@ void CfdDatacouplingMPI::pull_mpi(const char *name,const char *type,void *&from)
 template <typename T>
 void CfdDatacouplingMPI::push_mpi(const char *name,const char *type,void *&to)
 {
-    int len1 = -1, len2 = -1, id;
-
-    int *tag = atom->tag;
-    int nlocal = atom->nlocal;
-    int nbodies = 0;
-
-    Multisphere *ms_data = properties_->ms_data();
-    if(ms_data) nbodies = ms_data->n_body();
+    int len1 = -1, len2 = -1;
 
     // get reference where to write the data
-    void * from = find_push_property(name,type,len1,len2);
-
-    if (atom->nlocal && (!from || len1 < 0 || len2 < 0))
-    {
-        
-        if(screen) fprintf(screen,"LIGGGHTS could not find property %s to write data from calling program to.\n",name);
-        if(!from && len2 > 0)
-            if(screen) fprintf(screen,"Detailed info: reason is that len2 = %d, but pointer is empty. \n"
-                                      "The reason could be that property is not allocated within LIGGGHTS. \n"
-                                      "This hints to a NON allocated atom property (i.e., a deep error in your simulation setup). \n"
-                                      "Ensure that your atom properties do not collide with property/atom \n"
-                                      "(i.e., use a different property/atom name, or change your atom_style)!\n", len2);
-        lmp->error->one(FLERR,"This is fatal");
-    }
+    void * from = find_push_source(name,type,len1,len2);
 
     // return if no data to transmit
     if(len1*len2 < 1) return;
@@ -211,7 +240,30 @@ void CfdDatacouplingMPI::push_mpi(const char *name,const char *type,void *&to)
     // zeroize before using allreduce
     vectorZeroizeN(allred,len1*len2);
 
-    // copy data - loop local # atoms, bodies
+    pack_push<T>(type,from,allred,len1,len2);
+
+    // perform allreduce on outgoing data
+    T **to_t = (T**)to;
+    MPI_Allreduce(&(allred[0]),&(to_t[0][0]),len1*len2,mpi_type_dc<T>(),MPI_SUM,world);
+}
+
+/* ----------------------------------------------------------------------
+   copy data of local atoms / bodies to global (zeroized) array
+   loop local # atoms, bodies
+------------------------------------------------------------------------- */
+
+template <typename T>
+void CfdDatacouplingMPI::pack_push(const char *type,void *from,T *allred,int len1,int len2)
+{
+    int id;
+
+    int *tag = atom->tag;
+    int nlocal = atom->nlocal;
+    int nbodies = 0;
+
+    Multisphere *ms_data = properties_->ms_data();
+    if(ms_data) nbodies = ms_data->n_body();
+
     if(strcmp(type,"scalar-atom") == 0)
     {
         T *from_t = (T*) from;
@@ -267,10 +319,6 @@ void CfdDatacouplingMPI::push_mpi(const char *name,const char *type,void *&to)
                 allred[i*len2 + j] = from_t[i][j];
     }
     else error->one(FLERR,"Illegal data type in CfdDatacouplingMPI::pull");
-
-    // perform allreduce on outgoing data
-    T **to_t = (T**)to;
-    MPI_Allreduce(&(allred[0]),&(to_t[0][0]),len1*len2,mpi_type_dc<T>(),MPI_SUM,world);
 }
 
 /* ---------------------------------------------------------------------- */
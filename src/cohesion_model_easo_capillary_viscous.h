@@ -79,6 +79,60 @@ namespace MODEL_PARAMS
       ScalarProperty* fluidViscosityScalar = MODEL_PARAMS::createScalarProperty(registry, "fluidViscosity", caller);
       return fluidViscosityScalar;
     }
+
+    /* ----------------------------------------------------------------------
+       per-type-pair tables of the contact angle terms, the capillary
+       parameter B = (-0.148 ln V - 0.96) theta^2 - 0.0082 ln V + 0.48
+       is evaluated as B = bSlope ln V + bOffset
+    ------------------------------------------------------------------------- */
+
+    inline static MatrixProperty* createContactAngleEffEaso(PropertyRegistry & registry, const char * caller, bool sanity_checks)
+    {
+      const int max_type = registry.max_type();
+
+      registry.registerProperty("contactAngle", &MODEL_PARAMS::createContactAngle);
+
+      MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+      double * contactAngle = registry.getVectorProperty("contactAngle",caller)->data;
+
+      for(int i=1;i< max_type+1; i++)
+        for(int j=1;j<max_type+1;j++)
+          matrix->data[i][j] = 0.5 * contactAngle[i] * contactAngle[j];
+
+      return matrix;
+    }
+
+    inline static MatrixProperty* createCapillaryBSlopeEaso(PropertyRegistry & registry, const char * caller, bool sanity_checks)
+    {
+      const int max_type = registry.max_type();
+
+      registry.registerProperty("contactAngleEffEaso", &createContactAngleEffEaso);
+
+      MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+      double ** contactAngleEff = registry.getMatrixProperty("contactAngleEffEaso",caller)->data;
+
+      for(int i=1;i< max_type+1; i++)
+        for(int j=1;j<max_type+1;j++)
+          matrix->data[i][j] = -0.148*contactAngleEff[i][j]*contactAngleEff[i][j] - 0.0082;
+
+      return matrix;
+    }
+
+    inline static MatrixProperty* createCapillaryBOffsetEaso(PropertyRegistry & registry, const char * caller, bool sanity_checks)
+    {
+      const int max_type = registry.max_type();
+
+      registry.registerProperty("contactAngleEffEaso", &createContactAngleEffEaso);
+
+      MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+      double ** contactAngleEff = registry.getMatrixProperty("contactAngleEffEaso",caller)->data;
+
+      for(int i=1;i< max_type+1; i++)
+        for(int j=1;j<max_type+1;j++)
+          matrix->data[i][j] = -0.96*contactAngleEff[i][j]*contactAngleEff[i][j] + 0.48;
+
+      return matrix;
+    }
 }
 
 namespace LIGGGHTS {
@@ -93,7 +147,9 @@ namespace ContactModels {
       CohesionModelBase(lmp, hsetup, cmb),
       surfaceLiquidContentInitial(0.0),
       surfaceTension(0.0),
-      contactAngle(0),
+      contactAngleEff(0),
+      bSlope(0),
+      bOffset(0),
       minSeparationDistanceRatio(0.0),
       maxSeparationDistanceRatio(0.0),
       fluidViscosity(0.),
@@ -120,14 +176,18 @@ namespace ContactModels {
       registry.registerProperty("surfaceLiquidContentInitial", &MODEL_PARAMS::createliquidContentInitialEaso);
       registry.registerProperty("surfaceTension", &MODEL_PARAMS::createSurfaceTension);
       registry.registerProperty("fluidViscosity", &MODEL_PARAMS::createFluidViscosityEaso);
-      registry.registerProperty("contactAngle", &MODEL_PARAMS::createContactAngle);
+      registry.registerProperty("contactAngleEffEaso", &MODEL_PARAMS::createContactAngleEffEaso);
+      registry.registerProperty("capillaryBSlopeEaso", &MODEL_PARAMS::createCapillaryBSlopeEaso);
+      registry.registerProperty("capillaryBOffsetEaso", &MODEL_PARAMS::createCapillaryBOffsetEaso);
       registry.registerProperty("minSeparationDistanceRatio", &MODEL_PARAMS::createMinSeparationDistanceRatioEaso);
       registry.registerProperty("maxSeparationDistanceRatio", &MODEL_PARAMS::createMaxSeparationDistanceRatioEaso);
 
       registry.connect("surfaceLiquidContentInitial", surfaceLiquidContentInitial,"cohesion_model easo/capillary/viscous");
       registry.connect("surfaceTension", surfaceTension,"cohesion_model easo/capillary/viscous");
       registry.connect("fluidViscosity", fluidViscosity,"cohesion_model easo/capillary/viscous");
-      registry.connect("contactAngle", contactAngle,"cohesion_model easo/capillary/viscous");
+      registry.connect("contactAngleEffEaso", contactAngleEff,"cohesion_model easo/capillary/viscous");
+      registry.connect("capillaryBSlopeEaso", bSlope,"cohesion_model easo/capillary/viscous");
+      registry.connect("capillaryBOffsetEaso", bOffset,"cohesion_model easo/capillary/viscous");
       registry.connect("minSeparationDistanceRatio", minSeparationDistanceRatio,"cohesion_model easo/capillary/viscous");
       
       registry.connect("maxSeparationDistanceRatio", maxSeparationDistanceRatio,"cohesion_model easo/capillary/viscous");
@@ -207,7 +267,6 @@ namespace ContactModels {
       if(volBond1000 < 1e-14) return;
 
       const double rEff = radi*radj / (radi+radj);
-      const double contactAngleEff = 0.5 * contactAngle[itype] * contactAngle[jtype];
 
       // capilar force
       // this is from Soulie et al, Intl. J Numerical and Analytical Methods in Geomechanics
@@ -216,8 +275,9 @@ namespace ContactModels {
       const double R2 = (radi >=radj) ? radi : radj;
       const double R2inv = 1./R2;
       const double volBondScaled = volBond1000*R2inv*0.001*R2inv*R2inv;
-      const double Bparam = (-0.148*log(volBondScaled)-0.96)*contactAngleEff*contactAngleEff - 0.0082*log(volBondScaled) + 0.48;
-      const double Cparam = 0.0018*log(volBondScaled)+0.078;
+      const double lnVolBondScaled = log(volBondScaled);
+      const double Bparam = bSlope[itype][jtype]*lnVolBondScaled + bOffset[itype][jtype];
+      const double Cparam = 0.0018*lnVolBondScaled+0.078;
       const double Fcapilary = - M_PI*surfaceTension*sqrt(radi*radj)*(exp(Bparam)+Cparam);
 
       // viscous force
@@ -306,8 +366,7 @@ namespace ContactModels {
       const double volBond1000 = volLiBond1000+volLjBond1000;
 
       const double rEff = radi*radj / (radi+radj);
-      const double contactAngleEff = 0.5 * contactAngle[itype] * contactAngle[jtype];
-      const double distMax = (1. + 0.5*contactAngleEff) * cbrt(volBond1000) *0.1;
+      const double distMax = (1. + 0.5*contactAngleEff[itype][jtype]) * cbrt(volBond1000) *0.1;
 
       // check if liquid bridge exists
       bool bridge_active = false, bridge_breaks = false;
@@ -342,9 +401,10 @@ namespace ContactModels {
           const double R2 = (radi >=radj) ? radi : radj;
           const double R2inv = 1./R2;
           const double volBondScaled = volBond1000*R2inv*0.001*R2inv*R2inv;
-          const double Aparam = -1.1*pow((volBondScaled),-0.53);
-          const double Bparam = (-0.148*log(volBondScaled)-0.96)*contactAngleEff*contactAngleEff - 0.0082*log(volBondScaled) + 0.48;
-          const double Cparam = 0.0018*log(volBondScaled)+0.078;
+          const double lnVolBondScaled = log(volBondScaled);
+          const double Aparam = -1.1*exp(-0.53*lnVolBondScaled);
+          const double Bparam = bSlope[itype][jtype]*lnVolBondScaled + bOffset[itype][jtype];
+          const double Cparam = 0.0018*lnVolBondScaled+0.078;
           const double Fcapilary = - M_PI*surfaceTension*sqrt(radi*radj)*(exp(Aparam*dist/R2+Bparam)+Cparam);
 
           // calculate vn and vt since not in struct
@@ -472,7 +532,8 @@ namespace ContactModels {
     }
 
   private:
-    double surfaceLiquidContentInitial, surfaceTension, *contactAngle;
+    double surfaceLiquidContentInitial, surfaceTension;
+    double **contactAngleEff, **bSlope, **bOffset;
     double minSeparationDistanceRatio, maxSeparationDistanceRatio, fluidViscosity;
     double ln1overMinSeparationDistanceRatio;
     int history_offset;
@@ -81,6 +81,7 @@
 #include "error.h"
 #include "memory.h"
 #include "fix_insert.h"
+#include "timer.h"
 
 #ifdef _OPENMP
 #include "omp.h"
@@ -389,6 +390,12 @@ void Comm::init()
   for (int i = 0; i < modify->nfix; i++)
     size_border += modify->fix[i]->comm_border;
 
+  // queued Fix comm of a previous run is obsolete, Fixes may have been deleted
+
+  forward_fix_queue.clear();
+  forward_fix_variable.clear();
+  reverse_fix_queue.clear();
+
   // maxexchange = max # of datums/atom in exchange communication
   // maxforward = # of datums in largest forward communication
   // maxreverse = # of datums in largest reverse communication
@@ -609,11 +616,6 @@ void Comm::setup()
     maxneed[2] = MAX(all[4],all[5]);
   }
 
-  // allocate comm memory
-
-  nswap = 2 * (maxneed[0]+maxneed[1]+maxneed[2]);
-  if (nswap > maxswap) grow_swap(nswap);
-
   dw_ = dynamic_cast<DomainWedge*>(domain);
   if(dw_)
   {
@@ -627,8 +629,18 @@ void Comm::setup()
       pleft[1]  = c[1] - nleft[1]  * (use_gran_opt() ? (cutghmax / 2. + neighbor->skin/2.) : cutghmax);
       pright[0] = c[0] - nright[0] * (use_gran_opt() ? (cutghmax / 2. + neighbor->skin/2.) : cutghmax);
       pright[1] = c[1] - nright[1] * (use_gran_opt() ? (cutghmax / 2. + neighbor->skin/2.) : cutghmax);
-      
+
+      // angular direction is a single swap pair across the periodic faces,
+      // decide_wedge() selects by distance to the faces, not by slabs
+
+      maxneed[iphi] = 1;
+      sendneed[iphi][0] = sendneed[iphi][1] = 1;
   }
+
+  // allocate comm memory
+
+  nswap = 2 * (maxneed[0]+maxneed[1]+maxneed[2]);
+  if (nswap > maxswap) grow_swap(nswap);
   
   // setup parameters for each exchange:
   // sendproc = proc to send to at each swap
@@ -1384,6 +1396,223 @@ void Comm::reverse_comm_fix(Fix *fix)
   }
 }
 
+/* ----------------------------------------------------------------------
+   forward communication invoked by several Fixes at once
+   values of all Fixes are packed into one message per swap
+   each Fix has a constant number of datums per atom unless flagged
+   in variable, those Fixes send a total count ahead of their values
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_fix(Fix **fixes, int nfix, const int *variable)
+{
+  int iswap,ifix,n,m;
+  double *buf;
+  MPI_Request request;
+  MPI_Status status;
+
+  if (nfix == 0) return;
+  if (nfix == 1) {
+    if (variable && variable[0]) forward_comm_variable_fix(fixes[0]);
+    else forward_comm_fix(fixes[0]);
+    return;
+  }
+
+  // insure buffers are long enough for the values of all Fixes
+  // comm_forward of a variable-size Fix is its max # of datums per atom
+
+  int nper = 0, nvar = 0;
+  for (ifix = 0; ifix < nfix; ifix++) {
+    nper += fixes[ifix]->comm_forward;
+    if (variable && variable[ifix]) nvar++;
+  }
+
+  int smax = 0, rmax = 0;
+  for (iswap = 0; iswap < nswap; iswap++) {
+    smax = MAX(smax,sendnum[iswap]);
+    rmax = MAX(rmax,recvnum[iswap]);
+  }
+  if (nper*smax+nvar > maxsend) grow_send(nper*smax+nvar,0);
+  if (nper*rmax+nvar > maxrecv) grow_recv(nper*rmax+nvar);
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer, one block per Fix
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      if (variable && variable[ifix]) {
+        const int mcount = m++;
+        n = fixes[ifix]->pack_comm(sendnum[iswap],sendlist[iswap],
+                                   &buf_send[m],pbc_flag[iswap],pbc[iswap]);
+        buf_send[mcount] = static_cast<double>(n);
+        m += n;
+      } else {
+        n = fixes[ifix]->pack_comm(sendnum[iswap],sendlist[iswap],
+                                   &buf_send[m],pbc_flag[iswap],pbc[iswap]);
+        m += n*sendnum[iswap];
+      }
+    }
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,nvar ? maxrecv : nper*recvnum[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&request);
+      if (sendnum[iswap])
+        MPI_Send(buf_send,m,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (recvnum[iswap]) MPI_Wait(&request,&status);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer in same order
+
+    if (recvnum[iswap] == 0) continue;
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      if (variable && variable[ifix]) {
+        n = static_cast<int>(buf[m++]);
+        fixes[ifix]->unpack_comm(recvnum[iswap],firstrecv[iswap],&buf[m]);
+        m += n;
+      } else {
+        fixes[ifix]->unpack_comm(recvnum[iswap],firstrecv[iswap],&buf[m]);
+        m += fixes[ifix]->comm_forward*recvnum[iswap];
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   reverse communication invoked by several Fixes at once
+   values of all Fixes are packed into one message per swap
+   each Fix has a constant number of datums per atom
+------------------------------------------------------------------------- */
+
+void Comm::reverse_comm_fix(Fix **fixes, int nfix)
+{
+  int iswap,ifix,n,m;
+  double *buf;
+  MPI_Request request;
+  MPI_Status status;
+
+  if (nfix == 0) return;
+  if (nfix == 1) {
+    reverse_comm_fix(fixes[0]);
+    return;
+  }
+
+  // insure buffers are long enough for the values of all Fixes
+
+  int nper = 0;
+  for (ifix = 0; ifix < nfix; ifix++) nper += fixes[ifix]->comm_reverse;
+
+  int smax = 0, rmax = 0;
+  for (iswap = 0; iswap < nswap; iswap++) {
+    smax = MAX(smax,sendnum[iswap]);
+    rmax = MAX(rmax,recvnum[iswap]);
+  }
+  if (nper*rmax > maxsend) grow_send(nper*rmax,0);
+  if (nper*smax > maxrecv) grow_recv(nper*smax);
+
+  for (iswap = nswap-1; iswap >= 0; iswap--) {
+
+    // pack buffer, one block per Fix
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      n = fixes[ifix]->pack_reverse_comm(recvnum[iswap],firstrecv[iswap],
+                                         &buf_send[m]);
+      m += n*recvnum[iswap];
+    }
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      if (sendnum[iswap])
+        MPI_Irecv(buf_recv,nper*sendnum[iswap],MPI_DOUBLE,sendproc[iswap],0,
+                  world,&request);
+      if (recvnum[iswap])
+        MPI_Send(buf_send,m,MPI_DOUBLE,recvproc[iswap],0,world);
+      if (sendnum[iswap]) MPI_Wait(&request,&status);
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer in same order
+
+    m = 0;
+    for (ifix = 0; ifix < nfix; ifix++) {
+      fixes[ifix]->unpack_reverse_comm(sendnum[iswap],sendlist[iswap],&buf[m]);
+      m += fixes[ifix]->comm_reverse*sendnum[iswap];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   queue a Fix for forward/reverse comm at the next flush
+   a Fix queued more than once is communicated only once
+   variable = 1 for a Fix with a variable # of datums per atom
+------------------------------------------------------------------------- */
+
+void Comm::queue_forward_comm_fix(Fix *fix, int variable)
+{
+  for (size_t i = 0; i < forward_fix_queue.size(); i++)
+    if (forward_fix_queue[i] == fix) return;
+  forward_fix_queue.push_back(fix);
+  forward_fix_variable.push_back(variable);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Comm::queue_reverse_comm_fix(Fix *fix)
+{
+  for (size_t i = 0; i < reverse_fix_queue.size(); i++)
+    if (reverse_fix_queue[i] == fix) return;
+  reverse_fix_queue.push_back(fix);
+}
+
+/* ----------------------------------------------------------------------
+   communicate all queued Fixes in one message per swap and clear queue
+   must be called by all procs with the same Fixes queued in the same order
+------------------------------------------------------------------------- */
+
+void Comm::flush_forward_comm_fix()
+{
+  if (forward_fix_queue.empty()) return;
+  timer->stamp();
+  forward_comm_fix(&forward_fix_queue[0],forward_fix_queue.size(),
+                   &forward_fix_variable[0]);
+  forward_fix_queue.clear();
+  forward_fix_variable.clear();
+  timer->stamp(TIME_COMM);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Comm::flush_reverse_comm_fix()
+{
+  if (reverse_fix_queue.empty()) return;
+  timer->stamp();
+  reverse_comm_fix(&reverse_fix_queue[0],reverse_fix_queue.size());
+  reverse_fix_queue.clear();
+  timer->stamp(TIME_COMM);
+}
+
+/* ----------------------------------------------------------------------
+   sync point for queued Fix comm, called by the integrators once before
+   the force computation and once before final_integrate()
+   Fixes may queue comm in any hook if the ghost values are not needed
+   before the next sync point
+------------------------------------------------------------------------- */
+
+void Comm::flush_comm_fix()
+{
+  flush_forward_comm_fix();
+  flush_reverse_comm_fix();
+}
+
 /* ----------------------------------------------------------------------
    forward communication invoked by a Fix
    n = total datums for all atoms, allows for variable number/atom
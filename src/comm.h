@@ -105,6 +105,13 @@ class Comm : protected Pointers {
   virtual void reverse_comm_fix(class Fix *);      // reverse comm from a Fix
   virtual void forward_comm_variable_fix(class Fix *); // variable-size variant
   virtual void reverse_comm_variable_fix(class Fix *); // variable-size variant
+  void forward_comm_fix(class Fix **, int, const int *variable = NULL);
+  void reverse_comm_fix(class Fix **, int);        // aggregated comm of Fixes
+  void queue_forward_comm_fix(class Fix *, int variable = 0);
+  void queue_reverse_comm_fix(class Fix *);        // queue Fix for next flush
+  void flush_forward_comm_fix();                   // comm all queued Fixes
+  void flush_reverse_comm_fix();
+  void flush_comm_fix();                           // sync point of integrators
   virtual void forward_comm_compute(class Compute *);  // forward from a Compute
   virtual void reverse_comm_compute(class Compute *);  // reverse from a Compute
   virtual void forward_comm_dump(class Dump *);    // forward comm from a Dump
@@ -169,6 +176,9 @@ class Comm : protected Pointers {
   int maxforward,maxreverse;        // max # of datums in forward/reverse comm
 
   int maxexchange;                  // max # of datums/atom in exchange comm
+  std::vector<class Fix *> forward_fix_queue; // Fixes queued for forward comm
+  std::vector<int> forward_fix_variable;      // 1 if queued Fix is variable-size
+  std::vector<class Fix *> reverse_fix_queue; // Fixes queued for reverse comm
   int bufextra;                     // extra space beyond maxsend in send buffer
 
   int updown(int, int, int, double, int, double *);
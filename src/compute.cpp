@@ -67,7 +67,10 @@ using namespace LAMMPS_NS;
 
 Compute::Compute(LAMMPS *lmp, int &iarg, int narg, char ** arg) :
     Pointers(lmp),
-    update_on_run_end_(false)
+    update_on_run_end_(false),
+    time_recording(false),
+    recorded_time(0.0),
+    previous_time(0.0)
 {
   if (narg < 3) error->all(FLERR,"Illegal compute command");
 
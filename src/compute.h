@@ -179,6 +179,34 @@ class Compute : protected Pointers {
 
   // true if this compute is updated at the end of every run
   bool update_on_run_end_;
+
+ private:
+  // time spent in compute invocations, incl. computes invoked by this one
+  // only recorded if modify_timing is on, set by Timer::init()
+  bool time_recording;
+  double recorded_time;
+  double previous_time;
+
+ public:
+  inline void set_time_recording(bool flag) {
+    time_recording = flag;
+  }
+
+  inline void reset_time_recording() {
+    recorded_time = 0.0;
+  }
+
+  inline double get_recorded_time() const {
+    return recorded_time;
+  }
+
+  inline void begin_time_recording() {
+    if (time_recording) previous_time = MPI_Wtime();
+  }
+
+  inline void end_time_recording() {
+    if (time_recording) recorded_time += MPI_Wtime() - previous_time;
+  }
 };
 
 }
@@ -0,0 +1,455 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include "compute_cluster_atom_gran.h"
+#include "atom.h"
+#include "update.h"
+#include "modify.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "pair_gran.h"
+#include "force.h"
+#include "pair.h"
+#include "comm.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+ComputeClusterAtomGran::ComputeClusterAtomGran(LAMMPS *lmp, int &iarg, int narg, char **arg) :
+  Compute(lmp, iarg, narg, arg)
+{
+  if (narg < iarg)
+      error->all(FLERR,"Illegal compute cluster/atom/gran command");
+
+  skin = 0.;
+  pair_gran = 0;
+  history_flag = 0;
+
+  if(narg > iarg)
+  {
+      if (narg < iarg+2)
+          error->all(FLERR,"Illegal compute cluster/atom/gran command");
+      if(strcmp("skin",arg[iarg++]))
+          error->all(FLERR,"Illegal compute cluster/atom/gran command, expecting keyword 'skin'");
+      skin = atof(arg[iarg++]);
+  }
+
+  peratom_flag = 1;
+  size_peratom_cols = 0;
+  vector_flag = 1;
+  size_vector = 5;
+  extvector = 0;
+  comm_forward = 1;
+
+  nmax = 0;
+  clusterID = NULL;
+  parent = NULL;
+  vector = stats;
+  for (int i = 0; i < 5; i++) stats[i] = 0.;
+
+  // error checks
+
+  if (!atom->sphere_flag)
+      error->all(FLERR,"Compute cluster/atom/gran requires atom style sphere");
+}
+
+/* ---------------------------------------------------------------------- */
+
+ComputeClusterAtomGran::~ComputeClusterAtomGran()
+{
+  memory->destroy(clusterID);
+  memory->destroy(parent);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeClusterAtomGran::init()
+{
+  if (atom->tag_enable == 0)
+    error->all(FLERR,"Cannot use compute cluster/atom/gran unless atoms have IDs");
+
+  pair_gran = static_cast<PairGran*>(force->pair_match("gran", 0));
+  if (!pair_gran)
+    error->all(FLERR,"Compute cluster/atom/gran requires a granular pair style");
+  history_flag = pair_gran->is_history();
+
+  int count = 0;
+  for (int i = 0; i < modify->ncompute; i++)
+    if (strcmp(modify->compute[i]->style,"cluster/atom/gran") == 0) count++;
+  if (count > 1 && comm->me == 0)
+    error->warning(FLERR,"More than one compute cluster/atom/gran");
+}
+
+/* ----------------------------------------------------------------------
+   label clusters of particles connected by granular contacts
+   1) union-find over own and ghost particles using the contacts of the
+      granular neighbor list, label = smallest atom ID in the component
+   2) one forward comm gives each ghost the label its owner assigned
+   3) label pairs of ghosts are gathered on all procs and merged by a
+      union-find over labels, so the cost does not depend on the
+      extent of the clusters
+------------------------------------------------------------------------- */
+
+void ComputeClusterAtomGran::compute_peratom()
+{
+  int i,j,ii,jj,inum,jnum;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  double radi,radsum,radsumsq;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+  int *contact_flag = 0,**first_contact_flag = 0;
+
+  invoked_peratom = update->ntimestep;
+
+  // grow arrays if necessary
+
+  if (atom->nmax > nmax) {
+    memory->destroy(clusterID);
+    memory->destroy(parent);
+    nmax = atom->nmax;
+    memory->create(clusterID,nmax,"cluster/atom/gran:clusterID");
+    memory->create(parent,nmax,"cluster/atom/gran:parent");
+    vector_atom = clusterID;
+  }
+
+  // access gran neigh list
+
+  inum = pair_gran->list->inum;
+  ilist = pair_gran->list->ilist;
+  numneigh = pair_gran->list->numneigh;
+  firstneigh = pair_gran->list->firstneigh;
+  if(history_flag) first_contact_flag = pair_gran->listgranhistory->firstneigh;
+
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int *tag = atom->tag;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  for (i = 0; i < nall; i++) parent[i] = i;
+
+  // local union-find, contact if distance <= sum of radii
+  // or if contact history has the pair in contact
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+    if(history_flag) contact_flag = first_contact_flag[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      if (!(mask[j] & groupbit)) continue;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      radsum = radi + radius[j] + skin;
+      radsumsq = radsum*radsum;
+      if ((rsq <= radsumsq) || (history_flag && contact_flag[jj])) {
+        int ri = find(i);
+        int rj = find(j);
+        if (ri < rj) parent[rj] = ri;
+        else if (rj < ri) parent[ri] = rj;
+      }
+    }
+  }
+
+  // label of each component is the smallest atom ID of its members
+  // remember which components contain own atoms
+
+  std::vector<int> owned(nall,0);
+
+  for (i = 0; i < nall; i++) clusterID[i] = 0.;
+  for (i = 0; i < nall; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    int r = find(i);
+    if (clusterID[r] == 0. || tag[i] < clusterID[r]) clusterID[r] = tag[i];
+    if (i < nlocal) owned[r] = 1;
+  }
+  for (i = 0; i < nall; i++)
+    if (mask[i] & groupbit) clusterID[i] = clusterID[find(i)];
+
+  // ghost labels assigned on this proc, then get labels of their owners
+
+  std::vector<int> ghostlabel(nall-nlocal);
+  for (i = nlocal; i < nall; i++)
+    ghostlabel[i-nlocal] = static_cast<int>(clusterID[i]);
+
+  comm->forward_comm_compute(this);
+
+  // each ghost in a component with own atoms links the local label
+  // to the owner label, also if identical so the cluster is known to
+  // extend across procs
+
+  std::vector<int> edges;
+  for (i = nlocal; i < nall; i++) {
+    if (!(mask[i] & groupbit) || !owned[find(i)]) continue;
+    int a = ghostlabel[i-nlocal];
+    int b = static_cast<int>(clusterID[i]);
+    edges.push_back(MIN(a,b));
+    edges.push_back(MAX(a,b));
+  }
+
+  std::vector<int> labels,rep;
+  merge_global(edges,labels,rep);
+
+  // final cluster ID of own atoms
+
+  for (i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    int label = static_cast<int>(clusterID[i]);
+    std::vector<int>::iterator it = std::lower_bound(labels.begin(),labels.end(),label);
+    if (it != labels.end() && *it == label)
+      clusterID[i] = labels[rep[it-labels.begin()]];
+  }
+
+  calc_stats(labels,rep);
+}
+
+/* ----------------------------------------------------------------------
+   gather label pairs from all procs and merge them
+   labels = sorted unique labels of all pairs
+   rep = index of the representative (smallest) label of each label
+------------------------------------------------------------------------- */
+
+void ComputeClusterAtomGran::merge_global(std::vector<int> &edges, std::vector<int> &labels,
+                                          std::vector<int> &rep)
+{
+  // remove duplicate pairs before communicating
+
+  int npair = edges.size()/2;
+  std::vector< std::pair<int,int> > pairs(npair);
+  for (int k = 0; k < npair; k++)
+    pairs[k] = std::make_pair(edges[2*k],edges[2*k+1]);
+  std::sort(pairs.begin(),pairs.end());
+  pairs.erase(std::unique(pairs.begin(),pairs.end()),pairs.end());
+
+  int nsend = 2*pairs.size();
+  std::vector<int> sendbuf(nsend > 0 ? nsend : 1);
+  for (size_t k = 0; k < pairs.size(); k++) {
+    sendbuf[2*k] = pairs[k].first;
+    sendbuf[2*k+1] = pairs[k].second;
+  }
+
+  int nprocs = comm->nprocs;
+  std::vector<int> recvcounts(nprocs),displs(nprocs);
+  MPI_Allgather(&nsend,1,MPI_INT,&recvcounts[0],1,MPI_INT,world);
+
+  int nrecv = 0;
+  for (int iproc = 0; iproc < nprocs; iproc++) {
+    displs[iproc] = nrecv;
+    nrecv += recvcounts[iproc];
+  }
+
+  std::vector<int> recvbuf(nrecv > 0 ? nrecv : 1);
+  MPI_Allgatherv(&sendbuf[0],nsend,MPI_INT,&recvbuf[0],&recvcounts[0],&displs[0],MPI_INT,world);
+
+  labels.assign(recvbuf.begin(),recvbuf.begin()+nrecv);
+  std::sort(labels.begin(),labels.end());
+  labels.erase(std::unique(labels.begin(),labels.end()),labels.end());
+
+  // union-find over label indices, smaller index = smaller label wins
+
+  int nlabel = labels.size();
+  rep.resize(nlabel);
+  for (int k = 0; k < nlabel; k++) rep[k] = k;
+
+  for (int k = 0; k < nrecv; k += 2) {
+    int a = std::lower_bound(labels.begin(),labels.end(),recvbuf[k]) - labels.begin();
+    int b = std::lower_bound(labels.begin(),labels.end(),recvbuf[k+1]) - labels.begin();
+    while (rep[a] != a) a = rep[a] = rep[rep[a]];
+    while (rep[b] != b) b = rep[b] = rep[rep[b]];
+    if (a < b) rep[b] = a;
+    else if (b < a) rep[a] = b;
+  }
+
+  for (int k = 0; k < nlabel; k++) {
+    int r = k;
+    while (rep[r] != r) r = rep[r];
+    rep[k] = r;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   cluster statistics: # of clusters, max and mean # of particles,
+   max and mean mass per cluster
+   clusters on a single proc are handled locally, clusters extending
+   across procs are summed via their representative label
+------------------------------------------------------------------------- */
+
+void ComputeClusterAtomGran::calc_stats(std::vector<int> &labels, std::vector<int> &rep)
+{
+  int *mask = atom->mask;
+  double *rmass = atom->rmass;
+  int nlocal = atom->nlocal;
+  int nlabel = labels.size();
+
+  std::vector<double> count(nlocal,0.),mass(nlocal,0.);
+  std::vector<double> gcount(nlabel,0.),gmass(nlabel,0.);
+
+  double ngroup = 0., masstotal = 0.;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    int r = find(i);
+    count[r] += 1.;
+    mass[r] += rmass[i];
+    ngroup += 1.;
+    masstotal += rmass[i];
+  }
+
+  // roots of components with own atoms are own atoms as well
+  // since union-find always keeps the smallest index as root
+
+  double nclusters = 0., maxcount = 0., maxmass = 0.;
+
+  for (int r = 0; r < nlocal; r++) {
+    if (count[r] == 0.) continue;
+    int label = static_cast<int>(clusterID[r]);
+    std::vector<int>::iterator it = std::lower_bound(labels.begin(),labels.end(),label);
+    if (it != labels.end() && *it == label) {
+      int k = rep[it-labels.begin()];
+      gcount[k] += count[r];
+      gmass[k] += mass[r];
+    } else {
+      nclusters += 1.;
+      maxcount = MAX(maxcount,count[r]);
+      maxmass = MAX(maxmass,mass[r]);
+    }
+  }
+
+  if (nlabel > 0) {
+    std::vector<double> tmp(nlabel);
+    MPI_Allreduce(&gcount[0],&tmp[0],nlabel,MPI_DOUBLE,MPI_SUM,world);
+    gcount = tmp;
+    MPI_Allreduce(&gmass[0],&tmp[0],nlabel,MPI_DOUBLE,MPI_SUM,world);
+    gmass = tmp;
+  }
+
+  double all[3],local[3];
+  local[0] = nclusters;
+  local[1] = ngroup;
+  local[2] = masstotal;
+  MPI_Allreduce(local,all,3,MPI_DOUBLE,MPI_SUM,world);
+  nclusters = all[0];
+  ngroup = all[1];
+  masstotal = all[2];
+
+  local[0] = maxcount;
+  local[1] = maxmass;
+  MPI_Allreduce(local,all,2,MPI_DOUBLE,MPI_MAX,world);
+  maxcount = all[0];
+  maxmass = all[1];
+
+  for (int k = 0; k < nlabel; k++) {
+    if (rep[k] != k) continue;
+    nclusters += 1.;
+    maxcount = MAX(maxcount,gcount[k]);
+    maxmass = MAX(maxmass,gmass[k]);
+  }
+
+  stats[0] = nclusters;
+  stats[1] = maxcount;
+  stats[2] = nclusters > 0. ? ngroup/nclusters : 0.;
+  stats[3] = maxmass;
+  stats[4] = nclusters > 0. ? masstotal/nclusters : 0.;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeClusterAtomGran::compute_vector()
+{
+  invoked_vector = update->ntimestep;
+  if (invoked_peratom != update->ntimestep) compute_peratom();
+}
+
+/* ---------------------------------------------------------------------- */
+
+int ComputeClusterAtomGran::pack_comm(int n, int *list, double *buf,
+                                      int pbc_flag, int *pbc)
+{
+  int i,j,m;
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = clusterID[j];
+  }
+  return 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeClusterAtomGran::unpack_comm(int n, int first, double *buf)
+{
+  int i,m,last;
+
+  m = 0;
+  last = first + n;
+  for (i = first; i < last; i++) clusterID[i] = buf[m++];
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based arrays
+------------------------------------------------------------------------- */
+
+double ComputeClusterAtomGran::memory_usage()
+{
+  double bytes = nmax * sizeof(double);
+  bytes += nmax * sizeof(int);
+  return bytes;
+}
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef COMPUTE_CLASS
+
+ComputeStyle(cluster/atom/gran,ComputeClusterAtomGran)
+
+#else
+
+#ifndef LMP_COMPUTE_CLUSTER_ATOM_GRAN_H
+#define LMP_COMPUTE_CLUSTER_ATOM_GRAN_H
+
+#include "compute.h"
+#include <vector>
+
+namespace LAMMPS_NS {
+
+class ComputeClusterAtomGran : public Compute {
+ public:
+  ComputeClusterAtomGran(class LAMMPS *, int &iarg, int, char **);
+  ~ComputeClusterAtomGran();
+  void init();
+  void compute_peratom();
+  void compute_vector();
+  int pack_comm(int, int *, double *, int, int *);
+  void unpack_comm(int, int, double *);
+  double memory_usage();
+
+ private:
+  int nmax;
+  double skin;
+  class PairGran *pair_gran;
+  int history_flag;
+
+  // per-atom cluster ID, and union-find parent over local+ghost atoms
+  double *clusterID;
+  int *parent;
+
+  // cluster statistics
+  double stats[5];
+
+  inline int find(int i)
+  {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  }
+
+  void merge_global(std::vector<int> &edges, std::vector<int> &labels,
+                    std::vector<int> &rep);
+  void calc_stats(std::vector<int> &labels, std::vector<int> &rep);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Cannot use compute cluster/atom/gran unless atoms have IDs
+
+Atom IDs are used to identify clusters.
+
+E: Compute cluster/atom/gran requires a granular pair style
+
+Contacts are taken from the neighbor list of the granular pair style.
+
+*/
@@ -0,0 +1,709 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <cmath>
+#include <cstring>
+#include <stdlib.h>
+#include "compute_structure_long.h"
+#include "atom.h"
+#include "update.h"
+#include "force.h"
+#include "comm.h"
+#include "domain.h"
+#include "group.h"
+#include "math_const.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace MathConst;
+
+enum{COORD_NONE,COORD_CUTOFF,COORD_CONTACT};
+
+#define PSIZE 5        // x,y,z,radius,type per point
+#define NORDER 24      // re,im of S_4m (m = 0..4) and S_6m (m = 0..6)
+#define DELTA 10000
+
+/* ---------------------------------------------------------------------- */
+
+ComputeStructureLong::ComputeStructureLong(LAMMPS *lmp, int &iarg, int narg, char **arg) :
+  Compute(lmp, iarg, narg, arg),
+  ilo(NULL), ihi(NULL), jlo(NULL), jhi(NULL),
+  rdfpair(NULL), nrdfpair(NULL),
+  order_cut(0.0),
+  coord_style(COORD_NONE),
+  coord_value(0.0),
+  coord_max(20),
+  hist(NULL), histall(NULL),
+  icount(NULL), jcount(NULL), typecount(NULL),
+  coordhist(NULL),
+  cutghost(0.0),
+  npoint(0), nlocal_point(0), maxpoint(0),
+  point(NULL),
+  nbinx(0), nbiny(0), nbinz(0), maxcell(0),
+  cellhead(NULL), cellnext(NULL), maxnext(0),
+  maxsend(0), maxrecv(0),
+  sendbuf(NULL), recvbuf(NULL),
+  candidates(NULL), maxcand(0),
+  last_compute(-1)
+{
+  if (narg < iarg+2) error->compute_error(FLERR,this,"not enough arguments");
+
+  nbin = force->inumeric(FLERR,arg[iarg++]);
+  rmax = force->numeric(FLERR,arg[iarg++]);
+  if (nbin < 1) error->compute_error(FLERR,this,"Nbin must be > 0");
+  if (rmax <= 0.0) error->compute_error(FLERR,this,"Rmax must be > 0");
+
+  const int ntypes = atom->ntypes;
+  const int maxpairs = (narg-iarg)/3 + 1;
+  ilo = new int[maxpairs];
+  ihi = new int[maxpairs];
+  jlo = new int[maxpairs];
+  jhi = new int[maxpairs];
+  npairs = 0;
+
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"pair") == 0) {
+      if (narg < iarg+3) error->compute_error(FLERR,this,"not enough arguments for 'pair'");
+      force->bounds(arg[iarg+1],ntypes,ilo[npairs],ihi[npairs]);
+      force->bounds(arg[iarg+2],ntypes,jlo[npairs],jhi[npairs]);
+      if (ilo[npairs] > ihi[npairs] || jlo[npairs] > jhi[npairs])
+        error->compute_error(FLERR,this,"illegal type range for 'pair'");
+      npairs++;
+      iarg += 3;
+    } else if (strcmp(arg[iarg],"order") == 0) {
+      if (narg < iarg+2) error->compute_error(FLERR,this,"not enough arguments for 'order'");
+      order_cut = force->numeric(FLERR,arg[iarg+1]);
+      if (order_cut <= 0.0) error->compute_error(FLERR,this,"'order' cutoff must be > 0");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"coord") == 0) {
+      if (narg < iarg+3) error->compute_error(FLERR,this,"not enough arguments for 'coord'");
+      if (strcmp(arg[iarg+1],"cutoff") == 0) coord_style = COORD_CUTOFF;
+      else if (strcmp(arg[iarg+1],"contact") == 0) coord_style = COORD_CONTACT;
+      else error->compute_error(FLERR,this,"expecting 'cutoff' or 'contact' after 'coord'");
+      coord_value = force->numeric(FLERR,arg[iarg+2]);
+      if (coord_value <= 0.0) error->compute_error(FLERR,this,"'coord' value must be > 0");
+      iarg += 3;
+    } else if (strcmp(arg[iarg],"coord_max") == 0) {
+      if (narg < iarg+2) error->compute_error(FLERR,this,"not enough arguments for 'coord_max'");
+      coord_max = force->inumeric(FLERR,arg[iarg+1]);
+      if (coord_max < 1) error->compute_error(FLERR,this,"'coord_max' must be > 0");
+      iarg += 2;
+    } else error->compute_error(FLERR,this,"unknown keyword");
+  }
+
+  if (npairs == 0) {
+    ilo[0] = 1; ihi[0] = ntypes;
+    jlo[0] = 1; jhi[0] = ntypes;
+    npairs = 1;
+  }
+
+  if (coord_style == COORD_CONTACT && !atom->radius_flag)
+    error->compute_error(FLERR,this,"'coord contact' requires atom attribute radius");
+
+  array_flag = 1;
+  extarray = 0;
+  size_array_rows = nbin;
+  size_array_cols = 1 + 2*npairs;
+
+  // q4, q6, Q4, Q6, mean coordination, coordination histogram
+
+  vector_flag = 1;
+  extvector = 0;
+  size_vector = 5 + coord_max+1;
+
+  memory->create(rdfpair,npairs,ntypes+1,ntypes+1,"structure/long:rdfpair");
+  memory->create(nrdfpair,ntypes+1,ntypes+1,"structure/long:nrdfpair");
+
+  for (int i = 1; i <= ntypes; i++)
+    for (int j = 1; j <= ntypes; j++)
+      nrdfpair[i][j] = 0;
+
+  for (int m = 0; m < npairs; m++)
+    for (int i = ilo[m]; i <= ihi[m]; i++)
+      for (int j = jlo[m]; j <= jhi[m]; j++)
+        rdfpair[nrdfpair[i][j]++][i][j] = m;
+
+  delr = rmax / nbin;
+  delrinv = 1.0/delr;
+
+  memory->create(hist,npairs,nbin,"structure/long:hist");
+  memory->create(histall,npairs,nbin,"structure/long:histall");
+  memory->create(array,nbin,1+2*npairs,"structure/long:array");
+  vector = new double[size_vector];
+  coordhist = new double[coord_max+1];
+  typecount = new int[ntypes+1];
+  icount = new int[npairs];
+  jcount = new int[npairs];
+
+  for (int i = 0; i < nbin; i++)
+    array[i][0] = (i+0.5) * delr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+ComputeStructureLong::~ComputeStructureLong()
+{
+  memory->destroy(rdfpair);
+  memory->destroy(nrdfpair);
+  delete [] ilo;
+  delete [] ihi;
+  delete [] jlo;
+  delete [] jhi;
+  memory->destroy(hist);
+  memory->destroy(histall);
+  memory->destroy(array);
+  delete [] vector;
+  delete [] coordhist;
+  delete [] typecount;
+  delete [] icount;
+  delete [] jcount;
+
+  memory->destroy(point);
+  memory->destroy(cellhead);
+  memory->destroy(cellnext);
+  memory->destroy(sendbuf);
+  memory->destroy(recvbuf);
+  memory->destroy(candidates);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeStructureLong::init()
+{
+  if (domain->triclinic)
+    error->compute_error(FLERR,this,"does not support triclinic boxes");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeStructureLong::compute_array()
+{
+  invoked_array = update->ntimestep;
+  if (last_compute != update->ntimestep) analyse();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeStructureLong::compute_vector()
+{
+  invoked_vector = update->ntimestep;
+  if (last_compute != update->ntimestep) analyse();
+}
+
+/* ----------------------------------------------------------------------
+   RDF, bond-orientational order and coordination of the group
+   uses its own ghost images up to cutghost, so the production
+   neighbor list and ghost cutoff are not touched
+------------------------------------------------------------------------- */
+
+void ComputeStructureLong::analyse()
+{
+  last_compute = update->ntimestep;
+
+  // interaction cutoff of this analysis
+
+  double cut_coord = 0.0;
+  if (coord_style == COORD_CUTOFF) cut_coord = coord_value;
+  else if (coord_style == COORD_CONTACT) {
+    double maxrad = 0.0, maxrad_all;
+    double *radius = atom->radius;
+    int *mask = atom->mask;
+    const int nlocal = atom->nlocal;
+    for (int i = 0; i < nlocal; i++)
+      if ((mask[i] & groupbit) && radius[i] > maxrad) maxrad = radius[i];
+    MPI_Allreduce(&maxrad,&maxrad_all,1,MPI_DOUBLE,MPI_MAX,world);
+    cut_coord = 2.*maxrad_all*coord_value;
+  }
+
+  cutghost = rmax;
+  if (order_cut > cutghost) cutghost = order_cut;
+  if (cut_coord > cutghost) cutghost = cut_coord;
+
+  collect_points();
+  exchange_ghosts();
+  build_cells();
+
+  const int ntypes = atom->ntypes;
+  const double rmaxsq = rmax*rmax;
+  const double ordersq = order_cut*order_cut;
+  const double coordsq = coord_value*coord_value;
+
+  for (int m = 0; m < npairs; m++)
+    for (int ibin = 0; ibin < nbin; ibin++)
+      hist[m][ibin] = 0.0;
+  for (int k = 0; k <= coord_max; k++)
+    coordhist[k] = 0.0;
+  for (int itype = 1; itype <= ntypes; itype++)
+    typecount[itype] = 0;
+
+  // per-proc sums, reduced in one call:
+  // q4 sum, q6 sum, # atoms with bonds, coordination sum, # bonds,
+  // S_lm summed over all bonds, coordination histogram
+
+  const int nsum = 5 + NORDER + coord_max+1;
+  double *sum = new double[nsum];
+  double *sumall = new double[nsum];
+  for (int k = 0; k < nsum; k++) sum[k] = 0.0;
+  double *Sglobal = &sum[5];
+  double qlm[NORDER];
+
+  for (int i = 0; i < nlocal_point; i++) {
+    const double *pi = &point[PSIZE*i];
+    const int itype = static_cast<int>(pi[4]);
+    typecount[itype]++;
+
+    for (int k = 0; k < NORDER; k++) qlm[k] = 0.0;
+    int nbond = 0;
+    int ncoord = 0;
+
+    int ix = static_cast<int>((pi[0]-cell_lo[0])*cellinv[0]);
+    int iy = static_cast<int>((pi[1]-cell_lo[1])*cellinv[1]);
+    int iz = static_cast<int>((pi[2]-cell_lo[2])*cellinv[2]);
+    if (ix >= nbinx) ix = nbinx-1;
+    if (iy >= nbiny) iy = nbiny-1;
+    if (iz >= nbinz) iz = nbinz-1;
+
+    for (int cz = iz-1; cz <= iz+1; cz++) {
+      if (cz < 0 || cz >= nbinz) continue;
+      for (int cy = iy-1; cy <= iy+1; cy++) {
+        if (cy < 0 || cy >= nbiny) continue;
+        for (int cx = ix-1; cx <= ix+1; cx++) {
+          if (cx < 0 || cx >= nbinx) continue;
+
+          for (int j = cellhead[(cz*nbiny+cy)*nbinx+cx]; j >= 0; j = cellnext[j]) {
+            if (j == i) continue;
+            const double *pj = &point[PSIZE*j];
+            const double delx = pj[0] - pi[0];
+            const double dely = pj[1] - pi[1];
+            const double delz = pj[2] - pi[2];
+            const double rsq = delx*delx + dely*dely + delz*delz;
+            if (rsq > cutghost*cutghost || rsq == 0.0) continue;
+
+            if (rsq < rmaxsq) {
+              const int jtype = static_cast<int>(pj[4]);
+              const int ipair = nrdfpair[itype][jtype];
+              if (ipair) {
+                const int ibin = static_cast<int>(sqrt(rsq)*delrinv);
+                if (ibin < nbin)
+                  for (int ihisto = 0; ihisto < ipair; ihisto++)
+                    hist[rdfpair[ihisto][itype][jtype]][ibin] += 1.0;
+              }
+            }
+
+            if (rsq < ordersq) {
+              tally_order(delx,dely,delz,qlm);
+              nbond++;
+            }
+
+            if (coord_style == COORD_CUTOFF) {
+              if (rsq < coordsq) ncoord++;
+            } else if (coord_style == COORD_CONTACT) {
+              const double cut = coord_value*(pi[3]+pj[3]);
+              if (rsq < cut*cut) ncoord++;
+            }
+          }
+        }
+      }
+    }
+
+    if (nbond > 0) {
+      sum[0] += sqrt(order_param(4,qlm)) / nbond;
+      sum[1] += sqrt(order_param(6,&qlm[10])) / nbond;
+      sum[2] += 1.0;
+      for (int k = 0; k < NORDER; k++) Sglobal[k] += qlm[k];
+    }
+    sum[3] += ncoord;
+    sum[4] += nbond;
+    sum[5+NORDER + (ncoord < coord_max ? ncoord : coord_max)] += 1.0;
+  }
+
+  MPI_Allreduce(hist[0],histall[0],npairs*nbin,MPI_DOUBLE,MPI_SUM,world);
+  MPI_Allreduce(sum,sumall,nsum,MPI_DOUBLE,MPI_SUM,world);
+
+  // icount = # of I atoms participating in I,J pairs for each histogram
+  // jcount = # of J atoms participating in I,J pairs for each histogram
+
+  for (int m = 0; m < npairs; m++) {
+    icount[m] = 0;
+    for (int itype = ilo[m]; itype <= ihi[m]; itype++) icount[m] += typecount[itype];
+    jcount[m] = 0;
+    for (int jtype = jlo[m]; jtype <= jhi[m]; jtype++) jcount[m] += typecount[jtype];
+  }
+
+  int *scratch = new int[npairs];
+  MPI_Allreduce(icount,scratch,npairs,MPI_INT,MPI_SUM,world);
+  for (int m = 0; m < npairs; m++) icount[m] = scratch[m];
+  MPI_Allreduce(jcount,scratch,npairs,MPI_INT,MPI_SUM,world);
+  for (int m = 0; m < npairs; m++) jcount[m] = scratch[m];
+  delete [] scratch;
+
+  // convert counts to g(r) and coord(r) as compute rdf does
+  // nideal = # of J atoms surrounding single I atom in a single bin
+  //   assuming J atoms are at uniform density
+
+  double constant;
+  if (domain->dimension == 3)
+    constant = 4.0*MY_PI / (3.0*domain->xprd*domain->yprd*domain->zprd);
+  else
+    constant = MY_PI / (domain->xprd*domain->yprd);
+
+  for (int m = 0; m < npairs; m++) {
+    double ncoord = 0.0;
+    for (int ibin = 0; ibin < nbin; ibin++) {
+      const double rlower = ibin*delr;
+      const double rupper = (ibin+1)*delr;
+      double nideal;
+      if (domain->dimension == 3)
+        nideal = constant * (rupper*rupper*rupper - rlower*rlower*rlower) * jcount[m];
+      else
+        nideal = constant * (rupper*rupper - rlower*rlower) * jcount[m];
+      double gr = 0.0;
+      if (icount[m]*nideal != 0.0)
+        gr = histall[m][ibin] / (icount[m]*nideal);
+      ncoord += gr*nideal;
+      array[ibin][1+2*m] = gr;
+      array[ibin][2+2*m] = ncoord;
+    }
+  }
+
+  // order parameters and coordination
+
+  const double ngroup = group->count(igroup);
+  const double nbondall = sumall[4];
+
+  vector[0] = sumall[2] > 0.0 ? sumall[0]/sumall[2] : 0.0;
+  vector[1] = sumall[2] > 0.0 ? sumall[1]/sumall[2] : 0.0;
+  vector[2] = nbondall > 0.0 ? sqrt(order_param(4,&sumall[5])) / nbondall : 0.0;
+  vector[3] = nbondall > 0.0 ? sqrt(order_param(6,&sumall[15])) / nbondall : 0.0;
+  vector[4] = ngroup > 0.0 ? sumall[3]/ngroup : 0.0;
+  for (int k = 0; k <= coord_max; k++)
+    vector[5+k] = ngroup > 0.0 ? sumall[5+NORDER+k]/ngroup : 0.0;
+
+  delete [] sum;
+  delete [] sumall;
+}
+
+/* ----------------------------------------------------------------------
+   owned atoms of the group
+------------------------------------------------------------------------- */
+
+void ComputeStructureLong::collect_points()
+{
+  double **x = atom->x;
+  double *radius = atom->radius;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+
+  npoint = 0;
+  grow_points(nlocal);
+
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    double *p = &point[PSIZE*npoint];
+    p[0] = x[i][0];
+    p[1] = x[i][1];
+    p[2] = x[i][2];
+    p[3] = radius ? radius[i] : 0.0;
+    p[4] = type[i];
+    npoint++;
+  }
+
+  nlocal_point = npoint;
+}
+
+/* ----------------------------------------------------------------------
+   ghost images of all points within cutghost of the sub-domain
+   dimension by dimension as in Comm::borders(), but forwarding the
+   received images hop by hop until no proc receives any more, so
+   cutghost may exceed the extent of several sub-domains or the box
+------------------------------------------------------------------------- */
+
+void ComputeStructureLong::exchange_ghosts()
+{
+  const int ndim = domain->dimension == 3 ? 3 : 2;
+
+  for (int dim = 0; dim < ndim; dim++) {
+    if (comm->procgrid[dim] == 1 && !domain->periodicity[dim]) continue;
+
+    // images received in one direction are not sent back in the other
+
+    const int nfirst = npoint;
+    exchange_dim(dim,0,0,nfirst);
+    exchange_dim(dim,1,0,nfirst);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   dir = 0: send to lower neighbor, dir = 1: send to upper neighbor
+   candidates of the first hop are points [ifirst,ilast)
+------------------------------------------------------------------------- */
+
+int ComputeStructureLong::exchange_dim(int dim, int dir, int ifirst, int ilast)
+{
+  const int me = comm->me;
+  const int sendproc = comm->procneigh[dim][dir];
+  const int recvproc = comm->procneigh[dim][1-dir];
+  const bool at_boundary = dir == 0 ? (comm->myloc[dim] == 0) : (comm->myloc[dim] == comm->procgrid[dim]-1);
+  const bool blocked = at_boundary && !domain->periodicity[dim];
+  const double shift = at_boundary ? (dir == 0 ? domain->prd[dim] : -domain->prd[dim]) : 0.0;
+  const double bound = dir == 0 ? domain->sublo[dim] + cutghost : domain->subhi[dim] - cutghost;
+
+  int ntotal = 0;
+
+  while (true) {
+
+    // select and pack
+
+    int nsend = 0;
+    if (!blocked) {
+      for (int i = ifirst; i < ilast; i++) {
+        const double xd = point[PSIZE*i+dim];
+        if ((dir == 0 && xd < bound) || (dir == 1 && xd >= bound)) {
+          if (nsend == maxcand) {
+            maxcand += DELTA;
+            memory->grow(candidates,maxcand,"structure/long:candidates");
+          }
+          candidates[nsend++] = i;
+        }
+      }
+    }
+
+    if (PSIZE*nsend > maxsend) {
+      maxsend = PSIZE*nsend;
+      memory->destroy(sendbuf);
+      memory->create(sendbuf,maxsend,"structure/long:sendbuf");
+    }
+    for (int k = 0; k < nsend; k++) {
+      const double *p = &point[PSIZE*candidates[k]];
+      double *buf = &sendbuf[PSIZE*k];
+      for (int n = 0; n < PSIZE; n++) buf[n] = p[n];
+      buf[dim] += shift;
+    }
+
+    // exchange
+
+    int nrecv;
+    double *buf;
+    if (sendproc == me) {
+      nrecv = nsend;
+      buf = sendbuf;
+    } else {
+      MPI_Sendrecv(&nsend,1,MPI_INT,sendproc,0,&nrecv,1,MPI_INT,recvproc,0,world,MPI_STATUS_IGNORE);
+      if (PSIZE*nrecv > maxrecv) {
+        maxrecv = PSIZE*nrecv;
+        memory->destroy(recvbuf);
+        memory->create(recvbuf,maxrecv,"structure/long:recvbuf");
+      }
+      MPI_Sendrecv(sendbuf,PSIZE*nsend,MPI_DOUBLE,sendproc,0,
+                   recvbuf,PSIZE*nrecv,MPI_DOUBLE,recvproc,0,world,MPI_STATUS_IGNORE);
+      buf = recvbuf;
+    }
+
+    // append, received images are the candidates of the next hop
+
+    grow_points(npoint+nrecv);
+    memcpy(&point[PSIZE*npoint],buf,PSIZE*nrecv*sizeof(double));
+    ifirst = npoint;
+    npoint += nrecv;
+    ilast = npoint;
+    ntotal += nrecv;
+
+    int nrecv_max;
+    MPI_Allreduce(&nrecv,&nrecv_max,1,MPI_INT,MPI_MAX,world);
+    if (nrecv_max == 0) break;
+  }
+
+  return ntotal;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeStructureLong::grow_points(int n)
+{
+  if (n <= maxpoint) return;
+  maxpoint = n + DELTA;
+  memory->grow(point,PSIZE*maxpoint,"structure/long:point");
+}
+
+/* ----------------------------------------------------------------------
+   linked cell list over all points, cells are at least cutghost wide
+------------------------------------------------------------------------- */
+
+void ComputeStructureLong::build_cells()
+{
+  double lo[3],hi[3];
+  lo[0] = lo[1] = lo[2] = 0.0;
+  hi[0] = hi[1] = hi[2] = 0.0;
+
+  for (int i = 0; i < npoint; i++) {
+    const double *p = &point[PSIZE*i];
+    for (int d = 0; d < 3; d++) {
+      if (i == 0 || p[d] < lo[d]) lo[d] = p[d];
+      if (i == 0 || p[d] > hi[d]) hi[d] = p[d];
+    }
+  }
+
+  // limit the # of cells to a few per point
+
+  double cellsize = cutghost;
+  double ncell = 1.0;
+  for (int d = 0; d < 3; d++)
+    ncell *= (hi[d]-lo[d])/cellsize + 1.0;
+  const double ncellmax = 4.0*npoint + 1000.0;
+  if (ncell > ncellmax) cellsize *= cbrt(ncell/ncellmax);
+
+  int n[3];
+  for (int d = 0; d < 3; d++) {
+    n[d] = static_cast<int>((hi[d]-lo[d])/cellsize);
+    if (n[d] < 1) n[d] = 1;
+    cell_lo[d] = lo[d];
+    cellinv[d] = hi[d] > lo[d] ? n[d]/(hi[d]-lo[d]) : 0.0;
+  }
+  nbinx = n[0];
+  nbiny = n[1];
+  nbinz = n[2];
+
+  const int ncells = nbinx*nbiny*nbinz;
+  if (ncells > maxcell) {
+    maxcell = ncells;
+    memory->destroy(cellhead);
+    memory->create(cellhead,maxcell,"structure/long:cellhead");
+  }
+  if (npoint > maxnext) {
+    maxnext = maxpoint;
+    memory->destroy(cellnext);
+    memory->create(cellnext,maxnext,"structure/long:cellnext");
+  }
+
+  for (int c = 0; c < ncells; c++) cellhead[c] = -1;
+
+  // reverse order so each cell lists its points in ascending order
+
+  for (int i = npoint-1; i >= 0; i--) {
+    const double *p = &point[PSIZE*i];
+    int ix = static_cast<int>((p[0]-cell_lo[0])*cellinv[0]);
+    int iy = static_cast<int>((p[1]-cell_lo[1])*cellinv[1]);
+    int iz = static_cast<int>((p[2]-cell_lo[2])*cellinv[2]);
+    if (ix >= nbinx) ix = nbinx-1;
+    if (iy >= nbiny) iy = nbiny-1;
+    if (iz >= nbinz) iz = nbinz-1;
+    const int c = (iz*nbiny+iy)*nbinx+ix;
+    cellnext[i] = cellhead[c];
+    cellhead[c] = i;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add P_l^m(cos theta) e^(i m phi) of one bond to q, l = 4, 6, m >= 0
+   normalization of the spherical harmonics is applied in order_param()
+------------------------------------------------------------------------- */
+
+void ComputeStructureLong::tally_order(double delx, double dely, double delz, double *q)
+{
+  const double r = sqrt(delx*delx + dely*dely + delz*delz);
+  const double rxy = sqrt(delx*delx + dely*dely);
+  const double ct = delz/r;
+  const double st = rxy/r;
+  const double cphi = rxy > 0.0 ? delx/rxy : 1.0;
+  const double sphi = rxy > 0.0 ? dely/rxy : 0.0;
+
+  // associated Legendre functions P[l][m] up to l = 6
+
+  double P[7][7];
+  double pmm = 1.0;
+  for (int m = 0; m <= 6; m++) {
+    if (m > 0) pmm *= (2*m-1)*st;
+    P[m][m] = pmm;
+    if (m < 6) P[m+1][m] = ct*(2*m+1)*pmm;
+    for (int l = m+2; l <= 6; l++)
+      P[l][m] = ((2*l-1)*ct*P[l-1][m] - (l+m-1)*P[l-2][m]) / (l-m);
+  }
+
+  // e^(i m phi) by recurrence
+
+  double cm = 1.0, sm = 0.0;
+  for (int m = 0; m <= 6; m++) {
+    if (m <= 4) {
+      q[2*m]   += P[4][m]*cm;
+      q[2*m+1] += P[4][m]*sm;
+    }
+    q[10+2*m]   += P[6][m]*cm;
+    q[10+2*m+1] += P[6][m]*sm;
+
+    const double c = cm*cphi - sm*sphi;
+    sm = sm*cphi + cm*sphi;
+    cm = c;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   N^2 q_l^2 = 4 pi/(2l+1) sum_m |sum_bonds Y_lm|^2 for N bonds,
+   from S_lm = sum_bonds P_l^m e^(i m phi)
+   terms with m < 0 equal those with m > 0 in magnitude
+------------------------------------------------------------------------- */
+
+double ComputeStructureLong::order_param(int l, double *S)
+{
+  double sum = 0.0;
+  double ratio = 1.0;     // (l-m)!/(l+m)!
+
+  for (int m = 0; m <= l; m++) {
+    if (m > 0) ratio /= (double)(l-m+1)*(l+m);
+    const double w = m == 0 ? 1.0 : 2.0;
+    sum += w*ratio*(S[2*m]*S[2*m] + S[2*m+1]*S[2*m+1]);
+  }
+
+  return sum;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double ComputeStructureLong::memory_usage()
+{
+  double bytes = 2.*npairs*nbin*sizeof(double);
+  bytes += PSIZE*maxpoint*sizeof(double);
+  bytes += (maxcell+maxnext+maxcand)*sizeof(int);
+  bytes += (maxsend+maxrecv)*sizeof(double);
+  return bytes;
+}
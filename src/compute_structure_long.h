@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef COMPUTE_CLASS
+
+ComputeStyle(structure/long,ComputeStructureLong)
+
+#else
+
+#ifndef LMP_COMPUTE_STRUCTURE_LONG_H
+#define LMP_COMPUTE_STRUCTURE_LONG_H
+
+#include "compute.h"
+
+namespace LAMMPS_NS {
+
+class ComputeStructureLong : public Compute {
+ public:
+  ComputeStructureLong(class LAMMPS *, int &iarg, int, char **);
+  ~ComputeStructureLong();
+  void init();
+  void compute_array();
+  void compute_vector();
+  double memory_usage();
+
+ private:
+
+  // analysis settings
+
+  int nbin;                       // # of rdf bins
+  double rmax;                    // rdf range
+  double delr,delrinv;            // bin width and its inverse
+  int npairs;                     // # of rdf histograms
+  int *ilo,*ihi,*jlo,*jhi;
+  int ***rdfpair;                 // map type pair to histogram
+  int **nrdfpair;                 // # of histograms for each type pair
+
+  double order_cut;               // neighbor cutoff for q4, q6; 0 = off
+  int coord_style;                // COORD_NONE, COORD_CUTOFF, COORD_CONTACT
+  double coord_value;             // cutoff or contact factor
+  int coord_max;                  // last bin of coordination histogram
+
+  // results
+
+  double **hist,**histall;
+  int *icount,*jcount;
+  int *typecount;
+  double *coordhist;
+
+  // analysis-only point set: owned atoms of the group followed by
+  // ghost images within cutghost, exchanged on demand only
+
+  double cutghost;
+  int npoint,nlocal_point,maxpoint;
+  double *point;                  // x,y,z,radius,type per point
+
+  // cell list over the point set
+
+  int nbinx,nbiny,nbinz,maxcell;
+  double cell_lo[3],cellinv[3];
+  int *cellhead,*cellnext;
+  int maxnext;
+
+  // send/recv buffers of the ghost exchange
+
+  int maxsend,maxrecv;
+  double *sendbuf,*recvbuf;
+  int *candidates;
+  int maxcand;
+
+  bigint last_compute;
+
+  void analyse();
+  void collect_points();
+  void exchange_ghosts();
+  int exchange_dim(int, int, int, int);
+  void grow_points(int);
+  void build_cells();
+  void tally_order(double, double, double, double *);
+  double order_param(int, double *);
+};
+
+}
+
+#endif
+#endif
@@ -109,6 +109,9 @@ namespace LAMMPS_NS
     // return status of checkBorderElement{Left,Right} in multi_node_mesh_parallel
     // also enables container properties to be wrapped around periodic boundaries
     // e.g. node positions of triangles
+    // IS_GHOST_WRAP_ROT_* wrap around the periodic faces of a wedge domain,
+    // for these dlo is a point on the wedge axis and dhi holds
+    // (cos, sin) of the wedge angle and the index of the first in-plane dim
     enum
     {
         NOT_GHOST               = 0,
@@ -118,7 +121,9 @@ namespace LAMMPS_NS
         IS_GHOST_WRAP_DIM_1_NEG = 1<<3,
         IS_GHOST_WRAP_DIM_1_POS = 1<<4,
         IS_GHOST_WRAP_DIM_2_NEG = 1<<5,
-        IS_GHOST_WRAP_DIM_2_POS = 1<<6
+        IS_GHOST_WRAP_DIM_2_POS = 1<<6,
+        IS_GHOST_WRAP_ROT_NEG   = 1<<7,
+        IS_GHOST_WRAP_ROT_POS   = 1<<8
     };
 
   /* ----------------------------------------------------------------------
@@ -231,7 +236,7 @@ namespace LAMMPS_NS
                            bool scale=false,bool translate=false, bool rotate=false) = 0;
           virtual int pushElemListToBufferReverse(int first, int n, double *buf, int operation,
                            bool scale=false,bool translate=false, bool rotate=false) = 0;
-          virtual int popElemListFromBufferReverse(int n, int *list, double *buf, int operation,
+          virtual int popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, double *dlo, double *dhi,
                            bool scale=false,bool translate=false, bool rotate=false) = 0;
 
           virtual int elemBufSize(int operation = OPERATION_UNDEFINED,
@@ -260,6 +265,9 @@ namespace LAMMPS_NS
 
           inline bool decideCreateNewElements(int operation);
 
+          static inline void wrapRotate(double *v, const int wrap, const double *dlo, const double *dhi,
+                                        const bool point, const bool inverse);
+
           char *id_;
           int communicationType_;
           int refFrame_;
@@ -150,6 +150,29 @@
       return false;
   }
 
+  /* ----------------------------------------------------------------------
+   rotate a 3-vector for a ghost wrapped around the periodic faces of a
+   wedge domain, point = rotate around the axis through dlo
+   inverse is used to map reverse communicated values back
+  ------------------------------------------------------------------------- */
+
+  inline void ContainerBase::wrapRotate(double *v, const int wrap, const double *dlo, const double *dhi,
+                                        const bool point, const bool inverse)
+  {
+      int sign = (wrap == IS_GHOST_WRAP_ROT_POS) ? 1 : -1;
+      if(inverse) sign = -sign;
+
+      const int ia = static_cast<int>(dhi[2]);
+      const int ib = (ia+1)%3;
+      const double c = dhi[0];
+      const double s = sign*dhi[1];
+      const double va = point ? v[ia]-dlo[ia] : v[ia];
+      const double vb = point ? v[ib]-dlo[ib] : v[ib];
+
+      v[ia] = c*va - s*vb + (point ? dlo[ia] : 0.);
+      v[ib] = s*va + c*vb + (point ? dlo[ib] : 0.);
+  }
+
   /* ----------------------------------------------------------------------
    fast test for reference frame
    note that rotation is only carried out for LEN_VEC==3
@@ -421,9 +421,9 @@ T* CustomValueTracker::addElementProperty(const char *_id,
     return elementProperties_.pushElemListToBufferReverse(first,n,buf,operation, properties, scale,translate,rotate);
   }
 
-  int CustomValueTracker::popElemListFromBufferReverse(int n, int *list, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate)
+  int CustomValueTracker::popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> * properties, double *dlo, double *dhi, bool scale,bool translate, bool rotate)
   {
-    return elementProperties_.popElemListFromBufferReverse(n,list,buf,operation, properties, scale,translate,rotate);
+    return elementProperties_.popElemListFromBufferReverse(n,list,wraplist,buf,operation, properties, dlo, dhi, scale,translate,rotate);
   }
 
   /* ----------------------------------------------------------------------
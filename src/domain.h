@@ -201,6 +201,7 @@ class Domain : protected Pointers {
   virtual int is_in_subdomain_wedge(double* pos) { UNUSED(pos); return 0; } 
   virtual int is_in_extended_subdomain_wedge(double* pos) { UNUSED(pos); return 0; } 
   virtual double dist_subbox_borders_wedge(double* pos) { UNUSED(pos); return 0.; } 
+  virtual void min_subbox_extent_wedge(double &min_extent,int &dim) { min_extent = 0.; dim = 0; }
   virtual int is_periodic_ghost_wedge(int i) { UNUSED(i); return 0;} 
 
  private:
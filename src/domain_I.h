@@ -150,7 +150,10 @@ inline double Domain::dist_subbox_borders(double* pos)
 inline void Domain::min_subbox_extent(double &min_extent,int &dim) 
 {
     if(is_wedge)
-        error->one(FLERR,"missing implementation");
+    {
+        min_subbox_extent_wedge(min_extent,dim);
+        return;
+    }
 
     double delta[3];
     vectorSubtract3D(subhi,sublo,delta);
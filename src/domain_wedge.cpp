@@ -0,0 +1,282 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+
+    Christoph Kloss (DCS Computing GmbH, Linz)
+    Christoph Kloss (JKU Linz)
+    Stefan Amberger (JKU Linz)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include "domain_wedge.h"
+#include "region_wedge.h"
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "modify.h"
+#include "neighbor.h"
+#include "fix_contact_history.h"
+#include "fix_wall_gran.h"
+#include "math_extra_liggghts.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+DomainWedge::DomainWedge(LAMMPS *lmp) :
+  Domain(lmp),
+  iaxis_(2),
+  iphi_(0),
+  iperp_(1),
+  radius_(0.),
+  dang_(0.),
+  cosdang_(1.),
+  sindang_(0.)
+{
+  c_[0] = c_[1] = 0.;
+  n1_[0] = n1_[1] = 0.;
+  n2_[0] = n2_[1] = 0.;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DomainWedge::init()
+{
+  Domain::init();
+
+  // ghost particles across the periodic faces are rotated copies,
+  // forces on them cannot be reverse communicated
+
+  if (force->newton_pair)
+    error->all(FLERR,"Domain wedge requires 'newton off'");
+  if (!atom->sphere_flag)
+    error->all(FLERR,"Domain wedge requires atom style sphere");
+  if (deform_flag)
+    error->all(FLERR,"Domain wedge can not be used together with fix deform");
+
+  // contact histories have to be rotated along with the particles
+
+  fix_history_.clear();
+  fix_wall_.clear();
+  for (int i = 0; i < modify->nfix; i++)
+  {
+    FixContactHistory *fch = dynamic_cast<FixContactHistory*>(modify->fix[i]);
+    if (fch) fix_history_.push_back(fch);
+    FixWallGran *fwg = dynamic_cast<FixWallGran*>(modify->fix[i]);
+    if (fwg && !fwg->is_mesh_wall()) fix_wall_.push_back(fwg);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set box and wedge geometry from region wedge, called by create_box
+------------------------------------------------------------------------- */
+
+void DomainWedge::set_domain(RegWedge *rw)
+{
+  iaxis_ = rw->axis - 'x';
+  iphi_ = (iaxis_+1)%3;
+  iperp_ = (iaxis_+2)%3;
+
+  c_[0] = rw->c1;
+  c_[1] = rw->c2;
+  radius_ = rw->radius;
+  dang_ = rw->dang;
+  cosdang_ = rw->cosdang;
+  sindang_ = rw->sindang;
+  vectorCopy2D(rw->normal1,n1_);
+  vectorCopy2D(rw->normal2,n2_);
+
+  if (dang_ > M_PI - 1e-8)
+    error->all(FLERR,"Domain wedge requires a wedge angle < 180 degrees");
+
+  double nsector = 2.*M_PI/dang_;
+  if (comm->me == 0 && fabs(nsector - floor(nsector+0.5)) > 1e-6)
+    error->warning(FLERR,"Wedge angle does not divide 360 degrees, the periodic wedge "
+                         "does not represent a full revolution");
+
+  // wedge faces are periodic by rotation, handled by DomainWedge and Comm
+  // the two in-plane directions have to be bounded by fixed boundaries
+
+  if (boundary[iphi_][0] != 1 || boundary[iphi_][1] != 1 ||
+      boundary[iperp_][0] != 1 || boundary[iperp_][1] != 1)
+    error->all(FLERR,"Domain wedge requires fixed boundaries ('f') perpendicular to the wedge axis");
+
+  // angular direction is periodic and can not be decomposed
+
+  if (comm->user_procgrid[iphi_] > 1 || comm->user_procgrid[iperp_] > 1)
+    error->all(FLERR,"Domain wedge can only be decomposed along the wedge axis, "
+                     "use the processors command accordingly");
+  comm->user_procgrid[iphi_] = comm->user_procgrid[iperp_] = 1;
+
+  // periodicity[iphi_] only makes Comm swap ghosts along iphi_, which are
+  // rotated by the atom vec, xperiodic etc. stay as set by the boundary
+  // command so Domain::remap() and minimum_image() never shift by a box length
+
+  periodicity[iphi_] = 1;
+
+  triclinic = 0;
+  boxlo[0] = rw->extent_xlo;
+  boxhi[0] = rw->extent_xhi;
+  boxlo[1] = rw->extent_ylo;
+  boxhi[1] = rw->extent_yhi;
+  boxlo[2] = rw->extent_zlo;
+  boxhi[2] = rw->extent_zhi;
+}
+
+/* ----------------------------------------------------------------------
+   map owned particles that left through an angular face back into the
+   wedge by rotation, then apply regular pbc along the axis
+   position, velocity, angular velocity and contact histories are rotated
+------------------------------------------------------------------------- */
+
+void DomainWedge::pbc()
+{
+  double **x = atom->x;
+  double **v = atom->v;
+  double **omega = atom->omega;
+  const int nlocal = atom->nlocal;
+  const int nhist = fix_history_.size();
+  const int nwall = fix_wall_.size();
+
+  for (int i = 0; i < nlocal; i++)
+  {
+    int sign = 0;
+    if (dist_face2(x[i]) > 0.) sign = -1;
+    else if (dist_face1(x[i]) > 0.) sign = 1;
+    else continue;
+
+    rotate_point(x[i],sign);
+    rotate_vector(v[i],sign);
+    if (omega) rotate_vector(omega[i],sign);
+
+    for (int ih = 0; ih < nhist; ih++)
+      fix_history_[ih]->rotate_history(i,this,sign);
+    for (int iw = 0; iw < nwall; iw++)
+      fix_wall_[iw]->rotate_history(i,this,sign);
+  }
+
+  Domain::pbc();
+}
+
+/* ----------------------------------------------------------------------
+   check if coordinate in domain, subdomain or extended subdomain
+   subdomains are slabs of the wedge along the axis
+------------------------------------------------------------------------- */
+
+int DomainWedge::is_in_domain_wedge(double* pos)
+{
+  if (pos[iaxis_] < boxlo[iaxis_] || pos[iaxis_] > boxhi[iaxis_])
+    return 0;
+  if (dist_face1(pos) > 0. || dist_face2(pos) > 0.)
+    return 0;
+
+  const double da = pos[iphi_]-c_[0], db = pos[iperp_]-c_[1];
+  if (da*da + db*db > radius_*radius_)
+    return 0;
+  return 1;
+}
+
+int DomainWedge::is_in_subdomain_wedge(double* pos)
+{
+  const double lo = sublo[iaxis_] -
+      (MathExtraLiggghts::compDouble(sublo[iaxis_], boxlo[iaxis_]) ? SMALL_DMBRDR : 0.0);
+  const double hi = subhi[iaxis_] +
+      (MathExtraLiggghts::compDouble(subhi[iaxis_], boxhi[iaxis_]) ? SMALL_DMBRDR : 0.0);
+
+  if (pos[iaxis_] < lo || pos[iaxis_] >= hi)
+    return 0;
+  if (dist_face1(pos) > 0. || dist_face2(pos) > 0.)
+    return 0;
+  return 1;
+}
+
+int DomainWedge::is_in_extended_subdomain_wedge(double* pos)
+{
+  if (is_in_subdomain_wedge(pos))
+    return 1;
+  if (dist_face1(pos) > 0. || dist_face2(pos) > 0.)
+    return 0;
+
+  const int ia = iaxis_;
+  if (comm->procgrid[ia] == 1)
+    return 1;
+  if (comm->myloc[ia] == comm->procgrid[ia]-1)
+    return pos[ia] >= sublo[ia];
+  if (comm->myloc[ia] == 0)
+    return pos[ia] <= subhi[ia];
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   distance from subdomain borders, including the periodic faces
+------------------------------------------------------------------------- */
+
+double DomainWedge::dist_subbox_borders_wedge(double* pos)
+{
+  return MathExtraLiggghts::min(fabs(dist_face1(pos)),fabs(dist_face2(pos)),
+                                fabs(pos[iaxis_]-sublo[iaxis_]),fabs(subhi[iaxis_]-pos[iaxis_]));
+}
+
+/* ----------------------------------------------------------------------
+   subdomains are only split along the axis
+------------------------------------------------------------------------- */
+
+void DomainWedge::min_subbox_extent_wedge(double &min_extent,int &dim)
+{
+  dim = iaxis_;
+  min_extent = subhi[iaxis_] - sublo[iaxis_];
+}
+
+/* ----------------------------------------------------------------------
+   ghost close to one of the periodic faces or periodic axis ends
+------------------------------------------------------------------------- */
+
+int DomainWedge::is_periodic_ghost_wedge(int i)
+{
+  const double *x = atom->x[i];
+  const double cutneighmax = neighbor->cutneighmax;
+
+  if (dist_face1(x) > -cutneighmax || dist_face2(x) > -cutneighmax)
+    return 1;
+
+  if (periodicity[iaxis_] &&
+      (x[iaxis_] < boxlo[iaxis_]+cutneighmax || x[iaxis_] > boxhi[iaxis_]-cutneighmax))
+    return 1;
+
+  return 0;
+}
@@ -1 +1,139 @@
-#include "domain_wedge_dummy.h"
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+
+    Christoph Kloss (DCS Computing GmbH, Linz)
+    Christoph Kloss (JKU Linz)
+    Stefan Amberger (JKU Linz)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifndef DOMAIN_WEDGE_H
+#define DOMAIN_WEDGE_H
+
+#include "domain.h"
+#include <vector>
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   simulation domain that is a periodic sector (wedge) of a cylinder
+   the two angular faces of the wedge are periodic images of each other,
+   rotated by the wedge angle around the wedge axis
+   in-plane coordinates (a,b) are (x[iphi],x[(iphi+1)%3]) with
+   iphi = (iaxis+1)%3, consistent with region wedge
+   decomposition is allowed along the axis only
+------------------------------------------------------------------------- */
+
+class DomainWedge : public Domain
+{
+
+  public:
+
+    DomainWedge(class LAMMPS *lmp);
+
+    void init();
+    void set_domain(class RegWedge *rw);
+    void pbc();
+
+    int is_in_domain_wedge(double* pos);
+    int is_in_subdomain_wedge(double* pos);
+    int is_in_extended_subdomain_wedge(double* pos);
+    double dist_subbox_borders_wedge(double* pos);
+    void min_subbox_extent_wedge(double &min_extent,int &dim);
+    int is_periodic_ghost_wedge(int i);
+
+    inline int index_axis() const
+    { return iaxis_; }
+
+    inline int index_phi() const
+    { return iphi_; }
+
+    inline void n1(double *_n1) const
+    { vectorCopy2D(n1_,_n1); }
+
+    inline void n2(double *_n2) const
+    { vectorCopy2D(n2_,_n2); }
+
+    inline void center(double *_c) const
+    { vectorCopy2D(c_,_c); }
+
+    inline double angle() const
+    { return dang_; }
+
+    // rotate around the wedge axis by sign * wedge angle
+    // rotate_vector() for directions (v, omega, shear), rotate_point() for positions
+
+    inline void rotate_vector(double *v, int sign) const
+    {
+        const double s = sign * sindang_;
+        const double va = v[iphi_], vb = v[iperp_];
+        v[iphi_] = cosdang_*va - s*vb;
+        v[iperp_] = s*va + cosdang_*vb;
+    }
+
+    inline void rotate_point(double *x, int sign) const
+    {
+        const double s = sign * sindang_;
+        const double da = x[iphi_]-c_[0], db = x[iperp_]-c_[1];
+        x[iphi_] = c_[0] + cosdang_*da - s*db;
+        x[iperp_] = c_[1] + s*da + cosdang_*db;
+    }
+
+    // signed distances to the angular faces, positive outside of the wedge
+
+    inline double dist_face1(const double *x) const
+    { return (x[iphi_]-c_[0])*n1_[0] + (x[iperp_]-c_[1])*n1_[1]; }
+
+    inline double dist_face2(const double *x) const
+    { return (x[iphi_]-c_[0])*n2_[0] + (x[iperp_]-c_[1])*n2_[1]; }
+
+  private:
+
+    int iaxis_, iphi_, iperp_;
+    double c_[2];
+    double radius_;
+    double dang_, cosdang_, sindang_;
+    double n1_[2], n2_[2];
+
+    // contact histories that have to follow particles across the periodic faces
+    std::vector<class FixContactHistory*> fix_history_;
+    std::vector<class FixWallGran*> fix_wall_;
+};
+
+}
+
+#endif
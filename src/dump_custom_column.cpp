@@ -0,0 +1,356 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include <string.h>
+#include "dump_custom_column.h"
+#include "domain.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+enum{INT,DOUBLE,STRING};    // same as in DumpCustom
+
+/* ---------------------------------------------------------------------- */
+
+DumpCustomColumn::DumpCustomColumn(LAMMPS *lmp, int narg, char **arg) :
+  DumpCustom(lmp, narg, arg),
+  float32_flag(0),
+  ctype(NULL),
+  cname(NULL),
+  fileopen(0),
+  file_offset(0),
+  maxcbuf(0),
+  cbuf(NULL)
+{
+  if (multiproc)
+    error->all(FLERR,"Dump custom/column can not be used with % in the file name");
+  if (compressed)
+    error->all(FLERR,"Dump custom/column can not write gzipped files");
+
+  // values are never converted to strings
+
+  buffer_allow = 0;
+  buffer_flag = 0;
+
+  ctype = new int[size_one];
+  cname = new char*[size_one];
+  for (int i = 0; i < size_one; i++) {
+    ctype[i] = COLUMN_FLOAT64;
+    cname[i] = new char[strlen(arg[5+i]) + 1];
+    strcpy(cname[i],arg[5+i]);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpCustomColumn::~DumpCustomColumn()
+{
+  closefile();
+
+  delete [] ctype;
+  for (int i = 0; i < size_one; i++) delete [] cname[i];
+  delete [] cname;
+  memory->destroy(cbuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpCustomColumn::init_style()
+{
+  DumpCustom::init_style();
+
+  for (int i = 0; i < size_one; i++) {
+    if (vtype[i] == STRING)
+      error->all(FLERR,"Dump custom/column can not write string columns");
+    else if (vtype[i] == INT) ctype[i] = COLUMN_INT32;
+    else if (float32_flag) ctype[i] = COLUMN_FLOAT32;
+    else ctype[i] = COLUMN_FLOAT64;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpCustomColumn::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0],"float32") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    if (strcmp(arg[1],"yes") == 0) float32_flag = 1;
+    else if (strcmp(arg[1],"no") == 0) float32_flag = 0;
+    else error->all(FLERR,"Illegal dump_modify command");
+    return 2;
+  }
+
+  return DumpCustom::modify_param(narg,arg);
+}
+
+/* ----------------------------------------------------------------------
+   open the dump file collectively on all procs
+   for a single file without append, truncate any existing file
+------------------------------------------------------------------------- */
+
+void DumpCustomColumn::openfile()
+{
+  if (singlefile_opened) return;
+  if (multifile == 0) singlefile_opened = 1;
+
+  // if one file per timestep, replace '*' with current timestep
+
+  char *filecurrent = filename;
+
+  if (multifile) {
+    char *filestar = filecurrent;
+    filecurrent = new char[strlen(filestar) + 16];
+    char *ptr = strchr(filestar,'*');
+    *ptr = '\0';
+    if (padflag == 0)
+      sprintf(filecurrent,"%s" BIGINT_FORMAT "%s",
+              filestar,update->ntimestep,ptr+1);
+    else {
+      char bif[8],pad[16];
+      strcpy(bif,BIGINT_FORMAT);
+      sprintf(pad,"%%s%%0%d%s%%s",padflag,&bif[1]);
+      sprintf(filecurrent,pad,filestar,update->ntimestep,ptr+1);
+    }
+    *ptr = '*';
+  }
+
+  int err = MPI_File_open(world,filecurrent,MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                          MPI_INFO_NULL,&fh);
+  if (err != MPI_SUCCESS) error->all(FLERR,"Cannot open dump file");
+  fileopen = 1;
+
+  if (append_flag && !multifile) MPI_File_get_size(fh,&file_offset);
+  else {
+    MPI_File_set_size(fh,0);
+    file_offset = 0;
+  }
+
+  if (multifile) delete [] filecurrent;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpCustomColumn::closefile()
+{
+  if (!fileopen) return;
+  MPI_File_close(&fh);
+  fileopen = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpCustomColumn::column_size(int icol)
+{
+  if (ctype[icol] == COLUMN_FLOAT64) return sizeof(double);
+  if (ctype[icol] == COLUMN_FLOAT32) return sizeof(float);
+  return sizeof(int);
+}
+
+/* ----------------------------------------------------------------------
+   write one frame
+   each proc writes its slice of every column at the position given by
+   the number of atoms on lower procs, no data is funneled through proc 0
+------------------------------------------------------------------------- */
+
+void DumpCustomColumn::write()
+{
+  if (multifile) openfile();
+
+  // simulation box bounds
+
+  double box[9];
+  if (domain->triclinic == 0) {
+    box[0] = domain->boxlo[0];
+    box[1] = domain->boxhi[0];
+    box[2] = domain->boxlo[1];
+    box[3] = domain->boxhi[1];
+    box[4] = domain->boxlo[2];
+    box[5] = domain->boxhi[2];
+    box[6] = box[7] = box[8] = 0.0;
+  } else {
+    box[0] = domain->boxlo_bound[0];
+    box[1] = domain->boxhi_bound[0];
+    box[2] = domain->boxlo_bound[1];
+    box[3] = domain->boxhi_bound[1];
+    box[4] = domain->boxlo_bound[2];
+    box[5] = domain->boxhi_bound[2];
+    box[6] = domain->xy;
+    box[7] = domain->xz;
+    box[8] = domain->yz;
+  }
+
+  // pack and optionally sort my atoms as dump custom does
+
+  nme = count();
+
+  bigint bnme = nme;
+  MPI_Allreduce(&bnme,&ntotal,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+  int nmax;
+  MPI_Allreduce(&nme,&nmax,1,MPI_INT,MPI_MAX,world);
+
+  if (nmax > maxbuf) {
+    if ((bigint) nmax * size_one > MAXSMALLINT)
+      error->all(FLERR,"Too much per-proc info for dump");
+    maxbuf = nmax;
+    memory->destroy(buf);
+    memory->create(buf,maxbuf*size_one,"dump:buf");
+  }
+
+  if (sortBuffer) {
+    sortBuffer->realloc_ids(nmax);
+    pack(sortBuffer->get_ids());
+    sortBuffer->sort(buf, nme, maxbuf, size_one, ntotal);
+  } else pack(NULL);
+
+  // nbefore = # of atoms on lower procs after sorting
+
+  bigint nbefore;
+  bnme = nme;
+  MPI_Scan(&bnme,&nbefore,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  nbefore -= bnme;
+
+  // frame layout, identical on all procs
+
+  bigint header_bytes = COLUMN_DUMP_MAGIC_LEN + 3*sizeof(bigint) +
+    8*sizeof(int) + 9*sizeof(double);
+  for (int i = 0; i < size_one; i++)
+    header_bytes += 2*sizeof(int) + strlen(cname[i]) + sizeof(bigint);
+
+  bigint *coffset = new bigint[size_one];
+  bigint frame_bytes = header_bytes;
+  for (int i = 0; i < size_one; i++) {
+    coffset[i] = frame_bytes;
+    frame_bytes += ntotal*column_size(i);
+  }
+
+  // proc 0 writes the frame header
+
+  int err = MPI_SUCCESS;
+
+  if (me == 0) {
+    char *header = new char[header_bytes];
+    char *ptr = header;
+    memcpy(ptr,COLUMN_DUMP_MAGIC,COLUMN_DUMP_MAGIC_LEN);
+    ptr += COLUMN_DUMP_MAGIC_LEN;
+    memcpy(ptr,&update->ntimestep,sizeof(bigint)); ptr += sizeof(bigint);
+    memcpy(ptr,&ntotal,sizeof(bigint)); ptr += sizeof(bigint);
+    memcpy(ptr,&frame_bytes,sizeof(bigint)); ptr += sizeof(bigint);
+    memcpy(ptr,&domain->triclinic,sizeof(int)); ptr += sizeof(int);
+    memcpy(ptr,&domain->boundary[0][0],6*sizeof(int)); ptr += 6*sizeof(int);
+    memcpy(ptr,box,9*sizeof(double)); ptr += 9*sizeof(double);
+    memcpy(ptr,&size_one,sizeof(int)); ptr += sizeof(int);
+    for (int i = 0; i < size_one; i++) {
+      int n = strlen(cname[i]);
+      memcpy(ptr,&ctype[i],sizeof(int)); ptr += sizeof(int);
+      memcpy(ptr,&n,sizeof(int)); ptr += sizeof(int);
+      memcpy(ptr,cname[i],n); ptr += n;
+      memcpy(ptr,&coffset[i],sizeof(bigint)); ptr += sizeof(bigint);
+    }
+    err = MPI_File_write_at(fh,file_offset,header,header_bytes,MPI_BYTE,
+                            MPI_STATUS_IGNORE);
+    delete [] header;
+  }
+
+  // all procs write their part of each column
+
+  for (int i = 0; i < size_one; i++)
+    write_column(i,nbefore,file_offset+coffset[i]);
+
+  delete [] coffset;
+
+  int errall;
+  MPI_Allreduce(&err,&errall,1,MPI_INT,MPI_MAX,world);
+  if (errall != MPI_SUCCESS)
+    error->all(FLERR,"Error writing dump custom/column file");
+
+  file_offset += frame_bytes;
+
+  if (multifile) closefile();
+}
+
+/* ----------------------------------------------------------------------
+   convert column icol of my atoms to on-disk type and write it
+   collectively at offset + nbefore values
+------------------------------------------------------------------------- */
+
+void DumpCustomColumn::write_column(int icol, bigint nbefore, MPI_Offset offset)
+{
+  int size = column_size(icol);
+  int nbytes = nme*size;
+
+  if (nbytes > maxcbuf) {
+    maxcbuf = nbytes;
+    memory->destroy(cbuf);
+    memory->create(cbuf,maxcbuf,"dump:cbuf");
+  }
+
+  if (ctype[icol] == COLUMN_INT32) {
+    int *out = (int *) cbuf;
+    for (int i = 0; i < nme; i++)
+      out[i] = static_cast<int> (buf[i*size_one+icol]);
+  } else if (ctype[icol] == COLUMN_FLOAT32) {
+    float *out = (float *) cbuf;
+    for (int i = 0; i < nme; i++)
+      out[i] = static_cast<float> (buf[i*size_one+icol]);
+  } else {
+    double *out = (double *) cbuf;
+    for (int i = 0; i < nme; i++)
+      out[i] = buf[i*size_one+icol];
+  }
+
+  int err = MPI_File_write_at_all(fh,offset+nbefore*size,cbuf,nbytes,
+                                  MPI_BYTE,MPI_STATUS_IGNORE);
+  if (err != MPI_SUCCESS)
+    error->one(FLERR,"Error writing dump custom/column file");
+}
+
+/* ---------------------------------------------------------------------- */
+
+bigint DumpCustomColumn::memory_usage()
+{
+  bigint bytes = DumpCustom::memory_usage();
+  bytes += maxcbuf;
+  return bytes;
+}
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(custom/column,DumpCustomColumn)
+
+#else
+
+#ifndef LMP_DUMP_CUSTOM_COLUMN_H
+#define LMP_DUMP_CUSTOM_COLUMN_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   layout of one frame of a column dump file, all values in native
+   byte order. frames are self-contained and stored back to back:
+
+     char   magic[8]            COLUMN_DUMP_MAGIC
+     bigint ntimestep
+     bigint natoms
+     bigint frame_bytes         size of frame incl. header = offset of next
+     int    triclinic
+     int    boundary[3][2]
+     double box[9]              xlo xhi ylo yhi zlo zhi xy xz yz
+     int    ncol
+     per column:
+       int    type              COLUMN_INT32, COLUMN_FLOAT32, COLUMN_FLOAT64
+       int    namelength
+       char   name[namelength]  not null-terminated
+       bigint offset            of column data relative to frame start
+     column data, natoms values per column
+------------------------------------------------------------------------- */
+
+#define COLUMN_DUMP_MAGIC "LGCOLDMP"
+#define COLUMN_DUMP_MAGIC_LEN 8
+
+enum{COLUMN_INT32,COLUMN_FLOAT32,COLUMN_FLOAT64};
+
+class DumpCustomColumn : public DumpCustom {
+ public:
+  DumpCustomColumn(class LAMMPS *, int, char **);
+  virtual ~DumpCustomColumn();
+
+  void write();
+
+ protected:
+  virtual void init_style();
+  virtual void openfile();
+  virtual int modify_param(int, char **);
+  virtual void write_header(bigint) {}
+  virtual void write_data(int, double *) {}
+  bigint memory_usage();
+
+ private:
+  void closefile();
+  int column_size(int);
+  void write_column(int, bigint, MPI_Offset);
+
+  int float32_flag;            // 1 if DOUBLE columns are written as float
+  int *ctype;                  // on-disk type of each column
+  char **cname;                // name of each column
+
+  MPI_File fh;                 // dump file, opened collectively
+  int fileopen;                // 1 if fh is open
+  MPI_Offset file_offset;      // start of the next frame
+
+  int maxcbuf;                 // size of cbuf in bytes
+  char *cbuf;                  // one column of my atoms in on-disk type
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Dump custom/column can not be used with % in the file name
+
+All processes write to one file via MPI-IO.
+
+E: Dump custom/column can not write gzipped files
+
+Self-explanatory.
+
+E: Dump custom/column can not write string columns
+
+Element names are not supported.
+
+E: Cannot open dump file
+
+The specified file cannot be opened.
+
+E: Error writing dump custom/column file
+
+An MPI-IO write operation failed.
+
+*/
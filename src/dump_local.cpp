@@ -266,7 +266,9 @@ int DumpLocal::count()
   if (ncompute) {
     for (i = 0; i < ncompute; i++) {
       if (!(compute[i]->invoked_flag & INVOKED_LOCAL)) {
+        compute[i]->begin_time_recording();
         compute[i]->compute_local();
+        compute[i]->end_time_recording();
         compute[i]->invoked_flag |= INVOKED_LOCAL;
       }
     }
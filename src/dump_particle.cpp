@@ -813,7 +813,9 @@ int DumpParticle::count()
     if (ncompute) {
         for (i = 0; i < ncompute; i++)
             if (!(compute[i]->invoked_flag & INVOKED_PERATOM)) {
+                compute[i]->begin_time_recording();
                 compute[i]->compute_peratom();
+                compute[i]->end_time_recording();
                 compute[i]->invoked_flag |= INVOKED_PERATOM;
             }
     }
@@ -0,0 +1,304 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ensemble.h"
+#include "universe.h"
+#include "comm.h"
+#include "input.h"
+#include "variable.h"
+#include "force.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define MAXLINE 256
+
+/* ---------------------------------------------------------------------- */
+
+Ensemble::Ensemble(LAMMPS *lmp) : Pointers(lmp)
+{
+  if (!universe->ensemble) universe->ensemble = new EnsembleTable();
+  table = universe->ensemble;
+}
+
+/* ----------------------------------------------------------------------
+   ensemble table file
+   ensemble select N
+   ensemble record name value ...
+   ensemble write file
+------------------------------------------------------------------------- */
+
+void Ensemble::command(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal ensemble command");
+
+  if (strcmp(arg[0],"table") == 0) {
+    if (narg != 2) error->all(FLERR,"Illegal ensemble command");
+    read_table(arg[1]);
+  } else if (strcmp(arg[0],"select") == 0) {
+    if (narg != 2) error->all(FLERR,"Illegal ensemble command");
+    select(force->inumeric(FLERR,arg[1]));
+  } else if (strcmp(arg[0],"record") == 0) {
+    if (narg < 3 || (narg-1) % 2) error->all(FLERR,"Illegal ensemble command");
+    record(narg-1,&arg[1]);
+  } else if (strcmp(arg[0],"write") == 0) {
+    if (narg != 2) error->all(FLERR,"Illegal ensemble command");
+    write(arg[1]);
+  } else error->all(FLERR,"Illegal ensemble command");
+}
+
+/* ----------------------------------------------------------------------
+   read parameter table, first line holds the column names
+   '#' starts a comment, blank lines are skipped
+   proc 0 of each world reads the file and broadcasts it within the world
+------------------------------------------------------------------------- */
+
+void Ensemble::read_table(const char *file)
+{
+  std::string text;
+  int n = 0;
+
+  if (comm->me == 0) {
+    FILE *fp = fopen(file,"r");
+    if (fp == NULL) {
+      char str[128];
+      sprintf(str,"Cannot open ensemble table file %s",file);
+      error->one(FLERR,str);
+    }
+    char buf[MAXLINE];
+    size_t nread;
+    while ((nread = fread(buf,1,MAXLINE,fp)) > 0) text.append(buf,nread);
+    fclose(fp);
+    n = text.size();
+  }
+
+  MPI_Bcast(&n,1,MPI_INT,0,world);
+  char *chars = new char[n+1];
+  if (comm->me == 0) memcpy(chars,text.c_str(),n);
+  MPI_Bcast(chars,n,MPI_CHAR,0,world);
+  chars[n] = '\0';
+
+  table->columns.clear();
+  table->rows.clear();
+  table->current = 0;
+
+  char *next;
+  for (char *line = chars; line; line = next) {
+    next = strchr(line,'\n');
+    if (next) *next++ = '\0';
+    char *ptr = strchr(line,'#');
+    if (ptr) *ptr = '\0';
+
+    std::vector<std::string> words;
+    for (char *word = strtok(line," \t\r"); word; word = strtok(NULL," \t\r"))
+      words.push_back(word);
+    if (words.empty()) continue;
+
+    if (table->columns.empty()) table->columns = words;
+    else if (words.size() != table->columns.size())
+      error->all(FLERR,"Ensemble table line has wrong number of values");
+    else table->rows.push_back(words);
+  }
+  delete [] chars;
+
+  if (table->columns.empty())
+    error->all(FLERR,"Ensemble table has no parameter names");
+
+  if (comm->me == 0) {
+    if (screen)
+      fprintf(screen,"Ensemble table %s: %d parameters, %d variants\n",
+              file,(int)table->columns.size(),(int)table->rows.size());
+    if (logfile)
+      fprintf(logfile,"Ensemble table %s: %d parameters, %d variants\n",
+              file,(int)table->columns.size(),(int)table->rows.size());
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set one string variable per column to the values in row irow
+------------------------------------------------------------------------- */
+
+void Ensemble::select(int irow)
+{
+  if (irow < 1 || irow > (int) table->rows.size())
+    error->all(FLERR,"Ensemble row is out of range");
+
+  table->current = irow;
+
+  std::vector<std::string> &values = table->rows[irow-1];
+  char *vararg[3];
+  vararg[1] = (char *) "string";
+  for (int i = 0; i < (int) table->columns.size(); i++) {
+    vararg[0] = (char *) table->columns[i].c_str();
+    vararg[2] = (char *) values[i].c_str();
+    input->variable->set(3,vararg);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Ensemble::record(int narg, char **arg)
+{
+  if (table->current == 0)
+    error->all(FLERR,"Ensemble record requires a selected row");
+
+  std::map<std::string,std::string> &result = table->results[table->current];
+
+  for (int i = 0; i < narg; i += 2) {
+    std::string name(arg[i]);
+    bool found = false;
+    for (int j = 0; j < (int) table->names.size(); j++)
+      if (table->names[j] == name) found = true;
+    if (!found) table->names.push_back(name);
+    result[name] = arg[i+1];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   gather results of all partitions and write them as one table
+   must be called by all partitions
+   proc 0 of each world contributes lines "row name value"
+------------------------------------------------------------------------- */
+
+void Ensemble::write(const char *file)
+{
+  std::string text;
+  if (comm->me == 0) {
+    std::map<int, std::map<std::string,std::string> >::iterator it;
+    for (it = table->results.begin(); it != table->results.end(); ++it) {
+      std::map<std::string,std::string>::iterator jt;
+      for (jt = it->second.begin(); jt != it->second.end(); ++jt) {
+        char str[32];
+        sprintf(str,"%d ",it->first);
+        text += str + jt->first + " " + jt->second + "\n";
+      }
+    }
+  }
+
+  int n = text.size();
+  int *recvcounts = NULL;
+  int *displs = NULL;
+  char *all = NULL;
+  int nall = 0;
+
+  if (universe->me == 0) {
+    memory->create(recvcounts,universe->nprocs,"ensemble:recvcounts");
+    memory->create(displs,universe->nprocs,"ensemble:displs");
+  }
+  MPI_Gather(&n,1,MPI_INT,recvcounts,1,MPI_INT,0,universe->uworld);
+  if (universe->me == 0) {
+    for (int iproc = 0; iproc < universe->nprocs; iproc++) {
+      displs[iproc] = nall;
+      nall += recvcounts[iproc];
+    }
+    all = new char[nall+1];
+  }
+  MPI_Gatherv((char *) text.c_str(),n,MPI_CHAR,
+              all,recvcounts,displs,MPI_CHAR,0,universe->uworld);
+
+  if (universe->me == 0) {
+    all[nall] = '\0';
+
+    // merge results, quantities recorded on this world come first
+
+    std::map<int, std::map<std::string,std::string> > merged;
+    std::vector<std::string> names = table->names;
+
+    char *next;
+    for (char *line = all; line && *line; line = next) {
+      next = strchr(line,'\n');
+      if (next) *next++ = '\0';
+      char *row = strtok(line," ");
+      char *name = strtok(NULL," ");
+      char *value = strtok(NULL,"");
+      if (!row || !name || !value) continue;
+      bool found = false;
+      for (int j = 0; j < (int) names.size(); j++)
+        if (names[j] == name) found = true;
+      if (!found) names.push_back(name);
+      merged[atoi(row)][name] = value;
+    }
+
+    FILE *fp = fopen(file,"w");
+    if (fp == NULL) {
+      char str[128];
+      sprintf(str,"Cannot open ensemble output file %s",file);
+      error->one(FLERR,str);
+    }
+
+    fprintf(fp,"row");
+    for (int i = 0; i < (int) table->columns.size(); i++)
+      fprintf(fp," %s",table->columns[i].c_str());
+    for (int i = 0; i < (int) names.size(); i++)
+      fprintf(fp," %s",names[i].c_str());
+    fprintf(fp,"\n");
+
+    std::map<int, std::map<std::string,std::string> >::iterator it;
+    for (it = merged.begin(); it != merged.end(); ++it) {
+      fprintf(fp,"%d",it->first);
+      for (int i = 0; i < (int) table->columns.size(); i++) {
+        if (it->first <= (int) table->rows.size())
+          fprintf(fp," %s",table->rows[it->first-1][i].c_str());
+        else fprintf(fp," NaN");
+      }
+      for (int i = 0; i < (int) names.size(); i++) {
+        std::map<std::string,std::string>::iterator jt = it->second.find(names[i]);
+        fprintf(fp," %s",jt == it->second.end() ? "NaN" : jt->second.c_str());
+      }
+      fprintf(fp,"\n");
+    }
+    fclose(fp);
+
+    if (universe->uscreen)
+      fprintf(universe->uscreen,"Ensemble: wrote results of %d variants to %s\n",
+              (int)merged.size(),file);
+    if (universe->ulogfile)
+      fprintf(universe->ulogfile,"Ensemble: wrote results of %d variants to %s\n",
+              (int)merged.size(),file);
+
+    delete [] all;
+    memory->destroy(recvcounts);
+    memory->destroy(displs);
+  }
+}
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef COMMAND_CLASS
+
+CommandStyle(ensemble,Ensemble)
+
+#else
+
+#ifndef LMP_ENSEMBLE_H
+#define LMP_ENSEMBLE_H
+
+#include "pointers.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   parameter table and recorded results of an ensemble of variants
+   owned by Universe so it survives the clear command
+------------------------------------------------------------------------- */
+
+class EnsembleTable {
+ public:
+  EnsembleTable() : current(0) {}
+
+  std::vector<std::string> columns;               // parameter names
+  std::vector<std::vector<std::string> > rows;    // parameter values
+  int current;                                    // selected row, 1-based
+
+  std::vector<std::string> names;                 // recorded quantities
+  std::map<int, std::map<std::string,std::string> > results;
+};
+
+class Ensemble : protected Pointers {
+ public:
+  Ensemble(class LAMMPS *);
+  void command(int, char **);
+
+ private:
+  class EnsembleTable *table;
+
+  void read_table(const char *);
+  void select(int);
+  void record(int, char **);
+  void write(const char *);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ensemble command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
+
+E: Cannot open ensemble table file
+
+The file could not be found or is not readable.
+
+E: Ensemble table has no parameter names
+
+The first non-comment line of the file must list the column names.
+
+E: Ensemble table line has wrong number of values
+
+Each row must have one value for every column name.
+
+E: Ensemble row is out of range
+
+The row index must be between 1 and the number of rows in the table.
+
+E: Ensemble record requires a selected row
+
+Use ensemble select before recording results.
+
+E: Cannot open ensemble output file
+
+The output file could not be created.
+
+*/
@@ -64,6 +64,7 @@
 #include "memory.h"
 #include "modify.h"
 #include "fix.h"
+#include "compute.h"
 
 using namespace LAMMPS_NS;
 
@@ -566,6 +567,44 @@ void Finish::end(int flag)
         }
       }
       delete [] fix_times;
+
+      // per-hook fix times and compute times as min/avg/max over procs
+
+      const int nfix = modify->nfix;
+      const int n = nfix*TIME_FIX_N + modify->ncompute;
+      double *tmin = new double[n+1];
+      double *tavg = new double[n+1];
+      double *tmax = new double[n+1];
+      double tloop;
+      timer->modify_stats(tmin,tavg,tmax,tloop);
+
+      if (me == 0) {
+        const char *fmt = "  %-10s %-16s %-22s %10.4g %10.4g %10.4g %6.2f\n";
+        for (int k = 0; k < 2; k++) {
+          FILE *fp = k ? logfile : screen;
+          if (!fp) continue;
+          fprintf(fp,"\nFix hook times: min avg max (%% of loop)\n");
+          for (int i = 0; i < nfix; i++)
+            for (int j = 0; j < TIME_FIX_N; j++) {
+              const int ij = i*TIME_FIX_N+j;
+              if (tmax[ij] == 0.0) continue;
+              fprintf(fp,fmt,modify->fix[i]->id,modify->fix[i]->style,
+                      Timer::fix_hook_name(j),tmin[ij],tavg[ij],tmax[ij],
+                      tavg[ij]/time_loop*100.0);
+            }
+          fprintf(fp,"Compute times: min avg max (%% of loop)\n");
+          for (int i = 0; i < modify->ncompute; i++) {
+            const int ij = nfix*TIME_FIX_N+i;
+            if (tmax[ij] == 0.0) continue;
+            fprintf(fp,fmt,modify->compute[i]->id,modify->compute[i]->style,
+                    "",tmin[ij],tavg[ij],tmax[ij],tavg[ij]/time_loop*100.0);
+          }
+        }
+      }
+
+      delete [] tmin;
+      delete [] tavg;
+      delete [] tmax;
     }
   }
 
@@ -719,7 +758,7 @@ void Finish::end(int flag)
 
     nneighfull = 0;
     if (m < neighbor->old_nrequest) {
-      if (neighbor->lists[m]->numneigh > 0) {
+      if (neighbor->lists[m]->numneigh) {
         int inum = neighbor->lists[m]->inum;
         int *ilist = neighbor->lists[m]->ilist;
         int *numneigh = neighbor->lists[m]->numneigh;
@@ -766,6 +805,10 @@ void Finish::end(int flag)
       MPI_Allreduce(&tmp,&nspec_all,1,MPI_DOUBLE,MPI_SUM,world);
     }
 
+    bigint nkeep_all = 0;
+    if (neighbor->localize)
+      MPI_Allreduce(&neighbor->nkeep,&nkeep_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
     if (me == 0) {
       if (screen) {
         if (nall < 2.0e9)
@@ -781,6 +824,10 @@ void Finish::end(int flag)
                 neighbor->ncalls);
         fprintf(screen,"Dangerous builds = " BIGINT_FORMAT "\n",
                 neighbor->ndanger);
+        if (neighbor->localize)
+          fprintf(screen,"Kept neighbor lists = " BIGINT_FORMAT " of "
+                  BIGINT_FORMAT " builds on all procs\n",
+                  nkeep_all,neighbor->ncalls*nprocs);
       }
       if (logfile) {
         if (nall < 2.0e9)
@@ -796,6 +843,10 @@ void Finish::end(int flag)
                 neighbor->ncalls);
         fprintf(logfile,"Dangerous builds = " BIGINT_FORMAT "\n",
                 neighbor->ndanger);
+        if (neighbor->localize)
+          fprintf(logfile,"Kept neighbor lists = " BIGINT_FORMAT " of "
+                  BIGINT_FORMAT " builds on all procs\n",
+                  nkeep_all,neighbor->ncalls*nprocs);
       }
     }
   }
@@ -53,6 +53,7 @@
 #define LMP_FIX_H
 
 #include "pointers.h"
+#include "timer.h"
 
 namespace LAMMPS_NS {
 
@@ -278,25 +279,33 @@ class Fix : protected Pointers {
 
  private:
   // add timing functionality to all fixes
+  // total time and time per hook, see TIME_FIX_* in timer.h
   double recorded_time;
+  double recorded_time_hook[TIME_FIX_N];
   double previous_time;
 
  public:
   inline void reset_time_recording() {
     recorded_time = 0.0;
+    for (int i = 0; i < TIME_FIX_N; i++) recorded_time_hook[i] = 0.0;
   }
 
   inline double get_recorded_time() const {
     return recorded_time;
   }
 
+  inline double get_recorded_time(int hook) const {
+    return recorded_time_hook[hook];
+  }
+
   inline void begin_time_recording() {
     previous_time = MPI_Wtime();
   }
 
-  inline void end_time_recording() {
+  inline void end_time_recording(int hook = TIME_FIX_OTHER) {
     double delta_time = MPI_Wtime() - previous_time;
     recorded_time += delta_time;
+    recorded_time_hook[hook] += delta_time;
   }
 
   union ubuf {  
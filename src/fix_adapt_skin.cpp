@@ -0,0 +1,329 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include "fix_adapt_skin.h"
+#include "atom.h"
+#include "update.h"
+#include "neighbor.h"
+#include "comm.h"
+#include "force.h"
+#include "timer.h"
+#include "mpi_liggghts.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+#define NCANDIDATE 20     // # of skins tested per adaptation
+#define HYSTERESIS 0.1    // min relative cost saving for a change
+#define BIG 1.0e20
+
+/* ---------------------------------------------------------------------- */
+
+FixAdaptSkin::FixAdaptSkin(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  skin_min(-1.),
+  skin_max(-1.),
+  factor(1.5),
+  verbose(false),
+  skin_next(0.),
+  cost_prev(0.),
+  cost_next(0.),
+  step_last(0),
+  ncalls_last(0),
+  time_neigh_last(0.),
+  time_pair_last(0.),
+  time_build(-1.),
+  interval(0.),
+  nchange(0),
+  skin_lo(0.),
+  skin_hi(0.)
+{
+  if (narg < 4) error->all(FLERR,"Illegal fix adapt/skin command");
+
+  nevery = force->inumeric(FLERR,arg[3]);
+  if (nevery <= 0) error->all(FLERR,"Illegal fix adapt/skin command");
+
+  int iarg = 4;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"min") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix adapt/skin command");
+      skin_min = force->cg_max()*force->numeric(FLERR,arg[iarg+1]);
+      if (skin_min <= 0.) error->all(FLERR,"Illegal fix adapt/skin command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"max") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix adapt/skin command");
+      skin_max = force->cg_max()*force->numeric(FLERR,arg[iarg+1]);
+      if (skin_max <= 0.) error->all(FLERR,"Illegal fix adapt/skin command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"factor") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix adapt/skin command");
+      factor = force->numeric(FLERR,arg[iarg+1]);
+      if (factor <= 1.) error->all(FLERR,"Illegal fix adapt/skin command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"verbose") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix adapt/skin command");
+      if (strcmp(arg[iarg+1],"yes") == 0) verbose = true;
+      else if (strcmp(arg[iarg+1],"no") == 0) verbose = false;
+      else error->all(FLERR,"Illegal fix adapt/skin command");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal fix adapt/skin command");
+  }
+
+  if (skin_min > 0. && skin_max > 0. && skin_min > skin_max)
+    error->all(FLERR,"Illegal fix adapt/skin command");
+
+  vector_flag = 1;
+  size_vector = 4;
+  global_freq = nevery;
+  extvector = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixAdaptSkin::setmask()
+{
+  int mask = 0;
+  mask |= PRE_EXCHANGE;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAdaptSkin::init()
+{
+  if (neighbor->style != 1)
+    error->all(FLERR,"Fix adapt/skin requires neighbor style bin");
+  if (!neighbor->dist_check)
+    error->all(FLERR,"Fix adapt/skin requires neigh_modify check yes");
+  if (!strstr(update->integrate_style,"verlet"))
+    error->all(FLERR,"Fix adapt/skin requires run_style verlet");
+  if (neighbor->skin <= 0.)
+    error->all(FLERR,"Fix adapt/skin requires a neighbor skin > 0");
+
+  // default limits relative to the skin set by the neighbor command
+
+  if (skin_min < 0.) skin_min = 0.25*neighbor->skin;
+  if (skin_max < 0.) skin_max = 4.*neighbor->skin;
+  if (skin_min > skin_max) skin_min = skin_max;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAdaptSkin::setup(int vflag)
+{
+  step_last = update->ntimestep;
+  ncalls_last = neighbor->ncalls;
+  time_neigh_last = timer->array[TIME_NEIGHBOR];
+  time_pair_last = timer->array[TIME_PAIR];
+
+  skin_next = 0.;
+  interval = 0.;
+  nchange = 0;
+  skin_lo = skin_hi = neighbor->skin;
+}
+
+/* ----------------------------------------------------------------------
+   apply new skin, only called on reneighboring steps before the lists
+   are built, so lists built with the previous skin stay valid until here
+------------------------------------------------------------------------- */
+
+void FixAdaptSkin::pre_exchange()
+{
+  if (skin_next == 0.) return;
+
+  if (verbose && comm->me == 0) {
+    char str[256];
+    sprintf(str,"Fix adapt/skin: step " BIGINT_FORMAT ": skin %g -> %g "
+            "(%g steps between builds, estimated time per step %g -> %g)\n",
+            update->ntimestep,neighbor->skin,skin_next,interval,cost_prev,cost_next);
+    if (screen) fprintf(screen,"%s",str);
+    if (logfile) fprintf(logfile,"%s",str);
+  }
+
+  neighbor->reset_skin(skin_next);
+  comm->setup();
+  neighbor->setup_bins();
+
+  skin_lo = MIN(skin_lo,skin_next);
+  skin_hi = MAX(skin_hi,skin_next);
+  nchange++;
+  skin_next = 0.;
+}
+
+/* ----------------------------------------------------------------------
+   choose skin that minimizes the estimated time per step
+   from rebuild interval, displacement and timings of the last interval
+------------------------------------------------------------------------- */
+
+void FixAdaptSkin::end_of_step()
+{
+  const double skin = neighbor->skin;
+  const bigint nsteps = update->ntimestep - step_last;
+  if (nsteps <= 0) return;
+
+  const bigint nbuild = neighbor->ncalls - ncalls_last;
+
+  // the slowest proc determines the time per step
+
+  double time_neigh = timer->array[TIME_NEIGHBOR] - time_neigh_last;
+  double time_pair = timer->array[TIME_PAIR] - time_pair_last;
+  MPI_Max_Scalar(time_neigh,world);
+  MPI_Max_Scalar(time_pair,world);
+
+  step_last = update->ntimestep;
+  ncalls_last = neighbor->ncalls;
+  time_neigh_last = timer->array[TIME_NEIGHBOR];
+  time_pair_last = timer->array[TIME_PAIR];
+
+  // max displacement per step
+  // measured rebuild interval: a build is triggered once the fastest atom
+  //   moved half the skin, so this includes all accelerations in the interval
+  // without builds: current max velocity, bounded by the interval length
+
+  double vmaxsq = 0.;
+  double **v = atom->v;
+  int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++)
+    if (mask[i] & groupbit)
+      vmaxsq = MAX(vmaxsq,v[i][0]*v[i][0]+v[i][1]*v[i][1]+v[i][2]*v[i][2]);
+  MPI_Max_Scalar(vmaxsq,world);
+
+  double disp;
+  if (nbuild > 0) {
+    interval = static_cast<double>(nsteps)/nbuild;
+    disp = 0.5*skin/interval;
+    time_build = time_neigh/nbuild;
+  } else {
+    interval = static_cast<double>(nsteps);
+    disp = MIN(sqrt(vmaxsq)*update->dt,0.5*skin/nsteps);
+  }
+
+  const double time_force = time_pair/nsteps;
+
+  // no build timed yet, assume a build costs as much as a force evaluation
+
+  const double tbuild = time_build < 0. ? time_force : time_build;
+
+  // interaction range without skin, e.g. 2x max radius for granular pairs
+
+  const double range = MAX(neighbor->cutneighmax - skin,0.);
+
+  // test skins in range allowed for this adaptation
+
+  double lo = MAX(skin_min,skin/factor);
+  double hi = MIN(skin_max,skin*factor);
+  if (lo > hi) lo = hi = (skin < skin_min ? skin_min : skin_max);
+
+  const double cost_now = cost(skin,skin,range,disp,tbuild) + time_force;
+  double skin_best = skin;
+  double cost_best = cost_now;
+
+  for (int i = 0; i <= NCANDIDATE; i++) {
+    double s = lo*pow(hi/lo,static_cast<double>(i)/NCANDIDATE);
+    double c = cost(s,skin,range,disp,tbuild) +
+      time_force*pow((range+s)/(range+skin),3.);
+    if (c < cost_best) {
+      cost_best = c;
+      skin_best = s;
+    }
+  }
+
+  // change only for a significant saving, always if out of limits
+
+  bool outside = skin < skin_min || skin > skin_max;
+  if (outside) {
+    skin_best = MAX(skin_min,MIN(skin_max,skin_best));
+  } else if (cost_best > (1.-HYSTERESIS)*cost_now) {
+    skin_next = 0.;
+    return;
+  }
+
+  skin_next = skin_best;
+  cost_prev = cost_now;
+  cost_next = cost_best;
+}
+
+/* ----------------------------------------------------------------------
+   estimated neighbor build time per step for skin s
+   the number of neighbors scales with (range+s)^3, the number of steps
+   between builds with s, but a build is done at most every neighbor->every
+------------------------------------------------------------------------- */
+
+double FixAdaptSkin::cost(double s, double skin, double range,
+                          double disp, double tbuild)
+{
+  double nsteps_build = disp > 0. ? 0.5*s/disp : BIG;
+  nsteps_build = MAX(nsteps_build,static_cast<double>(MAX(neighbor->every,neighbor->delay)));
+
+  return tbuild*pow((range+s)/(range+skin),3.)/nsteps_build;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAdaptSkin::post_run()
+{
+  if (comm->me != 0) return;
+
+  char str[256];
+  sprintf(str,"Fix adapt/skin: skin %g at end of run, %d changes in range "
+          "%g to %g, bin size %g\n",
+          neighbor->skin,nchange,skin_lo,skin_hi,neighbor->binsizex);
+  if (screen) fprintf(screen,"%s",str);
+  if (logfile) fprintf(logfile,"%s",str);
+}
+
+/* ----------------------------------------------------------------------
+   skin, bin size, mean steps between builds, # of changes in this run
+------------------------------------------------------------------------- */
+
+double FixAdaptSkin::compute_vector(int n)
+{
+  if (n == 0) return neighbor->skin;
+  if (n == 1) return neighbor->binsizex;
+  if (n == 2) return interval;
+  return static_cast<double>(nchange);
+}
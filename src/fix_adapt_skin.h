@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(adapt/skin,FixAdaptSkin)
+
+#else
+
+#ifndef LMP_FIX_ADAPT_SKIN_H
+#define LMP_FIX_ADAPT_SKIN_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixAdaptSkin : public Fix {
+ public:
+  FixAdaptSkin(class LAMMPS *, int, char **);
+  int setmask();
+  void init();
+  void setup(int);
+  void pre_exchange();
+  void end_of_step();
+  void post_run();
+  double compute_vector(int);
+
+ private:
+  double skin_min,skin_max;     // limits for the skin
+  double factor;                // max change of the skin per adaptation
+  bool verbose;
+
+  double skin_next;             // skin to apply at next reneighboring, 0 if none
+  double cost_prev,cost_next;   // estimated time per step before/after change
+
+  // state at the end of the previous interval
+  bigint step_last;
+  bigint ncalls_last;
+  double time_neigh_last,time_pair_last;
+
+  double time_build;            // time per neighbor list build, < 0 if unknown
+  double interval;              // mean # of steps between builds in last interval
+
+  int nchange;                  // # of skin changes in this run
+  double skin_lo,skin_hi;       // range of skins used in this run
+
+  double cost(double,double,double,double,double);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal fix adapt/skin command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
+
+E: Fix adapt/skin requires neighbor style bin
+
+The skin can only be adapted if neighbor lists are built using bins.
+
+E: Fix adapt/skin requires neigh_modify check yes
+
+Neighbor lists must be rebuilt based on the distance atoms moved,
+otherwise a change of the skin does not change the rebuild interval.
+
+E: Fix adapt/skin requires run_style verlet
+
+Self-explanatory.
+
+E: Fix adapt/skin requires a neighbor skin > 0
+
+The skin is changed relative to its current value, so it must not be
+zero.
+
+*/
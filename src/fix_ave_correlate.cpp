@@ -442,13 +442,17 @@ void FixAveCorrelate::end_of_step()
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+          compute->begin_time_recording();
           compute->compute_scalar();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         scalar = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+          compute->begin_time_recording();
           compute->compute_vector();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         scalar = compute->vector[argindex[i]-1];
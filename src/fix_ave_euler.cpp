@@ -543,7 +543,9 @@ void FixAveEuler::calculate_eu()
     // invoke compute if not previously invoked
     
     if (!(compute_stress_->invoked_flag & INVOKED_PERATOM)) {
+        compute_stress_->begin_time_recording();
         compute_stress_->compute_peratom();
+        compute_stress_->end_time_recording();
         compute_stress_->invoked_flag |= INVOKED_PERATOM;
     }
 
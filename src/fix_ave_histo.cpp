@@ -652,13 +652,17 @@ void FixAveHisto::end_of_step()
       if (kind == GLOBAL && mode == SCALAR) {
         if (j == 0) {
           if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+            compute->begin_time_recording();
             compute->compute_scalar();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_SCALAR;
           }
           bin_one(compute->scalar);
         } else {
           if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+            compute->begin_time_recording();
             compute->compute_vector();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
           bin_one(compute->vector[j-1]);
@@ -666,13 +670,17 @@ void FixAveHisto::end_of_step()
       } else if (kind == GLOBAL && mode == VECTOR) {
         if (j == 0) {
           if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+            compute->begin_time_recording();
             compute->compute_vector();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
           bin_vector(compute->size_vector,compute->vector,1);
         } else {
           if (!(compute->invoked_flag & INVOKED_ARRAY)) {
+            compute->begin_time_recording();
             compute->compute_array();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
           if (compute->array)
@@ -682,7 +690,9 @@ void FixAveHisto::end_of_step()
 
       } else if (kind == PERATOM) {
         if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+          compute->begin_time_recording();
           compute->compute_peratom();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_PERATOM;
         }
         if (j == 0)
@@ -692,7 +702,9 @@ void FixAveHisto::end_of_step()
 
       } else if (kind == LOCAL) {
         if (!(compute->invoked_flag & INVOKED_LOCAL)) {
+          compute->begin_time_recording();
           compute->compute_local();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_LOCAL;
         }
         if (j == 0)
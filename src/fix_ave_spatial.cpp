@@ -686,7 +686,9 @@ void FixAveSpatial::end_of_step()
     } else if (which[m] == COMPUTE) {
       Compute *compute = modify->compute[n];
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+        compute->begin_time_recording();
         compute->compute_peratom();
+        compute->end_time_recording();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
       double *vector = compute->vector_atom;
@@ -573,13 +573,17 @@ void FixAveTime::invoke_scalar(bigint ntimestep)
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+          compute->begin_time_recording();
           compute->compute_scalar();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         scalar = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+          compute->begin_time_recording();
           compute->compute_vector();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         scalar = compute->vector[argindex[i]-1];
@@ -699,7 +703,9 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
       if (argindex[j] == 0) {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+          compute->begin_time_recording();
           compute->compute_vector();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         double *cvector = compute->vector;
@@ -708,7 +714,9 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
       } else {
         if (!(compute->invoked_flag & INVOKED_ARRAY)) {
+          compute->begin_time_recording();
           compute->compute_array();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         double **carray = compute->array;
@@ -259,9 +259,10 @@ void FixCfdCouplingConvectiveImpl::post_force(int)
   // communicate convective flux to ghosts, there might be new data
   if(0 == neighbor->ago)
   {
-        fix_heatFluid->do_forward_comm();
-        fix_heatTransCoeff->do_forward_comm();
-        fix_convectiveFlux->do_forward_comm();
+        fix_heatFluid->queue_forward_comm();
+        fix_heatTransCoeff->queue_forward_comm();
+        fix_convectiveFlux->queue_forward_comm();
+        comm->flush_forward_comm_fix();
   }
 
   if(!integrateHeatEqn_) return; //only integrate if needed
@@ -65,6 +65,7 @@
 #include "modify.h"
 #include "memory.h"
 #include "math_extra_liggghts.h"
+#include "domain_wedge.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -161,6 +162,8 @@ FixContactHistory::FixContactHistory(LAMMPS *lmp, int narg, char **arg) :
         error->fix_error(FLERR,this,"newtonflag must be either 0 or 1");
 
   }
+
+  set_history_ids(std::vector<std::string>(history_id_,history_id_+dnum_));
 }
 
 /* ---------------------------------------------------------------------- */
@@ -657,3 +660,75 @@ int FixContactHistory::size_restart(int nlocal)
 {
   return (dnum_+1)*npartner_[nlocal] + 2;
 }
+
+/* ----------------------------------------------------------------------
+   find history entries that form 3-vectors, such as shearx/y/z or
+   delta_0/1/2, so they can be rotated when a particle is mapped across
+   the periodic faces of a wedge domain
+   contact positions (surfPos, cp) are rotated as points, all others as
+   directions
+------------------------------------------------------------------------- */
+
+void FixContactHistory::set_history_ids(const std::vector<std::string> &ids)
+{
+  find_history_vectors(ids,history_vec_,history_pos_);
+}
+
+void FixContactHistory::find_history_vectors(const std::vector<std::string> &ids,
+                                             std::vector<int> &vec, std::vector<int> &pos)
+{
+  vec.clear();
+  pos.clear();
+
+  const int n = ids.size();
+  int k = 0;
+  while(k+2 < n)
+  {
+    const std::string &a = ids[k], &b = ids[k+1], &c = ids[k+2];
+    int idiff = -1, ndiff = 0;
+    if(a.size() == b.size() && a.size() == c.size())
+    {
+      for(size_t l = 0; l < a.size(); l++)
+        if(a[l] != b[l] || a[l] != c[l])
+        {
+          idiff = l;
+          ndiff++;
+        }
+    }
+
+    if(1 == ndiff &&
+       ((a[idiff] == 'x' && b[idiff] == 'y' && c[idiff] == 'z') ||
+        (a[idiff] == '0' && b[idiff] == '1' && c[idiff] == '2')))
+    {
+      if(0 == a.compare(0,7,"surfPos") || (3 == a.size() && 0 == a.compare(0,2,"cp")))
+        pos.push_back(k);
+      else
+        vec.push_back(k);
+      k += 3;
+    }
+    else k++;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   rotate all contact histories of owned particle i by sign * wedge angle
+------------------------------------------------------------------------- */
+
+void FixContactHistory::rotate_history(int i, const DomainWedge *dw, int sign)
+{
+  if(history_vec_.empty() && history_pos_.empty())
+    return;
+
+  for(int j = 0; j < npartner_[i]; j++)
+    rotate_history_values(&(contacthistory_[i][j*dnum_]),history_vec_,history_pos_,dw,sign);
+}
+
+void FixContactHistory::rotate_history_values(double *h, const std::vector<int> &vec,
+                                              const std::vector<int> &pos,
+                                              const DomainWedge *dw, int sign)
+{
+  for(size_t k = 0; k < vec.size(); k++)
+    dw->rotate_vector(&h[vec[k]],sign);
+  for(size_t k = 0; k < pos.size(); k++)
+    dw->rotate_point(&h[pos[k]],sign);
+}
@@ -61,6 +61,8 @@ FixStyle(contacthistory,FixContactHistory)
 #include "fix.h"
 #include "my_page.h"
 #include "vector_liggghts.h"
+#include <string>
+#include <vector>
 
 namespace LAMMPS_NS {
 
@@ -109,6 +111,16 @@ class FixContactHistory : public Fix {
   inline int get_dnum()
   { return dnum_; }
 
+  // rotation of vector-valued history entries across periodic wedge faces
+  void set_history_ids(const std::vector<std::string> &ids);
+  void rotate_history(int i, const class DomainWedge *dw, int sign);
+
+  static void find_history_vectors(const std::vector<std::string> &ids,
+                                   std::vector<int> &vec, std::vector<int> &pos);
+  static void rotate_history_values(double *h, const std::vector<int> &vec,
+                                    const std::vector<int> &pos,
+                                    const class DomainWedge *dw, int sign);
+
  protected:
 
   int iarg_;
@@ -131,6 +143,9 @@ class FixContactHistory : public Fix {
   MyPage<int> *ipage_;           // pages of partner atom IDs
   MyPage<double> *dpage_;        // pages of shear history with partners
 
+  std::vector<int> history_vec_; // offsets of direction-valued history triplets
+  std::vector<int> history_pos_; // offsets of position-valued history triplets
+
   virtual void allocate_pages();
 
 };
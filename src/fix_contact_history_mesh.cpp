@@ -425,6 +425,18 @@ void FixContactHistoryMesh::markAllContacts()
     }
 }
 
+/* ----------------------------------------------------------------------
+   keep all contacts of particle i through the next cleanUpContacts()
+------------------------------------------------------------------------- */
+
+void FixContactHistoryMesh::keepContacts(int i)
+{
+    const int nneighs = fix_nneighs_->get_vector_atom_int(i);
+    for(int j = 0; j < nneighs; j++)
+        if(partner_[i][j] > -1)
+            keepflag_[i][j] = true;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixContactHistoryMesh::cleanUpContacts()
@@ -95,6 +95,7 @@ class FixContactHistoryMesh : public FixContactHistory {
 
   bool handleContact(int iPart, int idTri, double *&history, bool intersectflag, bool faceflag);
   void markAllContacts();
+  void keepContacts(int i);
   void cleanUpContacts();
   void cleanUpContactJumps();
   
@@ -371,6 +371,11 @@ void FixContactPropertyAtom::do_forward_comm()
     timer->stamp(TIME_COMM);
 }
 
+void FixContactPropertyAtom::queue_forward_comm()
+{
+    comm->queue_forward_comm_fix(this,1);
+}
+
 /* ---------------------------------------------------------------------- */
 
 int FixContactPropertyAtom::pack_comm(int n, int *list, double *buf,
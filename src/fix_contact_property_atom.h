@@ -93,6 +93,9 @@ class FixContactPropertyAtom : public FixContactHistory {
 
   void do_forward_comm();
 
+  // queue for aggregated comm, done at next comm->flush_forward_comm_fix()
+  void queue_forward_comm();
+
   virtual class FixMeshSurface* getMesh() const
   { return NULL; }
 
@@ -73,6 +73,12 @@ FixContinuumWeighted::FixContinuumWeighted(LAMMPS *lmp, int narg, char **arg) :
     fix_strain_(NULL),
     fix_cont_vars_(NULL),
     fix_contact_forces_(NULL),
+    phi_table_(NULL),
+    inv_table_dr_(0.0),
+    maxcontact_(0),
+    contact_dyad_(NULL),
+    contact_stamp_(NULL),
+    contact_lower_(NULL),
     compute_stress(false),
     compute_strain(false),
     kernel_type(TOP_HAT)
@@ -147,7 +153,12 @@ FixContinuumWeighted::FixContinuumWeighted(LAMMPS *lmp, int narg, char **arg) :
 /* ---------------------------------------------------------------------- */
 
 FixContinuumWeighted::~FixContinuumWeighted()
-{ }
+{
+    memory->destroy(phi_table_);
+    memory->destroy(contact_dyad_);
+    memory->destroy(contact_stamp_);
+    memory->destroy(contact_lower_);
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -268,6 +279,23 @@ void FixContinuumWeighted::init()
         }
     }
 
+    build_kernel_table();
+}
+
+/* ----------------------------------------------------------------------
+   tabulate phi over [0, kernel_radius], so the line integrals of the
+   contact and wall stress do not evaluate the kernel per sample
+------------------------------------------------------------------------- */
+
+void FixContinuumWeighted::build_kernel_table()
+{
+    if (!phi_table_)
+        memory->create(phi_table_,KERNEL_TABLE_SIZE+1,"continuum/weighted:phi_table_");
+
+    const double dr = kernel_radius_/KERNEL_TABLE_SIZE;
+    inv_table_dr_ = 1.0/dr;
+    for (int n = 0; n <= KERNEL_TABLE_SIZE; n++)
+        phi_table_[n] = get_phi(n*dr);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -382,15 +410,24 @@ inline double FixContinuumWeighted::integrate_phi(const double *const xij, const
     double integral = 0.0;
     for (int i = 0; i <= 10; i++)
     {
-        const double t = -(double)i/10.0*length;
+        const double t = -(a + (double)i/10.0*length);
         double r[3];
         vectorAddMultiple3D(xij, t, nkj, r);
-        const double dist = vectorMag3D(r);
-        integral += get_phi(dist);
+        integral += get_phi_tabulated(vectorMag3D(r));
     }
     return integral / 11.0 * length;
 }
 
+inline double FixContinuumWeighted::get_phi_tabulated(const double r)
+{
+    const double s = r*inv_table_dr_;
+    if (s >= KERNEL_TABLE_SIZE)
+        return get_phi(r);
+    const int n = static_cast<int>(s);
+    const double frac = s - n;
+    return phi_table_[n] + frac*(phi_table_[n+1] - phi_table_[n]);
+}
+
 inline double FixContinuumWeighted::get_phi(const double r)
 {
     if (kernel_type == TOP_HAT)
@@ -425,9 +462,11 @@ void FixContinuumWeighted::post_integrate()
     const double *const mass = atom->rmass;
     const int *const mask = atom->mask;
     const int nlocal = atom->nlocal;
+    const int nall = nlocal + atom->nghost;
 
     double **cont_vars = fix_cont_vars_->array_atom;
     double **strain = fix_strain_->array_atom;
+    double **stress = fix_stress_->array_atom;
 
     NeighList *list = pairgran_->list;
     const int inum = list->inum;
@@ -439,10 +478,13 @@ void FixContinuumWeighted::post_integrate()
         vectorZeroizeN(cont_vars[ii],7);
     if (compute_strain)
     {
-        for (int i = 0; i < nlocal + atom->nghost; i++)
+        for (int i = 0; i < nlocal; i++)
             vectorZeroizeN(strain[i], 9);
     }
 
+    // pass 1: density, momentum density and strain sums
+    // each pair of the half list is visited once, contributions are added to both partners
+
     for (int ii = 0; ii < inum; ii++) {
         int i = ilist[ii];
         if (!(mask[i] & groupbit)) continue;
@@ -464,13 +506,12 @@ void FixContinuumWeighted::post_integrate()
             const double xij[3] = {xi - x[j][0], yi - x[j][1], zi - x[j][2]};
             const double sqDist = vectorMag3DSquared(xij);
 
-            // assuming top hat kernel
+            // all kernels are scaled so that they are either 0 or can be cut off (Gaussian) at kernel_radius_
             if (sqDist < kernel_sqRadius_) {
                 const double mj = mass[j];
                 const double dist = sqrt(sqDist);
                 const double phi = get_phi(dist);
                 const double rhoj = mj*phi;
-                const double grad_phi = get_grad_phi(dist);
                 const double vxj = v[j][0];
                 const double vyj = v[j][1];
                 const double vzj = v[j][2];
@@ -478,6 +519,7 @@ void FixContinuumWeighted::post_integrate()
                 cont_vars[i][1] += rhoj*vyj;
                 cont_vars[i][2] += rhoj*vzj;
                 cont_vars[i][3] += rhoj;
+                const double grad_phi = compute_strain ? get_grad_phi(dist) : 0.0;
                 if (compute_strain)
                 {
                     const double gradrhoj = mj*grad_phi;
@@ -537,61 +579,71 @@ void FixContinuumWeighted::post_integrate()
                     if (dist < kernel_radius_) {
                         const double rhoi = mi*get_phi(dist);
                         const double gradrhoi = 2.0*mi*get_grad_phi(dist); // 2.0 again for same reason
-                        fflush(stdout);
                         cont_vars[i][0] += rhoi*vel[0]; // vel of wall
                         cont_vars[i][1] += rhoi*vel[1];
                         cont_vars[i][2] += rhoi*vel[2];
                         cont_vars[i][3] += rhoi;
-                        if (compute_strain)
-                        {
-                            cont_vars[i][4] += gradrhoi*pos[0];
-                            cont_vars[i][5] += gradrhoi*pos[1];
-                            cont_vars[i][6] += gradrhoi*pos[2];
-                            strain[i][0] += gradrhoi*pos[0]*vel[0];
-                            strain[i][1] += gradrhoi*pos[1]*vel[0];
-                            strain[i][2] += gradrhoi*pos[2]*vel[0];
-                            strain[i][3] += gradrhoi*pos[0]*vel[1];
-                            strain[i][4] += gradrhoi*pos[1]*vel[1];
-                            strain[i][5] += gradrhoi*pos[2]*vel[1];
-                            strain[i][6] += gradrhoi*pos[0]*vel[2];
-                            strain[i][7] += gradrhoi*pos[1]*vel[2];
-                            strain[i][8] += gradrhoi*pos[2]*vel[2];
-                        }
+                        cont_vars[i][4] += gradrhoi*pos[0];
+                        cont_vars[i][5] += gradrhoi*pos[1];
+                        cont_vars[i][6] += gradrhoi*pos[2];
+                        strain[i][0] += gradrhoi*pos[0]*vel[0];
+                        strain[i][1] += gradrhoi*pos[1]*vel[0];
+                        strain[i][2] += gradrhoi*pos[2]*vel[0];
+                        strain[i][3] += gradrhoi*pos[0]*vel[1];
+                        strain[i][4] += gradrhoi*pos[1]*vel[1];
+                        strain[i][5] += gradrhoi*pos[2]*vel[1];
+                        strain[i][6] += gradrhoi*pos[0]*vel[2];
+                        strain[i][7] += gradrhoi*pos[1]*vel[2];
+                        strain[i][8] += gradrhoi*pos[2]*vel[2];
                     }
                 }
             }
         }
     }
 
-    // communicate results to ghosts
-    fix_cont_vars_->do_forward_comm();
-
-    // compute actual average velocity
-    for (int i = 0; i < nlocal + atom->nghost; i++)
+    // compute actual average velocity of owned particles
+    // and communicate results to ghosts
+    for (int i = 0; i < nlocal; i++)
         vectorScalarDiv3D(cont_vars[i], cont_vars[i][3]);
-
-    double **stress = fix_stress_->array_atom;
+    fix_cont_vars_->do_forward_comm();
 
     const double dt = update->dt;
 
-    const int *const tag = atom->tag;
-
     if (compute_stress)
     {
-        for (int i = 0; i < nlocal + atom->nghost; i++)
+        for (int i = 0; i < nall; i++)
             vectorZeroizeN(stress[i], 9);
     }
+
+    // pass 2: kinetic, wall and contact stress, strain normalization
+
     for (int ii = 0; ii < inum; ii++) {
         int i = ilist[ii];
-        if (!(mask[i] & groupbit)) continue;
+
+        if (compute_strain)
+        {
+            const double rho = cont_vars[i][3];
+            const double inv2Rho = 0.5/rho;
+            const double pDivRho[3] = {cont_vars[i][0], cont_vars[i][1], cont_vars[i][2]}; // momentum density was already divided by rho before
+            const double gradRho[3] = {cont_vars[i][4], cont_vars[i][5], cont_vars[i][6]};
+            strain[i][0] = dt*(strain[i][0] - pDivRho[0]*gradRho[0])*inv2Rho;
+            strain[i][1] = dt*(strain[i][1] - pDivRho[0]*gradRho[1])*inv2Rho;
+            strain[i][2] = dt*(strain[i][2] - pDivRho[0]*gradRho[2])*inv2Rho;
+            strain[i][3] = dt*(strain[i][3] - pDivRho[1]*gradRho[0])*inv2Rho;
+            strain[i][4] = dt*(strain[i][4] - pDivRho[1]*gradRho[1])*inv2Rho;
+            strain[i][5] = dt*(strain[i][5] - pDivRho[1]*gradRho[2])*inv2Rho;
+            strain[i][6] = dt*(strain[i][6] - pDivRho[2]*gradRho[0])*inv2Rho;
+            strain[i][7] = dt*(strain[i][7] - pDivRho[2]*gradRho[1])*inv2Rho;
+            strain[i][8] = dt*(strain[i][8] - pDivRho[2]*gradRho[2])*inv2Rho;
+        }
+
+        if (!compute_stress || !(mask[i] & groupbit)) continue;
+
         const double xi[3] = {x[i][0], x[i][1], x[i][2]};
         const double vi[3] = {v[i][0], v[i][1], v[i][2]};
         const double mi = mass[i];
         const int *jlist = firstneigh[i];
         const int jnum = numneigh[i];
-        const int tag_i = tag[i];
-
-        std::set<int> i_contacts;
 
         // standard neighbor loop
         for (int jj = -1; jj < jnum; jj++) {
@@ -599,19 +651,15 @@ void FixContinuumWeighted::post_integrate()
             if (!(mask[j] & groupbit)) continue;
 
             // compute particle distance
-            const double xj[3] = {x[j][0], x[j][1], x[j][2]};
-            const double xij[3] = {xi[0] - xj[0], xi[1] - xj[1], xi[2] - xj[2]};
-            const double vj[3] = {v[j][0], v[j][1], v[j][2]};
+            const double xij[3] = {xi[0] - x[j][0], xi[1] - x[j][1], xi[2] - x[j][2]};
             const double sqDist = vectorMag3DSquared(xij);
 
-            // all kernels are scaled so that they are either 0 or can be cut off (Gaussian) at kernel_radius_
-            if (compute_stress && sqDist < kernel_sqRadius_) {
-                const double vpxj = vj[0]-cont_vars[i][0];
-                const double vpyj = vj[1]-cont_vars[i][1];
-                const double vpzj = vj[2]-cont_vars[i][2];
-                const double mj = mass[j];
-                const double phi = get_phi(sqDist);
-                const double phi_mj = mj*phi;
+            if (sqDist < kernel_sqRadius_) {
+                const double vpxj = v[j][0] - cont_vars[i][0];
+                const double vpyj = v[j][1] - cont_vars[i][1];
+                const double vpzj = v[j][2] - cont_vars[i][2];
+                const double phi = get_phi(sqrt(sqDist));
+                const double phi_mj = mass[j]*phi;
                 // j -> i
                 stress[i][0] -= vpxj * vpxj * phi_mj;
                 stress[i][1] -= vpxj * vpyj * phi_mj;
@@ -641,141 +689,180 @@ void FixContinuumWeighted::post_integrate()
             }
 
             // compute wall contribution
-            if (compute_stress)
+            std::vector<FixContactPropertyAtom *>::iterator it;
+            for (it = fix_wall_contact_forces_vector_.begin(); it < fix_wall_contact_forces_vector_.end(); it++)
             {
-                std::vector<FixContactPropertyAtom *>::iterator it;
-                for (it = fix_wall_contact_forces_vector_.begin(); it < fix_wall_contact_forces_vector_.end(); it++)
+                int n_contacts = (*it)->n_partner(j);
+                for (int k = 0; k < n_contacts; k++)
+                {
+                    const double *const force_pos_jk = (*it)->contacthistory(j, k);
+                    const double integralVal_ijk = compute_line_sphere_intersection(xij, &(force_pos_jk[3]));
+                    add_dyad(stress[i], force_pos_jk, &(force_pos_jk[3]), integralVal_ijk);
+                }
+                if (jj != -1)
                 {
-                    int n_contacts = (*it)->n_partner(j);
+                    const double xji[3] = {-xij[0], -xij[1], -xij[2]};
+                    n_contacts = (*it)->n_partner(i);
                     for (int k = 0; k < n_contacts; k++)
                     {
-                        const double *const force_pos_jk = (*it)->contacthistory(j, k);
-                        const double integralVal_ijk = compute_line_sphere_intersection(xij, &(force_pos_jk[3]));
-                        stress[i][0] -= force_pos_jk[0]*force_pos_jk[3]*integralVal_ijk;
-                        stress[i][1] -= force_pos_jk[0]*force_pos_jk[4]*integralVal_ijk;
-                        stress[i][2] -= force_pos_jk[0]*force_pos_jk[5]*integralVal_ijk;
-                        stress[i][3] -= force_pos_jk[1]*force_pos_jk[3]*integralVal_ijk;
-                        stress[i][4] -= force_pos_jk[1]*force_pos_jk[4]*integralVal_ijk;
-                        stress[i][5] -= force_pos_jk[1]*force_pos_jk[5]*integralVal_ijk;
-                        stress[i][6] -= force_pos_jk[2]*force_pos_jk[3]*integralVal_ijk;
-                        stress[i][7] -= force_pos_jk[2]*force_pos_jk[4]*integralVal_ijk;
-                        stress[i][8] -= force_pos_jk[2]*force_pos_jk[5]*integralVal_ijk;
-                    }
-                    if (jj != -1)
-                    {
-                        int n_contacts = (*it)->n_partner(i);
-                        for (int k = 0; k < n_contacts; k++)
-                        {
-                            const double *const force_pos_ik = (*it)->contacthistory(i, k);
-                            const double xji[3] = {-xij[0], -xij[1], -xij[2]};
-                            const double integralVal_jik = compute_line_sphere_intersection(xji, &(force_pos_ik[3]));
-                            stress[j][0] -= force_pos_ik[0]*force_pos_ik[3]*integralVal_jik;
-                            stress[j][1] -= force_pos_ik[0]*force_pos_ik[4]*integralVal_jik;
-                            stress[j][2] -= force_pos_ik[0]*force_pos_ik[5]*integralVal_jik;
-                            stress[j][3] -= force_pos_ik[1]*force_pos_ik[3]*integralVal_jik;
-                            stress[j][4] -= force_pos_ik[1]*force_pos_ik[4]*integralVal_jik;
-                            stress[j][5] -= force_pos_ik[1]*force_pos_ik[5]*integralVal_jik;
-                            stress[j][6] -= force_pos_ik[2]*force_pos_ik[3]*integralVal_jik;
-                            stress[j][7] -= force_pos_ik[2]*force_pos_ik[4]*integralVal_jik;
-                            stress[j][8] -= force_pos_ik[2]*force_pos_ik[5]*integralVal_jik;
-                        }
+                        const double *const force_pos_ik = (*it)->contacthistory(i, k);
+                        const double integralVal_jik = compute_line_sphere_intersection(xji, &(force_pos_ik[3]));
+                        add_dyad(stress[j], force_pos_ik, &(force_pos_ik[3]), integralVal_jik);
                     }
                 }
             }
 
         } // end loop j neighbors
 
-        // contactproperty atom loop
-        for (int jj = 0; jj < fix_contact_forces_->get_npartners(i); jj++)
+        contact_stress(i);
+    }
+
+    // reverse communicate results, i.e. add contributions from neib procs together
+    // here neib procs only compute the contributions occuring from contacts with both
+    // grains on another proc.
+    if (compute_stress)
+        fix_stress_->do_reverse_comm();
+}
+
+/* ----------------------------------------------------------------------
+   contact part of the stress for all contacts of owned particle i
+   every contact i-k is read once and its 1/2 f_ik (x) r_ik dyad is built
+   once, it is then spread to the contact partners j of i (the grid points)
+   through the tabulated line integral of the kernel
+   a contact i-k that is also seen from k because j touches both i and k
+   is only added once (from the particle with the lower tag)
+------------------------------------------------------------------------- */
+
+void FixContinuumWeighted::contact_stress(const int i)
+{
+    const int npartner = fix_contact_forces_->get_npartners(i);
+    if (npartner == 0)
+        return;
+
+    const double *const *const x = atom->x;
+    const int *const tag = atom->tag;
+    double **stress = fix_stress_->array_atom;
+    const int tag_i = tag[i];
+
+    if (npartner > maxcontact_)
+    {
+        maxcontact_ = npartner;
+        memory->grow(contact_dyad_,maxcontact_,12,"continuum/weighted:contact_dyad_");
+        memory->grow(contact_stamp_,maxcontact_,"continuum/weighted:contact_stamp_");
+        memory->grow(contact_lower_,maxcontact_,2,"continuum/weighted:contact_lower_");
+    }
+
+    // gather the contacts of i that carry a force
+
+    int ncontact = 0;
+    int nlower = 0;
+    double maxSqLen = 0.0;
+    for (int kk = 0; kk < npartner; kk++)
+    {
+        const double *const force_pos_ik = fix_contact_forces_->contacthistory(i, kk);
+        if (vectorMag3DSquared(force_pos_ik) < 1e-6)
+            continue;
+
+        const int k = (int)force_pos_ik[3];
+        double *const dyad = contact_dyad_[ncontact];
+        double *const xik = &(dyad[9]);
+        vectorSubtract3D(x[i], x[k], xik);
+        for (int a = 0; a < 3; a++)
+            for (int b = 0; b < 3; b++)
+                dyad[3*a+b] = 0.5*force_pos_ik[a]*xik[b]; // 1/2 f_ik (x) r_ik
+        maxSqLen = fmax(maxSqLen, vectorMag3DSquared(xik));
+
+        const int tag_k = fix_contact_forces_->partner(i, kk);
+        if (tag_k < tag_i)
         {
-            const double *const force_pos_ij = fix_contact_forces_->contacthistory(i, jj);
-            const int j = (int)force_pos_ij[3];
-            i_contacts.insert(tag[j]);
+            contact_lower_[nlower][0] = tag_k;
+            contact_lower_[nlower][1] = ncontact;
+            nlower++;
         }
+        contact_stamp_[ncontact] = -1;
+        ncontact++;
+    }
+    if (ncontact == 0)
+        return;
 
-        if (compute_stress)
-        {
-            // contactproperty atom loop
-            for (int jj = 0; jj < fix_contact_forces_->get_npartners(i); jj++)
-            {
-                const double *const force_pos_ij = fix_contact_forces_->contacthistory(i, jj);
-                const int j = (int)force_pos_ij[3];
-                const double xji[3] = {x[j][0] - xi[0], x[j][1] - xi[1], x[j][2] - xi[2]};
-                const double sqDistji = vectorMag3DSquared(xji);
+    sort_contact_lower(nlower);
 
-                if (!compute_stress && sqDistji > kernel_sqRadius_)
-                    continue;
+    // a grid point j further away than kernel radius + longest contact of i
+    // cannot intersect with any contact segment of i
+    const double cullDist = kernel_radius_ + sqrt(maxSqLen);
+    const double cullSqDist = cullDist*cullDist;
 
-                std::set<int> skip_contacts;
-                for (int ll = 0; ll < fix_contact_forces_->get_npartners(j); ll++)
-                {
-                    const double *const force_pos_jl = fix_contact_forces_->contacthistory(j, ll);
-                    const int l = (int)force_pos_jl[3];
-                    const int tag_l = tag[l];
-                    if (tag_l < tag_i && i_contacts.find(tag_l) != i_contacts.end())
-                        skip_contacts.insert(tag_l);
-                }
+    for (int jj = 0; jj < npartner; jj++)
+    {
+        const int j = (int)fix_contact_forces_->contacthistory(i, jj)[3];
+        const double xji[3] = {x[j][0] - x[i][0], x[j][1] - x[i][1], x[j][2] - x[i][2]};
+        if (vectorMag3DSquared(xji) > cullSqDist)
+            continue;
+
+        // flag contacts i-l where j is in contact with l as well and l has the lower tag
+        const int npartner_j = fix_contact_forces_->get_npartners(j);
+        for (int ll = 0; ll < npartner_j; ll++)
+        {
+            const int tag_l = fix_contact_forces_->partner(j, ll);
+            if (tag_l >= tag_i)
+                continue;
+            const int ilower = find_contact_lower(nlower, tag_l);
+            if (ilower >= 0)
+                contact_stamp_[contact_lower_[ilower][1]] = jj;
+        }
 
-                for (int kk = 0; kk < fix_contact_forces_->get_npartners(i); kk++)
-                {
-                    const double *const force_pos_ik = fix_contact_forces_->contacthistory(i, kk);
-                    const int k = (int)force_pos_ik[3];
-                    const int tag_k = tag[k];
-                    const double xik[3] = {xi[0] - x[k][0], xi[1] - x[k][1], xi[2] - x[k][2]};
-
-                    if (skip_contacts.find(tag_k) != skip_contacts.end())
-                        continue;
-
-                    // stress contribution
-                    // check if forces are actually present between those two particles, if not go to next contact
-                    const double absForces = vectorMag3DSquared(force_pos_ik);
-                    if (absForces < 1e-6)
-                        continue;
-
-                    const double integralVal_ijk = 0.5*compute_line_sphere_intersection(xji, xik);
-                    if (integralVal_ijk > 1e-6)
-                    {
-                        stress[j][0] -= force_pos_ik[0]*xik[0]*integralVal_ijk; // - 1/2 f_ij (x) r_ij * integral
-                        stress[j][1] -= force_pos_ik[0]*xik[1]*integralVal_ijk;
-                        stress[j][2] -= force_pos_ik[0]*xik[2]*integralVal_ijk;
-                        stress[j][3] -= force_pos_ik[1]*xik[0]*integralVal_ijk;
-                        stress[j][4] -= force_pos_ik[1]*xik[1]*integralVal_ijk;
-                        stress[j][5] -= force_pos_ik[1]*xik[2]*integralVal_ijk;
-                        stress[j][6] -= force_pos_ik[2]*xik[0]*integralVal_ijk;
-                        stress[j][7] -= force_pos_ik[2]*xik[1]*integralVal_ijk;
-                        stress[j][8] -= force_pos_ik[2]*xik[2]*integralVal_ijk;
-                    }
-                }
+        for (int kk = 0; kk < ncontact; kk++)
+        {
+            if (contact_stamp_[kk] == jj)
+                continue;
+
+            const double *const dyad = contact_dyad_[kk];
+            const double integralVal_ijk = compute_line_sphere_intersection(xji, &(dyad[9]));
+            if (0.5*integralVal_ijk > 1e-6)
+            {
+                for (int n = 0; n < 9; n++)
+                    stress[j][n] -= dyad[n]*integralVal_ijk;
             }
         }
-
     }
+}
 
-    for (int ii = 0; ii < inum; ii++) {
-        int i = ilist[ii];
-        //if(tag[i] == 87) printf("stress[i][0]: %e %d\n", stress[i][0], update->ntimestep);
-        if (compute_strain)
-        {
-            const double rho = cont_vars[i][3];
-            const double inv2Rho = 0.5/rho;
-            const double pDivRho[3] = {cont_vars[i][0], cont_vars[i][1], cont_vars[i][2]}; // momentum density was already divided by rho before
-            const double gradRho[3] = {cont_vars[i][4], cont_vars[i][5], cont_vars[i][6]};
-            strain[i][0] = dt*(strain[i][0] - pDivRho[0]*gradRho[0])*inv2Rho;
-            strain[i][1] = dt*(strain[i][1] - pDivRho[0]*gradRho[1])*inv2Rho;
-            strain[i][2] = dt*(strain[i][2] - pDivRho[0]*gradRho[2])*inv2Rho;
-            strain[i][3] = dt*(strain[i][3] - pDivRho[1]*gradRho[0])*inv2Rho;
-            strain[i][4] = dt*(strain[i][4] - pDivRho[1]*gradRho[1])*inv2Rho;
-            strain[i][5] = dt*(strain[i][5] - pDivRho[1]*gradRho[2])*inv2Rho;
-            strain[i][6] = dt*(strain[i][6] - pDivRho[2]*gradRho[0])*inv2Rho;
-            strain[i][7] = dt*(strain[i][7] - pDivRho[2]*gradRho[1])*inv2Rho;
-            strain[i][8] = dt*(strain[i][8] - pDivRho[2]*gradRho[2])*inv2Rho;
+/* ----------------------------------------------------------------------
+   lookup of (tag, contact index) pairs, kept sorted by tag
+   contact lists are short, so insertion sort is used
+------------------------------------------------------------------------- */
 
+void FixContinuumWeighted::sort_contact_lower(const int n)
+{
+    for (int a = 1; a < n; a++)
+    {
+        const int t0 = contact_lower_[a][0];
+        const int t1 = contact_lower_[a][1];
+        int b = a - 1;
+        while (b >= 0 && contact_lower_[b][0] > t0)
+        {
+            contact_lower_[b+1][0] = contact_lower_[b][0];
+            contact_lower_[b+1][1] = contact_lower_[b][1];
+            b--;
         }
+        contact_lower_[b+1][0] = t0;
+        contact_lower_[b+1][1] = t1;
     }
+}
 
-    // reverse communicate results, i.e. add contributions from neib procs together
-    // here neib procs only compute the contributions occuring from contacts with both
-    // grains on another proc.
-    if (compute_stress)
-        fix_stress_->do_reverse_comm();
+int FixContinuumWeighted::find_contact_lower(const int n, const int tag_l) const
+{
+    int lo = 0;
+    int hi = n - 1;
+    while (lo <= hi)
+    {
+        const int mid = (lo + hi) / 2;
+        if (contact_lower_[mid][0] == tag_l)
+            return mid;
+        else if (contact_lower_[mid][0] < tag_l)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return -1;
 }
@@ -87,6 +87,29 @@ class FixContinuumWeighted : public Fix {
     class FixPropertyAtom *fix_cont_vars_;
     class FixContactPropertyAtom *fix_contact_forces_;
     std::vector<FixContactPropertyAtom *> fix_wall_contact_forces_vector_;
+
+    // kernel phi tabulated over the distance [0, kernel_radius_]
+    static const int KERNEL_TABLE_SIZE = 2048;
+    double *phi_table_;
+    double inv_table_dr_;
+
+    // per-particle contact scratch: 1/2 f (x) r dyad + r, stamps, (tag, index) of lower-tag partners
+    int maxcontact_;
+    double **contact_dyad_;
+    int *contact_stamp_;
+    int **contact_lower_;
+
+    void build_kernel_table();
+    inline double get_phi_tabulated(const double r);
+    void contact_stress(const int i);
+    void sort_contact_lower(const int n);
+    int find_contact_lower(const int n, const int tag_l) const;
+    inline void add_dyad(double *const s, const double *const f, const double *const r, const double w)
+    {
+        s[0] -= f[0]*r[0]*w; s[1] -= f[0]*r[1]*w; s[2] -= f[0]*r[2]*w;
+        s[3] -= f[1]*r[0]*w; s[4] -= f[1]*r[1]*w; s[5] -= f[1]*r[2]*w;
+        s[6] -= f[2]*r[0]*w; s[7] -= f[2]*r[1]*w; s[8] -= f[2]*r[2]*w;
+    }
     double integrate_phi(const double *const xij, const double *const nkj, const double a, const double b);
     template<kernel_type_t kernel_type> double weightingFunction(const double r);
     template<kernel_type_t kernel_type> double gradWeightingFunction(const double r);
@@ -74,6 +74,7 @@ FixFreeze::FixFreeze(LAMMPS *lmp, int narg, char **arg) :
   force_flag = 0;
   foriginal[0] = foriginal[1] = foriginal[2] = 0.0;
   fix_Ksl_ = NULL;
+  skip_step_ = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -129,6 +130,9 @@ void FixFreeze::post_force(int vflag)
   foriginal[0] = foriginal[1] = foriginal[2] = 0.0;
   force_flag = 0;
 
+  // forces are zeroed by fused integrator, which also tallies foriginal
+  if (skip_step_ == update->ntimestep && !update->setupflag) return;
+
   for (int i = 0; i < nlocal; i++)
     if (mask[i] & groupbit) 
     {
@@ -152,6 +156,16 @@ void FixFreeze::post_force(int vflag)
   }
 }
 
+/* ----------------------------------------------------------------------
+   true if zeroing of forces can be done by a fused integrator
+   not possible if forces are scaled via the Ksl property
+------------------------------------------------------------------------- */
+
+bool FixFreeze::fusable()
+{
+  return !fix_Ksl_;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixFreeze::post_force_respa(int vflag, int ilevel, int iloop)
@@ -66,11 +66,20 @@ class FixFreeze : public Fix {
   void post_force_respa(int, int, int);
   double compute_vector(int);
 
+  // fused integration via fix nve/sphere
+  bool fusable();
+  void skip_post_force(bigint step) { skip_step_ = step; }
+  inline void add_foriginal(const double *f)
+  { foriginal[0] += f[0]; foriginal[1] += f[1]; foriginal[2] += f[2]; }
+
  protected:
   class FixPropertyAtom* fix_Ksl_;
  private:
   int force_flag;
   double foriginal[3],foriginal_all[3];
+
+  // step for which particle loop is done by fused integrator
+  bigint skip_step_;
 };
 
 }
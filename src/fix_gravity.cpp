@@ -173,6 +173,7 @@ FixGravity::FixGravity(LAMMPS *lmp, int narg, char **arg) :
   egrav = 0.0;
 
   fm = NULL; 
+  skip_step_ = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -316,6 +317,12 @@ void FixGravity::post_force(int vflag)
     set_acceleration();
   }
 
+  eflag = 0;
+  egrav = 0.0;
+
+  // force and energy are added by fused integrator
+  if (skip_step_ == update->ntimestep && !update->setupflag) return;
+
   double **x = atom->x;
   double **f = atom->f;
   double *rmass = atom->rmass;
@@ -325,9 +332,6 @@ void FixGravity::post_force(int vflag)
   int nlocal = atom->nlocal;
   double massone;
 
-  eflag = 0;
-  egrav = 0.0;
-
   if (rmass) {
     for (int i = 0; i < nlocal; i++)
       if ((mask[i] & groupbit) && (!fm || (fm && fm->belongs_to(i) < 0))) { 
@@ -349,6 +353,16 @@ void FixGravity::post_force(int vflag)
   }
 }
 
+/* ----------------------------------------------------------------------
+   true if gravity force can be added by a fused integrator
+   not possible if mass is modified per particle or energy is tallied
+------------------------------------------------------------------------- */
+
+bool FixGravity::fusable()
+{
+  return !fm && !fix_relax && !thermo_energy && atom->rmass;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixGravity::post_force_respa(int vflag, int ilevel, int iloop)
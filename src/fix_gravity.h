@@ -77,6 +77,14 @@ class FixGravity : public Fix {
 
   void get_gravity(double*); 
 
+  // fused integration via fix nve/sphere
+  bool fusable();
+  void skip_post_force(bigint step) { skip_step_ = step; }
+  inline void get_acceleration(double &xa,double &ya,double &za)
+  { xa = xacc; ya = yacc; za = zacc; }
+  inline void add_egrav(double e)
+  { egrav += e; }
+
  protected:
   int style;
   double magnitude;
@@ -97,6 +105,9 @@ class FixGravity : public Fix {
   void set_acceleration();
   class FixMultisphere *fm;
   class FixRelaxContacts *fix_relax;
+
+  // step for which particle loop is done by fused integrator
+  bigint skip_step_;
 };
 
 }
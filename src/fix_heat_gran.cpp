@@ -213,8 +213,8 @@ void FixHeatGran::initial_integrate(int vflag)
      }
   }
 
-  //update ghosts
-  fix_directionalHeatFlux->do_forward_comm();
+  //update ghosts before the force computation
+  fix_directionalHeatFlux->queue_forward_comm();
 }
 
 /* ---------------------------------------------------------------------- */
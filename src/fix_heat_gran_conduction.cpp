@@ -42,6 +42,7 @@
 #include "fix_heat_gran_conduction.h"
 
 #include "atom.h"
+#include "comm.h"
 #include "compute_pair_gran_local.h"
 #include "fix_property_atom.h"
 #include "fix_property_global.h"
@@ -527,10 +528,20 @@ void FixHeatGranCond::post_force_eval(int vflag,int cpl_flag)
 
   if(newton_pair)
   {
-    fix_heatFlux->do_reverse_comm();
-    fix_directionalHeatFlux->do_reverse_comm();
-    fix_conduction_contact_area_->do_reverse_comm();
-    fix_n_conduction_contacts_->do_reverse_comm();
+    fix_heatFlux->queue_reverse_comm();
+    fix_directionalHeatFlux->queue_reverse_comm();
+    if(store_contact_data_)
+    {
+        fix_conduction_contact_area_->queue_reverse_comm();
+        fix_n_conduction_contacts_->queue_reverse_comm();
+    }
+
+    // summed values are needed right away for the contact area average
+    // and by the compute evaluation, otherwise comm is done at the sync
+    // point of the integrator before final_integrate()
+
+    if(cpl_flag || store_contact_data_)
+        comm->flush_reverse_comm_fix();
   }
 
   if(!cpl_flag && store_contact_data_)
@@ -583,6 +583,8 @@ void FixInsert::reset_timestep(bigint newstep,bigint oldstep)
 {
     
     next_reneighbor += (newstep-oldstep);
+    if(most_recent_ins_step >= 0)
+        most_recent_ins_step += (newstep-oldstep);
     
 }
 
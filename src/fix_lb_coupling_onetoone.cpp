@@ -165,8 +165,9 @@ namespace LAMMPS_NS {
   }
   void FixLbCouplingOnetoone::comm_force_torque()
   {
-    fix_dragforce_->do_reverse_comm();
-    fix_hdtorque_->do_reverse_comm();
+    fix_dragforce_->queue_reverse_comm();
+    fix_hdtorque_->queue_reverse_comm();
+    comm->flush_reverse_comm_fix();
   }
 
 }; /* LAMMPS_NS */
@@ -54,6 +54,7 @@
 #include "fix_neighlist_mesh.h"
 #include "fix_multisphere.h"
 #include "fix_property_atom.h"
+#include "fix_insert_stream.h"
 #include "mpi_liggghts.h"
 #include "math_extra_liggghts.h"
 #include "fix_massflow_mesh.h"
@@ -90,7 +91,12 @@ FixMassflowMesh::FixMassflowMesh(LAMMPS *lmp, int narg, char **arg) :
   nparticles_last_(0.),
   t_count_(0.),
   delta_t_(0.),
-  reset_t_count_(true)
+  reset_t_count_(true),
+  fix_ins_stream_(0),
+  n_bins_residence_(0),
+  binwidth_residence_(0.),
+  hist_residence_n_(0),
+  hist_residence_mass_(0)
 {
     vectorZeroize3D(nvec_);
     vectorZeroize3D(pref_);
@@ -100,6 +106,7 @@ FixMassflowMesh::FixMassflowMesh(LAMMPS *lmp, int narg, char **arg) :
     // parse args for this class
 
     iarg_ = 3;
+    int nevery_residence = 1000;
 
     bool hasargs = true;
     while(iarg_ < narg && hasargs)
@@ -200,6 +207,26 @@ FixMassflowMesh::FixMassflowMesh(LAMMPS *lmp, int narg, char **arg) :
             else error->all(FLERR,"Illegal delete command");
             iarg_ += 2;
             hasargs = true;
+        } else if (strcmp(arg[iarg_],"residence_time") == 0) {
+            if(narg < iarg_+4)
+                error->fix_error(FLERR,this,"not enough arguments for 'residence_time'");
+            fix_ins_stream_ = static_cast<FixInsertStream*>(modify->find_fix_id_style(arg[iarg_+1],"insert/stream"));
+            if(!fix_ins_stream_)
+                error->fix_error(FLERR,this,"fix insert/stream ID for 'residence_time' does not exist");
+            n_bins_residence_ = atoi(arg[iarg_+2]);
+            binwidth_residence_ = atof(arg[iarg_+3]);
+            if(n_bins_residence_ < 1 || binwidth_residence_ <= 0.)
+                error->fix_error(FLERR,this,"'residence_time' requires nbins > 0 and binwidth > 0");
+            iarg_ += 4;
+            hasargs = true;
+        } else if (strcmp(arg[iarg_],"residence_every") == 0) {
+            if(narg < iarg_+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'residence_every'");
+            nevery_residence = atoi(arg[iarg_+1]);
+            if(nevery_residence < 1)
+                error->fix_error(FLERR,this,"'residence_every' > 0 required");
+            iarg_ += 2;
+            hasargs = true;
         } else if(strcmp(style,"massflow/mesh") == 0)
             error->fix_error(FLERR,this,"unknown keyword");
     }
@@ -233,6 +260,11 @@ FixMassflowMesh::FixMassflowMesh(LAMMPS *lmp, int narg, char **arg) :
     if (!fix_mesh_)
         error->fix_error(FLERR,this,"expecting keyword 'mesh'");
 
+    // end_of_step() is only used for the residence time reduction
+
+    if(fix_ins_stream_)
+        nevery = nevery_residence;
+
     // get reference point on face
     // calculate normalvec
     setRefPoint();
@@ -244,6 +276,19 @@ FixMassflowMesh::FixMassflowMesh(LAMMPS *lmp, int narg, char **arg) :
     if(fix_property_)
         size_vector = 7;
     global_freq = 1; 
+
+    if(fix_ins_stream_)
+    {
+        array_flag = 1;
+        size_array_rows = n_bins_residence_;
+        size_array_cols = 3;
+        extarray = 0;
+
+        memory->create(hist_residence_n_,n_bins_residence_,"massflow/mesh:hist_residence_n_");
+        memory->create(hist_residence_mass_,n_bins_residence_,"massflow/mesh:hist_residence_mass_");
+        vectorZeroizeN(hist_residence_n_,n_bins_residence_);
+        vectorZeroizeN(hist_residence_mass_,n_bins_residence_);
+    }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -252,6 +297,8 @@ FixMassflowMesh::~FixMassflowMesh()
 {
     if(fp_)
         fclose(fp_);
+    memory->destroy(hist_residence_n_);
+    memory->destroy(hist_residence_mass_);
     // do not delete fix_neighlist_, this will be handled by fix mesh/surface itself
     fix_neighlist_ = NULL;
 }
@@ -350,6 +397,7 @@ int FixMassflowMesh::setmask()
     int mask = 0;
     mask |= POST_INTEGRATE;
     if(delete_atoms_) mask |= PRE_EXCHANGE;
+    if(fix_ins_stream_) mask |= END_OF_STEP | POST_RUN;
     return mask;
 }
 
@@ -379,6 +427,8 @@ void FixMassflowMesh::post_integrate()
     double property_this = 0.;
     double deltan;
     int *tag = atom->tag;
+    double **release_data = fix_ins_stream_ ? fix_ins_stream_->fix_prop_release()->array_atom : 0;
+    const int release_step_index = fix_ins_stream_ ? fix_ins_stream_->release_step_index() : 0;
 
     class FixPropertyAtom* fix_color=static_cast<FixPropertyAtom*>(modify->find_fix_property("color","property/atom","scalar",0,0,style,false));
     bool fixColFound = false;
@@ -475,6 +525,16 @@ void FixMassflowMesh::post_integrate()
                         property_this += fix_property_->vector_atom[iPart];
                     }
 
+                    // record residence time since release for particles
+                    // inserted by the fix insert/stream (insertion step > 0)
+                    if(release_data && !compDouble(release_data[iPart][3],0.,1.e-13))
+                    {
+                        const double weight = fix_volumeweight_ms_ ? fix_volumeweight_ms_->vector_atom[iPart] : 1.;
+                        residence_time_local_.push_back(update->dt*(static_cast<double>(update->ntimestep)-release_data[iPart][release_step_index]));
+                        residence_weight_local_.push_back(weight);
+                        residence_mass_local_.push_back(weight*rmass[iPart]);
+                    }
+
                     if(delete_atoms_)
                     {
                         //reset counter to avoid problems with other fixes & mark to be deleted
@@ -535,6 +595,57 @@ void FixMassflowMesh::post_integrate()
 
 }
 
+/* ----------------------------------------------------------------------
+   periodic reduction of the residence time events
+------------------------------------------------------------------------- */
+
+void FixMassflowMesh::end_of_step()
+{
+    reduce_residence_time();
+}
+
+/* ----------------------------------------------------------------------
+   add events buffered since the last reduction to the histogram
+------------------------------------------------------------------------- */
+
+void FixMassflowMesh::post_run()
+{
+    reduce_residence_time();
+}
+
+/* ----------------------------------------------------------------------
+   bin buffered events locally, then sum histograms over procs
+   only the histogram is communicated, never the events themselves
+------------------------------------------------------------------------- */
+
+void FixMassflowMesh::reduce_residence_time()
+{
+    std::vector<double> hist_this(2*n_bins_residence_,0.);
+    const int nevents = residence_time_local_.size();
+
+    for(int i = 0; i < nevents; i++)
+    {
+        // events beyond the last bin are collected in the last bin
+        int ibin = static_cast<int>(residence_time_local_[i]/binwidth_residence_);
+        if(ibin < 0) ibin = 0;
+        if(ibin >= n_bins_residence_) ibin = n_bins_residence_-1;
+        hist_this[ibin] += residence_weight_local_[i];
+        hist_this[n_bins_residence_+ibin] += residence_mass_local_[i];
+    }
+
+    residence_time_local_.clear();
+    residence_weight_local_.clear();
+    residence_mass_local_.clear();
+
+    MPI_Sum_Vector(&hist_this[0],2*n_bins_residence_,world);
+
+    for(int ibin = 0; ibin < n_bins_residence_; ibin++)
+    {
+        hist_residence_n_[ibin] += hist_this[ibin];
+        hist_residence_mass_[ibin] += hist_this[n_bins_residence_+ibin];
+    }
+}
+
 /* ----------------------------------------------------------------------
    perform particle deletion of marked particles
    done before exchange, borders, reneighbor
@@ -594,19 +705,30 @@ void FixMassflowMesh::pre_exchange()
 
 void FixMassflowMesh::write_restart(FILE *fp)
 {
+  // called on all procs, add buffered events before writing the histogram
+
+  if(fix_ins_stream_)
+    reduce_residence_time();
+
   int n = 0;
-  double list[6];
+  std::vector<double> list(7+2*n_bins_residence_);
   list[n++] = mass_;
   list[n++] = t_count_;
   list[n++] = mass_last_;
   list[n++] = nparticles_last_;
   list[n++] = mass_deleted_;
   list[n++] = nparticles_deleted_;
+  list[n++] = static_cast<double>(n_bins_residence_);
+  for(int ibin = 0; ibin < n_bins_residence_; ibin++)
+  {
+    list[n++] = hist_residence_n_[ibin];
+    list[n++] = hist_residence_mass_[ibin];
+  }
 
   if (comm->me == 0) {
     int size = n * sizeof(double);
     fwrite(&size,sizeof(int),1,fp);
-    fwrite(list,sizeof(double),n,fp);
+    fwrite(&list[0],sizeof(double),n,fp);
   }
 }
 
@@ -625,6 +747,28 @@ void FixMassflowMesh::restart(char *buf)
   nparticles_last_ = list[n++];
   mass_deleted_ = list[n++];
   nparticles_deleted_ = list[n++];
+
+  // restart files of older versions only hold the 6 values above
+  // histogram is only restored if the binning did not change
+
+  const int nvalues = modify->restart_data_size_global(this) / static_cast<int>(sizeof(double));
+  if(nvalues < 7)
+    return;
+
+  const int n_bins_restart = static_cast<int>(list[n++]);
+  if(n_bins_restart < 0 || nvalues < 7+2*n_bins_restart)
+    error->all(FLERR,"Fix massflow/mesh: restart data of residence time histogram is incomplete");
+
+  if(fix_ins_stream_ && n_bins_restart == n_bins_residence_)
+  {
+    for(int ibin = 0; ibin < n_bins_residence_; ibin++)
+    {
+      hist_residence_n_[ibin] = list[n++];
+      hist_residence_mass_[ibin] = list[n++];
+    }
+  }
+  else if(fix_ins_stream_ && comm->me == 0)
+    error->warning(FLERR,"Fix massflow/mesh: number of residence time bins changed, histogram is not restored");
 }
 
 /* ----------------------------------------------------------------------
@@ -658,6 +802,26 @@ double FixMassflowMesh::compute_vector(int index)
     return 0.;
 }
 
+/* ----------------------------------------------------------------------
+   output residence time histogram
+   columns: bin center, particle count, mass
+------------------------------------------------------------------------- */
+
+double FixMassflowMesh::compute_array(int i, int j)
+{
+    if(i < 0 || i >= n_bins_residence_)
+        return 0.;
+
+    if(j == 0)
+        return (static_cast<double>(i)+0.5)*binwidth_residence_;
+    if(j == 1)
+        return hist_residence_n_[i];
+    if(j == 2)
+        return hist_residence_mass_[i];
+
+    return 0.;
+}
+
 /* ----------------------------------------------------------------------
     get reference point on face
     calculate normalvec
@@ -70,11 +70,14 @@ class FixMassflowMesh : public Fix {
 
   void post_integrate();
   void pre_exchange();
+  void end_of_step();
+  void post_run();
 
   void write_restart(FILE *fp);
   void restart(char *buf);
 
   double compute_vector(int index);
+  double compute_array(int i, int j);
 
  protected:
 
@@ -129,6 +132,19 @@ class FixMassflowMesh : public Fix {
   double t_count_, delta_t_;
   bool reset_t_count_;
 
+  // residence time distribution of counted particles
+  // events are buffered per process and binned on reduction
+  void reduce_residence_time();
+
+  class FixInsertStream *fix_ins_stream_;
+  int n_bins_residence_;
+  double binwidth_residence_;
+  std::vector<double> residence_time_local_;
+  std::vector<double> residence_weight_local_;
+  std::vector<double> residence_mass_local_;
+  double *hist_residence_n_;
+  double *hist_residence_mass_;
+
 }; //end class
 
 }
@@ -101,6 +101,7 @@ FixMeshSurface::FixMeshSurface(LAMMPS *lmp, int narg, char **arg)
   n_dump_active_(0),
   curvature_(0.),
   curvature_tolerant_(false),
+  neighlist_incremental_(false),
   extrude_mesh_(false),
   extrusion_length_(0.0),
   extrusion_tri_count_(0),
@@ -207,6 +208,18 @@ FixMeshSurface::FixMeshSurface(LAMMPS *lmp, int narg, char **arg)
             error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'curvature_tolerant'");
           iarg_++;
           hasargs = true;
+      } else if (strcmp(arg[iarg_],"neighlist_incremental") == 0) {
+          if (narg < iarg_+2)
+            error->fix_error(FLERR,this,"not enough arguments for 'neighlist_incremental'");
+          iarg_++;
+          if(0 == strcmp(arg[iarg_],"yes"))
+            neighlist_incremental_ = true;
+          else if(0 == strcmp(arg[iarg_],"no"))
+            neighlist_incremental_ = false;
+          else
+            error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'neighlist_incremental'");
+          iarg_++;
+          hasargs = true;
       } else if (strcmp(arg[iarg_], "extrude_planar") == 0) {
           if (narg < iarg_+2)
             error->fix_error(FLERR,this,"not enough arguments for 'extrude_planar'");
@@ -584,12 +597,13 @@ void FixMeshSurface::createWallNeighList(int igrp)
     char *neighlist_name = new char[strlen(id)+1+20];
     sprintf(neighlist_name,"wall_neighlist_%s",id);
 
-    const char *fixarg[4];
+    const char *fixarg[5];
     fixarg[0]= neighlist_name;
     fixarg[1]= "all";
     fixarg[2]= "neighlist/mesh";
     fixarg[3]= id;
-    modify->add_fix(4,const_cast<char**>(fixarg));
+    fixarg[4]= "incremental";
+    modify->add_fix(neighlist_incremental_ ? 5 : 4,const_cast<char**>(fixarg));
 
     fix_mesh_neighlist_ =
         static_cast<FixNeighlistMesh*>(modify->find_fix_id(neighlist_name));
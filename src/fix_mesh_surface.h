@@ -218,6 +218,9 @@ namespace LAMMPS_NS
         double curvature_;
         bool curvature_tolerant_;
 
+        // incremental build of the wall neighbor list
+        bool neighlist_incremental_;
+
         // extrude mesh
         bool extrude_mesh_;
         double extrusion_length_;
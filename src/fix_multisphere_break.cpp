@@ -267,8 +267,9 @@ void FixMultisphereBreak::pre_neighbor()
     if(multisphere_.check_lost_atoms(body_,delflag,existflag,fix_volumeweight_ms_->vector_atom))
         next_reneighbor = update->ntimestep + 100;
 
-    fix_delflag_->do_reverse_comm();
-    fix_existflag_->do_reverse_comm();
+    fix_delflag_->queue_reverse_comm();
+    fix_existflag_->queue_reverse_comm();
+    comm->flush_reverse_comm_fix();
 
     fw_comm_flag_ = MS_COMM_FW_IMAGE_DISPLACE;
     forward_comm();
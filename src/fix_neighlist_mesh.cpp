@@ -53,6 +53,9 @@
 #include "domain.h"
 #include "vector_liggghts.h"
 #include "update.h"
+#include "comm.h"
+#include "memory.h"
+#include "mpi_liggghts.h"
 #include <stdio.h>
 #include <algorithm>
 #include "atom_vec_ellipsoid.h"
@@ -83,7 +86,18 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
   changingDomain(false),
   last_bin_update(-1),
   avec(0),
-  otherList_(false)
+  otherList_(false),
+  incremental_(false),
+  incremental_valid_(false),
+  extra_(0.0),
+  fix_test_(0),
+  fix_test_name_(0),
+  retest_(NULL),
+  nmax_retest_(0),
+  ntests_(0),
+  nskipped_(0),
+  ntests_total_(0),
+  nskipped_total_(0)
 {
     if(!modify->find_fix_id(arg[3]) || !dynamic_cast<FixMeshSurface*>(modify->find_fix_id(arg[3])))
         error->fix_error(FLERR,this,"illegal caller");
@@ -91,17 +105,24 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
     caller_ = static_cast<FixMeshSurface*>(modify->find_fix_id(arg[3]));
     mesh_ = caller_->triMesh();
 
-    if(5 == narg)
+    for(int iarg = 4; iarg < narg; iarg++)
     {
-        if(0 == strcmp(arg[4],"other_yes"))
+        if(0 == strcmp(arg[iarg],"other_yes"))
             otherList_ = true;
-        else if(0 == strcmp(arg[4],"other_no"))
+        else if(0 == strcmp(arg[iarg],"other_no"))
             otherList_ = false;
+        else if(0 == strcmp(arg[iarg],"incremental"))
+            incremental_ = true;
         else error->fix_error(FLERR,this,"illegal");
         
     }
 
     groupbit_wall_mesh = groupbit;
+
+    vector_flag = 1;
+    size_vector = 4;
+    global_freq = 1;
+    extvector = 1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -109,6 +130,8 @@ FixNeighlistMesh::FixNeighlistMesh(LAMMPS *lmp, int narg, char **arg)
 FixNeighlistMesh::~FixNeighlistMesh()
 {
     delete [] fix_nneighs_name_;
+    delete [] fix_test_name_;
+    memory->destroy(retest_);
     last_bin_update = -1;
 }
 
@@ -143,6 +166,35 @@ void FixNeighlistMesh::post_create()
         fix_nneighs_->just_created = false;
         fix_nneighs_->set_internal();
     }
+
+    // position, radius, owning process and wall group membership of each
+    // particle at the time it was last tested against the triangles
+    if(incremental_ && !fix_test_)
+    {
+        const char* fixarg[15];
+        delete [] fix_test_name_;
+        fix_test_name_ = new char[strlen(id)+1+20];
+        sprintf(fix_test_name_,"neighlist_test_%s",id);
+
+        fixarg[0]=fix_test_name_;
+        fixarg[1]="all";
+        fixarg[2]="property/atom";
+        fixarg[3]=fix_test_name_;
+        fixarg[4]="vector";
+        fixarg[5]="no";     // restart
+        fixarg[6]="no";     // communicate ghost
+        fixarg[7]="no";     // communicate rev
+        fixarg[8]="0.";
+        fixarg[9]="0.";
+        fixarg[10]="0.";
+        fixarg[11]="0.";
+        fixarg[12]="-1.";
+        fixarg[13]="0.";
+        fix_test_ = modify->add_fix_property_atom(14,const_cast<char**>(fixarg),style);
+
+        fix_test_->just_created = false;
+        fix_test_->set_internal();
+    }
     //check for aspherical
     avec = (AtomVecEllipsoid *) atom->style_match("ellipsoid");
 }
@@ -176,7 +228,9 @@ void FixNeighlistMesh::initializeNeighlist()
 
 void FixNeighlistMesh::setup_pre_force(int foo)
 {
-    
+    // mesh or particles may have been changed between runs
+    incremental_valid_ = false;
+
     pre_neighbor();
     pre_force(0);
 }
@@ -185,7 +239,8 @@ void FixNeighlistMesh::setup_pre_force(int foo)
 
 void FixNeighlistMesh::min_setup_pre_force(int foo)
 {
-    
+    incremental_valid_ = false;
+
     pre_neighbor();
     pre_force(0);
 }
@@ -195,7 +250,11 @@ void FixNeighlistMesh::min_setup_pre_force(int foo)
 void FixNeighlistMesh::pre_delete(bool unfixflag)
 {
     if(unfixflag)
+    {
         modify->delete_fix(fix_nneighs_->id);
+        if(fix_test_)
+            modify->delete_fix(fix_test_->id);
+    }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -249,6 +308,7 @@ void FixNeighlistMesh::pre_force(int)
     double rmax = 0.5*(neighbor->cutneighmax - neighbor->skin);
     double prev_skin = skin;
     double prev_distmax = distmax;
+    double prev_extra = extra_;
 
     if(changingMesh)
     {
@@ -263,6 +323,13 @@ void FixNeighlistMesh::pre_force(int)
       distmax = neighbor->cutneighmax - rmax + SMALL_DELTA;
     }
 
+    // in incremental mode particles are tested with an extra margin so
+    // they need not be tested again until they moved by this margin
+    const bool incremental = incremental_ && !changingMesh && !changingDomain && atom->map_style && !atom->ellipsoid;
+    extra_ = incremental ? skin : 0.0;
+    if(!incremental)
+        incremental_valid_ = false;
+
     mbinx = neighbor->mbinx;
     mbiny = neighbor->mbiny;
     mbinz = neighbor->mbinz;
@@ -278,22 +345,44 @@ void FixNeighlistMesh::pre_force(int)
     }
 
     // update precomputed bins if necessary
-    if((skin != prev_skin) || (distmax != prev_distmax) || (neighbor->last_setup_bins_timestep > last_bin_update)) {
+    if((skin != prev_skin) || (distmax != prev_distmax) || (extra_ != prev_extra) || (neighbor->last_setup_bins_timestep > last_bin_update)) {
       generate_bin_list(nall);
     }
 
+    // contacts carried over from the previous build rely on an unchanged margin
+    if((skin != prev_skin) || (distmax != prev_distmax) || (extra_ != prev_extra))
+      incremental_valid_ = false;
+
     // manually trigger binning if no pairwise neigh lists exist
     if(0 == neighbor->n_blist() && bins)
         neighbor->bin_atoms();
     else if(!bins)
         error->one(FLERR,"wrong neighbor setting for fix neighlist/mesh");
 
-    for(size_t iTri = 0; iTri < nall; iTri++) {
-      TriangleNeighlist & triangle = triangles[iTri];
-      handleTriangle(iTri);
-      numAllContacts_ += triangle.contacts.size();
+    ntests_ = nskipped_ = 0;
+
+    if(incremental && prepareIncremental(nall))
+    {
+      buildIncremental(nall);
+      for(size_t iTri = 0; iTri < nall; iTri++)
+        numAllContacts_ += triangles[iTri].contacts.size();
+    }
+    else
+    {
+      for(size_t iTri = 0; iTri < nall; iTri++) {
+        TriangleNeighlist & triangle = triangles[iTri];
+        handleTriangle(iTri);
+        numAllContacts_ += triangle.contacts.size();
+        ntests_ += triangle.nchecked;
+      }
     }
 
+    if(incremental)
+      finishIncremental(nall);
+
+    ntests_total_ += ntests_;
+    nskipped_total_ += nskipped_;
+
     if(globalNumAllContacts_)
         MPI_Sum_Scalar(numAllContacts_,world);
 
@@ -334,14 +423,14 @@ void FixNeighlistMesh::checkBin(AtomVecEllipsoid::Bonus *bonus, std::vector<int>
           shape     = bonus[ellipsoid[iAtom]].shape;
           length    = 2.*MathExtraLiggghts::max(shape[0],shape[1],shape[2]);
           cylRadius =    MathExtraLiggghts::min(shape[0],shape[1],shape[2]);
-          if( mesh_->resolveTriSegmentNeighbuild(iTri, x[iAtom], length*contactDistanceFactor, cylRadius, skin ) )
+          if( mesh_->resolveTriSegmentNeighbuild(iTri, x[iAtom], length*contactDistanceFactor, cylRadius, skin+extra_ ) )
           {
             neighbors.push_back(iAtom);
             fix_nneighs_->set_vector_atom_int(iAtom, fix_nneighs_->get_vector_atom_int(iAtom)+1); // num_neigh++
           }
       }
       #endif
-      else if(mesh_->resolveTriSphereNeighbuild(iTri,r ? r[iAtom]*contactDistanceFactor : 0. ,x[iAtom],r ? skin : (distmax+skin) ))
+      else if(mesh_->resolveTriSphereNeighbuild(iTri,r ? r[iAtom]*contactDistanceFactor : 0. ,x[iAtom],r ? (skin+extra_) : (distmax+skin+extra_) ))
       {
         // include iAtom in neighbor list
         neighbors.push_back(iAtom);
@@ -444,6 +533,205 @@ void FixNeighlistMesh::getBinBoundariesForTriangle(int iTri, int &ixMin,int &ixM
   }
 }
 
+/* ----------------------------------------------------------------------
+   incremental mode: decide which owned particles must be tested again
+   returns false if the lists of the previous build cannot be re-used
+------------------------------------------------------------------------- */
+
+bool FixNeighlistMesh::prepareIncremental(size_t nall)
+{
+    // triangles must be the same as in the previous build
+
+    if(incremental_valid_ && tri_ids_.size() == nall)
+    {
+        for(size_t iTri = 0; iTri < nall; iTri++)
+        {
+            if(tri_ids_[iTri] != mesh_->id(iTri))
+            {
+                incremental_valid_ = false;
+                break;
+            }
+        }
+    }
+    else
+        incremental_valid_ = false;
+
+    const int nlocal = atom->nlocal;
+    if(nlocal > nmax_retest_)
+    {
+        nmax_retest_ = atom->nmax;
+        memory->destroy(retest_);
+        memory->create(retest_,nmax_retest_,"neighlist/mesh:retest_");
+    }
+
+    if(!incremental_valid_)
+        return false;
+
+    double **xtest = fix_test_->array_atom;
+    const double me = static_cast<double>(comm->me);
+    int *mask = atom->mask;
+
+    // kept lists only hold particles of the wall group, so a change
+    // of group membership requires a full rebuild
+
+    for(int i = 0; i < nlocal; i++)
+    {
+        const double ingroup = (mask[i] & groupbit_wall_mesh) ? 1. : 0.;
+        if(xtest[i][4] == me && xtest[i][5] != ingroup)
+        {
+            incremental_valid_ = false;
+            return false;
+        }
+    }
+
+    // particles are tested again if they are new to this process, moved
+    // more than the extra margin or changed their radius
+
+    const double extrasq = extra_*extra_;
+
+    for(int i = 0; i < nlocal; i++)
+    {
+        retest_[i] = (xtest[i][4] != me) ||
+                     (pointDistanceSquared(x[i],xtest[i]) > extrasq) ||
+                     (r && r[i] != xtest[i][3]);
+    }
+
+    return true;
+}
+
+/* ----------------------------------------------------------------------
+   incremental mode: keep the contacts of particles that need not be
+   tested again, test the other particles against the triangles of
+   their bin only
+------------------------------------------------------------------------- */
+
+void FixNeighlistMesh::buildIncremental(size_t nall)
+{
+    int *mask = atom->mask;
+    const int nlocal = atom->nlocal;
+    const int nall_atoms = nlocal + atom->nghost;
+    const double contactDistanceFactor = neighbor->contactDistanceFactor;
+
+    for(size_t iTri = 0; iTri < nall; iTri++)
+    {
+        TriangleNeighlist & triangle = triangles[iTri];
+        std::vector<int> & neighbors = triangle.contacts;
+        const std::vector<int> & tags = triangle.tags;
+
+        neighbors.clear();
+        triangle.nchecked = 0;
+
+        if(!nlocal) continue;
+
+        const int ntags = tags.size();
+        for(int k = 0; k < ntags; k++)
+        {
+            const int iAtom = atom->map(tags[k]);
+            if(iAtom < 0 || iAtom >= nlocal || retest_[iAtom] || !(mask[iAtom] & groupbit_wall_mesh))
+                continue;
+            neighbors.push_back(iAtom);
+            fix_nneighs_->set_vector_atom_int(iAtom, fix_nneighs_->get_vector_atom_int(iAtom)+1); // num_neigh++
+        }
+    }
+
+    if(!nlocal) return;
+
+    // only handle local atoms and periodic ghosts
+
+    for(int iAtom = 0; iAtom < nall_atoms; iAtom++)
+    {
+        if(iAtom >= nlocal && !domain->is_periodic_ghost(iAtom))
+            continue;
+        if(!(mask[iAtom] & groupbit_wall_mesh))
+            continue;
+
+        const int iBin = neighbor->coord2bin(x[iAtom]);
+        if(iBin < 0 || iBin >= maxhead)
+            continue;
+
+        const int tri_start = bin_tri_start_[iBin];
+        const int tri_end = bin_tri_start_[iBin+1];
+
+        if(iAtom < nlocal && !retest_[iAtom])
+        {
+            nskipped_ += tri_end - tri_start;
+            continue;
+        }
+
+        ntests_ += tri_end - tri_start;
+        for(int k = tri_start; k < tri_end; k++)
+        {
+            const int iTri = bin_tri_list_[k];
+            if(mesh_->resolveTriSphereNeighbuild(iTri,r ? r[iAtom]*contactDistanceFactor : 0. ,x[iAtom],r ? (skin+extra_) : (distmax+skin+extra_) ))
+            {
+                triangles[iTri].contacts.push_back(iAtom);
+                fix_nneighs_->set_vector_atom_int(iAtom, fix_nneighs_->get_vector_atom_int(iAtom)+1); // num_neigh++
+            }
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   incremental mode: store tags of owned contacts and the test state
+   of the particles for the next build
+------------------------------------------------------------------------- */
+
+void FixNeighlistMesh::finishIncremental(size_t nall)
+{
+    const int nlocal = atom->nlocal;
+    int *tag = atom->tag;
+    int *mask = atom->mask;
+
+    tri_ids_.resize(nall);
+    for(size_t iTri = 0; iTri < nall; iTri++)
+    {
+        tri_ids_[iTri] = mesh_->id(iTri);
+
+        TriangleNeighlist & triangle = triangles[iTri];
+        const std::vector<int> & neighbors = triangle.contacts;
+        std::vector<int> & tags = triangle.tags;
+        tags.clear();
+        const int nneigh = neighbors.size();
+        for(int k = 0; k < nneigh; k++)
+            if(neighbors[k] < nlocal)
+                tags.push_back(tag[neighbors[k]]);
+    }
+
+    double **xtest = fix_test_->array_atom;
+    const double me = static_cast<double>(comm->me);
+
+    for(int i = 0; i < nlocal; i++)
+    {
+        if(!incremental_valid_ || retest_[i])
+        {
+            vectorCopy3D(x[i],xtest[i]);
+            xtest[i][3] = r ? r[i] : 0.;
+        }
+        xtest[i][4] = me;
+        xtest[i][5] = (mask[i] & groupbit_wall_mesh) ? 1. : 0.;
+    }
+
+    incremental_valid_ = true;
+}
+
+/* ----------------------------------------------------------------------
+   triangle-particle tests performed and skipped, summed over procs
+   1,2: last build  3,4: accumulated
+------------------------------------------------------------------------- */
+
+double FixNeighlistMesh::compute_vector(int n)
+{
+    bigint value = 0;
+    if(0 == n)      value = ntests_;
+    else if(1 == n) value = nskipped_;
+    else if(2 == n) value = ntests_total_;
+    else            value = nskipped_total_;
+
+    bigint value_all = 0;
+    MPI_Allreduce(&value,&value_all,1,MPI_LMP_BIGINT,MPI_SUM,world);
+    return static_cast<double>(value_all);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixNeighlistMesh::post_run()
@@ -487,7 +775,7 @@ void FixNeighlistMesh::generate_bin_list(size_t nall)
             // determine center of bin (ix, iy, iz)
             neighbor->bin_center(ix, iy, iz, center);
 
-            if (mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, distmax + skin))
+            if (mesh_->resolveTriSphereNeighbuild(iTri, maxdiag, center, distmax + skin + extra_))
             {
               binlist.push_back(iBin);
             }
@@ -497,6 +785,28 @@ void FixNeighlistMesh::generate_bin_list(size_t nall)
       }
       
     }
+
+    // inverse lookup bin -> triangles for the incremental build
+
+    if(extra_ > 0.)
+    {
+      bin_tri_start_.assign(maxhead+1,0);
+      for (size_t iTri = 0; iTri < nall; iTri++) {
+        const std::vector<int> & binlist = triangles[iTri].bins;
+        for (size_t k = 0; k < binlist.size(); k++)
+          bin_tri_start_[binlist[k]+1]++;
+      }
+      for (int iBin = 0; iBin < maxhead; iBin++)
+        bin_tri_start_[iBin+1] += bin_tri_start_[iBin];
+
+      bin_tri_list_.resize(bin_tri_start_[maxhead]);
+      std::vector<int> fill(bin_tri_start_.begin(),bin_tri_start_.end()-1);
+      for (size_t iTri = 0; iTri < nall; iTri++) {
+        const std::vector<int> & binlist = triangles[iTri].bins;
+        for (size_t k = 0; k < binlist.size(); k++)
+          bin_tri_list_[fill[binlist[k]]++] = iTri;
+      }
+    }
   }
 
   last_bin_update = update->ntimestep;
@@ -71,6 +71,7 @@ struct BinBoundary {
 
 struct TriangleNeighlist {
   std::vector<int> contacts;
+  std::vector<int> tags; // tags of owned contacts, only used in incremental mode
   std::vector<int> bins;
   BinBoundary boundary;
   int nchecked;
@@ -99,6 +100,8 @@ class FixNeighlistMesh : public Fix
 
     virtual void post_run();
 
+    virtual double compute_vector(int n);
+
     const std::vector<int> & get_contact_list(int iTri) const {
       return triangles[iTri].contacts;
     }
@@ -127,6 +130,9 @@ class FixNeighlistMesh : public Fix
   protected:
 
     void handleTriangle(int iTri);
+    void buildIncremental(size_t nall);
+    bool prepareIncremental(size_t nall);
+    void finishIncremental(size_t nall);
     void getBinBoundariesFromBoundingBox(class BoundingBox &b, int &ixMin,int &ixMax,int &iyMin,int &iyMax,int &izMin,int &izMax);
     void getBinBoundariesForTriangle(int iTri, int &ixMin,int &ixMax,int &iyMin,int &iyMax,int &izMin,int &izMax);
 
@@ -161,6 +167,24 @@ class FixNeighlistMesh : public Fix
     class AtomVecEllipsoid *avec;
 
     bool otherList_;
+
+    // incremental mode: triangles keep their contacts between builds,
+    // only particles that moved more than the extra margin since they
+    // were last tested (or are new to this process) are tested again,
+    // a change of wall group membership forces a full rebuild
+    bool incremental_;
+    bool incremental_valid_;
+    double extra_;
+    class FixPropertyAtom *fix_test_;
+    char *fix_test_name_;
+    std::vector<int> tri_ids_;
+    std::vector<int> bin_tri_start_, bin_tri_list_;
+    int *retest_;
+    int nmax_retest_;
+
+    // triangle-particle test statistics, last build and accumulated
+    bigint ntests_, nskipped_, ntests_total_, nskipped_total_;
+
 private:
     void checkBin(AtomVecEllipsoid::Bonus *bonus, std::vector<int>& neighbors, int& nchecked, double contactDistanceFactor, int *mask, int nlocal, int iBin, int iTri, bool haveNonSpherical, int *ellipsoid, double *shape);
 };
@@ -53,6 +53,7 @@
 #include "fix_nve_asphere.h"
 #include "math_extra.h"
 #include "atom.h"
+#include "comm.h"
 #include "atom_vec_ellipsoid.h"
 #include "force.h"
 #include "update.h"
@@ -154,8 +155,9 @@ void FixNVEAsphere::init()
         error->one(FLERR,"Fix nve/asphere requires extended particles");
 
   FixNVE::init();
-  fix_orientation_->do_forward_comm();
-  fix_shape_->do_forward_comm();
+  fix_orientation_->queue_forward_comm();
+  fix_shape_->queue_forward_comm();
+  comm->flush_forward_comm_fix();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -265,8 +267,9 @@ void FixNVEAsphere::initial_integrate(int vflag)
       		}
       }
     }
-    fix_orientation_->do_forward_comm();
-    fix_shape_->do_forward_comm();
+    fix_orientation_->queue_forward_comm();
+    fix_shape_->queue_forward_comm();
+    comm->flush_forward_comm_fix();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -61,6 +61,11 @@
 #include "force.h"
 #include "error.h"
 #include "domain.h" 
+#include "modify.h"
+#include "comm.h"
+#include "fix_gravity.h"
+#include "fix_viscous.h"
+#include "fix_freeze.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -68,6 +73,7 @@ using namespace FixConst;
 #define INERTIA 0.4          // moment of inertia prefactor for sphere
 
 enum{NONE,DIPOLE};
+enum{GRAVITY,VISCOUS,FREEZE};
 
 /* ---------------------------------------------------------------------- */
 
@@ -84,6 +90,7 @@ FixNVESphere::FixNVESphere(LAMMPS *lmp, int narg, char **arg) :
   // process extra keywords
 
   extra = NONE;
+  fused_ = false;
 
   int iarg = 3;
   while (iarg < narg) {
@@ -103,6 +110,12 @@ FixNVESphere::FixNVESphere(LAMMPS *lmp, int narg, char **arg) :
       }
       else error->all(FLERR,"Illegal fix nve/sphere command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"fused") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix nve/sphere command");
+      if (strcmp(arg[iarg+1],"yes") == 0) fused_ = true;
+      else if (strcmp(arg[iarg+1],"no") == 0) fused_ = false;
+      else error->all(FLERR,"Illegal fix nve/sphere command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal fix nve/sphere command");
   }
 
@@ -131,6 +144,67 @@ void FixNVESphere::init()
     if (mask[i] & groupbit)
       if (radius[i] == 0.0)
         error->one(FLERR,"Fix nve/sphere requires extended particles");
+
+  if (fused_) init_fused();
+}
+
+/* ----------------------------------------------------------------------
+   collect fixes whose per-atom force loop is taken over by this fix
+   each fix decides via fusable() if its contribution can be fused
+   only the trailing block of post_force fixes is fused, so forces are
+     added in the same order as without fusing and no other fix sees them
+     before they are complete
+   atoms of a fused fix must all be integrated by this fix
+------------------------------------------------------------------------- */
+
+void FixNVESphere::init_fused()
+{
+  if (!strstr(update->integrate_style,"verlet"))
+    error->fix_error(FLERR,this,"with 'fused yes' requires run_style verlet");
+
+  // fused contributions must only be applied once
+
+  for (int ifix = 0; ifix < modify->nfix; ifix++)
+    if (modify->fix[ifix] != this && strcmp(modify->fix[ifix]->style,style) == 0 &&
+        static_cast<FixNVESphere*>(modify->fix[ifix])->fused_)
+      error->fix_error(FLERR,this,"'fused yes' may only be used by one fix nve/sphere");
+
+  fused_forces_.clear();
+
+  // no other fix may use forces between post_force and this fix
+
+  const int me = modify->find_fix(id);
+  bool ok = true;
+  for (int ifix = 0; ifix < modify->nfix; ifix++) {
+    if (modify->fmask[ifix] & PRE_FINAL_INTEGRATE) ok = false;
+    if (ifix < me && (modify->fmask[ifix] & FINAL_INTEGRATE)) ok = false;
+  }
+
+  for (int ifix = modify->nfix-1; ok && ifix >= 0; ifix--) {
+    Fix *fix = modify->fix[ifix];
+    if (!(modify->fmask[ifix] & POST_FORCE)) continue;
+
+    FusedForce ff;
+    ff.fix = fix;
+    ff.groupbit = fix->groupbit;
+    ff.gamma = NULL;
+    if (strcmp(fix->style,"gravity") == 0 &&
+        static_cast<FixGravity*>(fix)->fusable())
+      ff.style = GRAVITY;
+    else if (strcmp(fix->style,"viscous") == 0 &&
+             static_cast<FixViscous*>(fix)->fusable())
+      ff.style = VISCOUS;
+    else if (strcmp(fix->style,"freeze") == 0 &&
+             static_cast<FixFreeze*>(fix)->fusable())
+      ff.style = FREEZE;
+    else break;
+
+    if (fix->igroup != igroup && igroup != 0) break;
+    fused_forces_.insert(fused_forces_.begin(),ff);
+  }
+
+  if (fused_forces_.empty() && comm->me == 0)
+    error->warning(FLERR,"Fix nve/sphere: no forces are fused");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -157,6 +231,21 @@ void FixNVESphere::initial_integrate(int vflag)
   if (domain->dimension == 2) dtfrotate = dtf / 0.5; // for discs the formula is I=0.5*Mass*Radius^2
   else dtfrotate  = dtf / INERTIA;
 
+  // tell fused fixes to skip their own loop over atoms this step
+
+  if (fused_) {
+    const bigint ntimestep = update->ntimestep;
+    for (size_t k = 0; k < fused_forces_.size(); k++) {
+      FusedForce &ff = fused_forces_[k];
+      if (ff.style == GRAVITY)
+        static_cast<FixGravity*>(ff.fix)->skip_post_force(ntimestep);
+      else if (ff.style == VISCOUS)
+        static_cast<FixViscous*>(ff.fix)->skip_post_force(ntimestep);
+      else
+        static_cast<FixFreeze*>(ff.fix)->skip_post_force(ntimestep);
+    }
+  }
+
   // update 1/2 step for v and omega, and full step for  x for all particles
   // d_omega/dt = torque / inertia
 
@@ -207,6 +296,11 @@ void FixNVESphere::initial_integrate(int vflag)
 
 void FixNVESphere::final_integrate()
 {
+  if (fused_) {
+    final_integrate_fused();
+    return;
+  }
+
   double dtfm,dtirotate;
 
   double **v = atom->v;
@@ -244,3 +338,96 @@ void FixNVESphere::final_integrate()
       omega[i][2] += dtirotate * torque[i][2];
     }
 }
+
+/* ----------------------------------------------------------------------
+   final integration, adding forces of fused fixes in the same pass
+   forces are written back so that f is the same as in the unfused case
+------------------------------------------------------------------------- */
+
+void FixNVESphere::final_integrate_fused()
+{
+  double dtfm,dtirotate;
+
+  double **v = atom->v;
+  double **f = atom->f;
+  double **omega = atom->omega;
+  double **torque = atom->torque;
+  double *rmass = atom->rmass;
+  double *radius = atom->radius;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  int nintegrate = nlocal;
+  if (igroup == atom->firstgroup) nintegrate = atom->nfirst;
+
+  double dtfrotate; 
+  if (domain->dimension == 2) dtfrotate = dtf / 0.5; // for discs the formula is I=0.5*Mass*Radius^2
+  else dtfrotate  = dtf / INERTIA;
+
+  // gather contributions once per step
+
+  double **x = atom->x;
+  const int nfused = fused_forces_.size();
+  FusedForce *fused = nfused ? &fused_forces_[0] : NULL;
+
+  for (int k = 0; k < nfused; k++) {
+    if (fused[k].style == GRAVITY)
+      static_cast<FixGravity*>(fused[k].fix)->get_acceleration(
+        fused[k].acc[0],fused[k].acc[1],fused[k].acc[2]);
+    else if (fused[k].style == VISCOUS)
+      fused[k].gamma = static_cast<FixViscous*>(fused[k].fix)->get_gamma();
+  }
+
+  // energy of fix gravity and original force of fix freeze are tallied
+  // in the same pass
+
+  std::vector<double> tally(3*nfused,0.0);
+
+  for (int i = 0; i < nlocal; i++) {
+    const int maski = mask[i];
+
+    for (int k = 0; k < nfused; k++) {
+      if (!(maski & fused[k].groupbit)) continue;
+      if (fused[k].style == GRAVITY) {
+        const double *acc = fused[k].acc;
+        f[i][0] += rmass[i]*acc[0];
+        f[i][1] += rmass[i]*acc[1];
+        f[i][2] += rmass[i]*acc[2];
+        tally[3*k] -= rmass[i] * (acc[0]*x[i][0] + acc[1]*x[i][1] + acc[2]*x[i][2]);
+      } else if (fused[k].style == VISCOUS) {
+        const double drag = fused[k].gamma[type[i]];
+        f[i][0] -= drag*v[i][0];
+        f[i][1] -= drag*v[i][1];
+        f[i][2] -= drag*v[i][2];
+      } else {
+        tally[3*k] += f[i][0];
+        tally[3*k+1] += f[i][1];
+        tally[3*k+2] += f[i][2];
+        f[i][0] = f[i][1] = f[i][2] = 0.0;
+        torque[i][0] = torque[i][1] = torque[i][2] = 0.0;
+      }
+    }
+
+    if (i < nintegrate && (maski & groupbit)) {
+
+      // velocity update for 1/2 step
+      dtfm = dtf / (rmass[i]*onePlusCAddRhoFluid_);
+      v[i][0] += dtfm * f[i][0];
+      v[i][1] += dtfm * f[i][1];
+      v[i][2] += dtfm * f[i][2];
+
+      // rotation update
+      dtirotate = dtfrotate / (radius[i]*radius[i]*rmass[i]);
+      omega[i][0] += dtirotate * torque[i][0];
+      omega[i][1] += dtirotate * torque[i][1];
+      omega[i][2] += dtirotate * torque[i][2];
+    }
+  }
+
+  for (int k = 0; k < nfused; k++) {
+    if (fused[k].style == GRAVITY)
+      static_cast<FixGravity*>(fused[k].fix)->add_egrav(tally[3*k]);
+    else if (fused[k].style == FREEZE)
+      static_cast<FixFreeze*>(fused[k].fix)->add_foriginal(&tally[3*k]);
+  }
+}
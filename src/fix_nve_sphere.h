@@ -59,6 +59,7 @@ FixStyle(nve/sphere,FixNVESphere)
 #define LMP_FIX_NVE_SPHERE_H
 
 #include "fix_nve.h"
+#include <vector>
 
 namespace LAMMPS_NS {
 
@@ -70,9 +71,28 @@ class FixNVESphere : public FixNVE {
   virtual void initial_integrate(int);
   virtual void final_integrate();
 
+  inline bool fused() const
+  { return fused_; }
+
  protected:
+  void init_fused();
+  void final_integrate_fused();
+
   int extra;
 
+  // fused mode: forces of fix gravity, fix viscous and fix freeze
+  // are applied in the same pass over the atoms as the final integration
+  // in the order of the fixes, which are the last post_force fixes
+  struct FusedForce {
+    int style;                 // GRAVITY, VISCOUS or FREEZE
+    class Fix *fix;
+    int groupbit;
+    double acc[3];             // acceleration of fix gravity
+    const double *gamma;       // per-type drag of fix viscous
+  };
+  bool fused_;
+  std::vector<FusedForce> fused_forces_;
+
   bool   useAM_;
   double CAddRhoFluid_;   //Added mass coefficient times relative fluid density (C_add*rhoFluid/rhoP)
   double onePlusCAddRhoFluid_;
@@ -103,4 +123,15 @@ E: Fix nve/sphere requires extended particles
 
 This fix can only be used for particles of a finite size.
 
+E: Fix nve/sphere with 'fused yes' requires run_style verlet
+
+The fused pass is done in the final integration of the Verlet scheme.
+
+W: Fix nve/sphere: no forces are fused
+
+Only fix gravity, fix viscous and fix freeze that come after all other
+fixes with a post_force step can be fused, and only if their group is
+the group of this fix or this fix integrates all atoms. No other fix
+may use the forces before this fix does its final integration.
+
 */
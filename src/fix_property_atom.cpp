@@ -322,6 +322,18 @@ void FixPropertyAtom::do_reverse_comm()
    timer->stamp(TIME_COMM);
 }
 
+void FixPropertyAtom::queue_forward_comm()
+{
+    if (commGhost) comm->queue_forward_comm_fix(this);
+    else error->all(FLERR,"FixPropertyAtom: Faulty implementation - forward_comm invoked, but not registered");
+}
+
+void FixPropertyAtom::queue_reverse_comm()
+{
+   if (commGhostRev) comm->queue_reverse_comm_fix(this);
+   else error->all(FLERR,"FixPropertyAtom: Faulty implementation - reverse_comm invoked, but not registered");
+}
+
 /* ----------------------------------------------------------------------
    memory usage of local atom-based arrays
 ------------------------------------------------------------------------- */
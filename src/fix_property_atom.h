@@ -73,6 +73,10 @@ class FixPropertyAtom : public Fix {
   void do_forward_comm();
   void do_reverse_comm();
 
+  // queue for aggregated comm, done at next comm->flush_forward/reverse_comm_fix()
+  void queue_forward_comm();
+  void queue_reverse_comm();
+
   Fix* check_fix(const char *varname,const char *svmstyle,int len1,int len2,const char *caller,bool errflag);
 
   double memory_usage();
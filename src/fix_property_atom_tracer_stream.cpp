@@ -245,6 +245,10 @@ void FixPropertyAtomTracerStream::mark_tracers(int ilo, int ihi)
 
     if(1 < comm->nprocs)
     {
+        // only local candidates which can possibly be marked are gathered
+        // so communication scales with the number of tracers, not particles
+        select_candidates(releasedata_local);
+
         int *data = 0, *data_all = 0;
         int ndata = 0, ndata_all = 0;
 
@@ -292,6 +296,43 @@ void FixPropertyAtomTracerStream::mark_tracers(int ilo, int ihi)
 
 }
 
+/* ----------------------------------------------------------------------
+   reduce local release data to the entries which can be marked
+   a particle marked for packet p is among the first n_0+...+n_p particles
+   (in global order) released at or after mark step p, so it is also among
+   the first n_0+...+n_p local ones
+------------------------------------------------------------------------- */
+
+void FixPropertyAtomTracerStream::select_candidates(std::vector<Releasedata> &releasedata)
+{
+    sort(releasedata.begin(), releasedata.end());
+
+    const int size = releasedata.size();
+    const int n_packet = n_to_mark_.size();
+    std::vector<bool> keep(size,false);
+    int n_cumulative = 0;
+    int i = 0;
+
+    for(int ipacket = 0; ipacket < n_packet; ipacket++)
+    {
+        if(n_to_mark_[ipacket] > 0)
+            n_cumulative += n_to_mark_[ipacket];
+
+        // releasedata is sorted by step, mark steps are ascending
+        while(i < size && releasedata[i].step < mark_steps_[ipacket])
+            i++;
+
+        for(int j = i; j < size && j < i+n_cumulative; j++)
+            keep[j] = true;
+    }
+
+    int n = 0;
+    for(int j = 0; j < size; j++)
+        if(keep[j])
+            releasedata[n++] = releasedata[j];
+    releasedata.resize(n);
+}
+
 /* ---------------------------------------------------------------------- */
 
 int FixPropertyAtomTracerStream::construct_data(std::vector<Releasedata> data_c, int *&data)
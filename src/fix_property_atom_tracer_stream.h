@@ -57,7 +57,10 @@ namespace FixPropertyAtomTracerStreamAux {
      public:
       int id, step;
       
-      bool operator<(const Releasedata &rhs) const { return step < rhs.step; }
+      // ties broken by ID so the selection does not depend on
+      // the decomposition
+      bool operator<(const Releasedata &rhs) const
+      { return step < rhs.step || (step == rhs.step && id < rhs.id); }
     };
 }
 
@@ -80,6 +83,7 @@ class FixPropertyAtomTracerStream : public FixPropertyAtomTracer {
 
  private:
 
+  void select_candidates(std::vector<Releasedata> &releasedata);
   int construct_data(std::vector<Releasedata> data_c, int *&data);
   std::vector<Releasedata> construct_releasedata_all(int *data, int ndata);
 
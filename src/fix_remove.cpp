@@ -0,0 +1,449 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "atom.h"
+#include "atom_vec.h"
+#include "comm.h"
+#include "domain.h"
+#include "region.h"
+#include "modify.h"
+#include "update.h"
+#include "error.h"
+#include "fix_multisphere.h"
+#include "fix_property_atom.h"
+#include "mpi_liggghts.h"
+#include "math_extra_liggghts.h"
+#include "fix_remove.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+/* ---------------------------------------------------------------------- */
+
+FixRemove::FixRemove(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  iregion_(-1),
+  idregion_(0),
+  max_delay_(0),
+  verbose_(false),
+  fix_delflag_(0),
+  fix_ms_(0),
+  pending_(false),
+  nremoved_(0.),
+  mass_removed_(0.)
+{
+    // parse args for this class
+
+    nevery = 1;
+
+    int iarg = 3;
+
+    bool hasargs = true;
+    while(iarg < narg && hasargs)
+    {
+        hasargs = false;
+
+        if(strcmp(arg[iarg],"region") == 0) {
+            if(narg < iarg+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'region'");
+            if(domain->find_region(arg[iarg+1]) < 0)
+                error->fix_error(FLERR,this,"region ID does not exist");
+            int n = strlen(arg[iarg+1]) + 1;
+            idregion_ = new char[n];
+            strcpy(idregion_,arg[iarg+1]);
+            iarg += 2;
+            hasargs = true;
+        } else if(strcmp(arg[iarg],"nevery") == 0) {
+            if(narg < iarg+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'nevery'");
+            nevery = atoi(arg[iarg+1]);
+            if(nevery <= 0)
+                error->fix_error(FLERR,this,"'nevery' > 0 required");
+            iarg += 2;
+            hasargs = true;
+        } else if(strcmp(arg[iarg],"max_delay") == 0) {
+            if(narg < iarg+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'max_delay'");
+            max_delay_ = atoi(arg[iarg+1]);
+            if(max_delay_ < 0)
+                error->fix_error(FLERR,this,"'max_delay' >= 0 required");
+            iarg += 2;
+            hasargs = true;
+        } else if(strcmp(arg[iarg],"verbose") == 0) {
+            if(narg < iarg+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'verbose'");
+            if(strcmp(arg[iarg+1],"yes") == 0) verbose_ = true;
+            else if(strcmp(arg[iarg+1],"no") == 0) verbose_ = false;
+            else error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'verbose'");
+            iarg += 2;
+            hasargs = true;
+        } else if(strcmp(style,"remove") == 0)
+            error->fix_error(FLERR,this,"unknown keyword");
+    }
+
+    if(!idregion_)
+        error->fix_error(FLERR,this,"expecting keyword 'region'");
+
+    // removal is done in pre_exchange() of a re-neighboring step
+    force_reneighbor = 1;
+    next_reneighbor = -1;
+
+    restart_global = 1;
+
+    vector_flag = 1;
+    size_vector = 2;
+    global_freq = 1;
+    extvector = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixRemove::~FixRemove()
+{
+    delete []idregion_;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixRemove::post_create()
+{
+    // add per-particle deletion flag
+
+    const char * fixarg[9];
+
+    sprintf(fixid_,"remove_%s",id);
+    fixarg[0]=fixid_;
+    fixarg[1]="all";
+    fixarg[2]="property/atom";
+    fixarg[3]=fixid_;
+    fixarg[4]="scalar";
+    fixarg[5]="yes";    // restart
+    fixarg[6]="no";     // communicate ghost
+    fixarg[7]="no";     // communicate rev
+    fixarg[8]="0.";
+    modify->add_fix(9,const_cast<char**>(fixarg));
+
+    fix_delflag_ = static_cast<FixPropertyAtom*>(modify->find_fix_property(fixid_,"property/atom","scalar",0,0,style));
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixRemove::pre_delete(bool unfixflag)
+{
+    if (unfixflag) modify->delete_fix(fixid_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixRemove::setmask()
+{
+    int mask = 0;
+    mask |= END_OF_STEP;
+    mask |= PRE_EXCHANGE;
+    return mask;
+}
+
+/* ----------------------------------------------------------------------
+   initialize this fix
+------------------------------------------------------------------------- */
+
+void FixRemove::init()
+{
+    if (atom->rmass_flag == 0)
+        error->fix_error(FLERR,this,"requires atoms have mass");
+
+    iregion_ = domain->find_region(idregion_);
+    if (iregion_ == -1)
+        error->fix_error(FLERR,this,"region ID does not exist");
+
+    fix_delflag_ = static_cast<FixPropertyAtom*>(modify->find_fix_property(fixid_,"property/atom","scalar",0,0,style));
+
+    // fix multisphere clears its callbacks in init(), so it has to come first
+
+    fix_ms_ = static_cast<FixMultisphere*>(modify->find_fix_style("multisphere",0));
+    if(fix_ms_)
+    {
+        if(modify->find_fix(fix_ms_->id) > modify->find_fix(id))
+            error->fix_error(FLERR,this,"fix multisphere must come before fix remove in input script");
+        fix_ms_->add_remove_callback(this);
+    }
+
+    body_tags_delete_.clear();
+}
+
+/* ----------------------------------------------------------------------
+   queue particles and bodies inside the region for removal
+   removal waits for the next regular re-neighboring, but at most
+   max_delay steps, so no extra exchange/borders/neighbor build is
+   triggered if particles leave in between
+------------------------------------------------------------------------- */
+
+void FixRemove::end_of_step()
+{
+    domain->regions[iregion_]->prematch();
+
+    int nmarked = mark_atoms() + mark_bodies();
+    MPI_Sum_Scalar(nmarked,world);
+
+    if(nmarked > 0 && !pending_)
+    {
+        pending_ = true;
+        next_reneighbor = update->ntimestep + (max_delay_ > 0 ? max_delay_ : 1);
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixRemove::mark_atoms()
+{
+    double **x = atom->x;
+    int *mask = atom->mask;
+    int nlocal = atom->nlocal;
+    double *delflag = fix_delflag_->vector_atom;
+    double *ms_delflag = fix_ms_ ? fix_ms_->fix_delflag()->vector_atom : 0;
+    Region *region = domain->regions[iregion_];
+
+    int nmarked = 0;
+
+    for(int i = 0; i < nlocal; i++)
+    {
+        if(!(mask[i] & groupbit) || delflag[i] == 1.)
+            continue;
+
+        // multisphere bodies are removed as a whole via delete_bodies()
+        // atoms of lost bodies are already deleted by fix multisphere
+        if(fix_ms_ && (fix_ms_->belongs_to(i) >= 0 || ms_delflag[i] == 1.))
+            continue;
+
+        if(region->match(x[i][0],x[i][1],x[i][2]))
+        {
+            delflag[i] = 1.;
+            nmarked++;
+        }
+    }
+
+    return nmarked;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixRemove::mark_bodies()
+{
+    if(!fix_ms_)
+        return 0;
+
+    Multisphere &ms = fix_ms_->data();
+    Region *region = domain->regions[iregion_];
+    int nbody = ms.n_body();
+    double xcm[3];
+
+    int nmarked = 0;
+
+    for(int ibody = 0; ibody < nbody; ibody++)
+    {
+        ms.xcm(xcm,ibody);
+        if(!region->match(xcm[0],xcm[1],xcm[2]))
+            continue;
+
+        int tag = ms.tag(ibody);
+        if(std::find(body_tags_delete_.begin(),body_tags_delete_.end(),tag) != body_tags_delete_.end())
+            continue;
+
+        body_tags_delete_.push_back(tag);
+        nmarked++;
+    }
+
+    return nmarked;
+}
+
+/* ----------------------------------------------------------------------
+   remove all queued particles in one compaction pass
+   AtomVec::copy() also compacts per-atom arrays of all fixes, e.g.
+   contact history and fix property/atom
+   done before exchange, borders, reneighbor
+------------------------------------------------------------------------- */
+
+void FixRemove::pre_exchange()
+{
+    if(!pending_)
+        return;
+
+    AtomVec *avec = atom->avec;
+    double *delflag = fix_delflag_->vector_atom;
+    double *rmass = atom->rmass;
+
+    double nremoved_this = 0.;
+    double mass_removed_this = 0.;
+
+    int i = 0;
+    while(i < atom->nlocal)
+    {
+        if(delflag[i] == 1.)
+        {
+            nremoved_this += 1.;
+            mass_removed_this += rmass[i];
+            avec->copy(atom->nlocal-1,i,1);
+            atom->nlocal--;
+        }
+        else i++;
+    }
+
+    MPI_Sum_Scalar(nremoved_this,world);
+    MPI_Sum_Scalar(mass_removed_this,world);
+
+    nremoved_ += nremoved_this;
+    mass_removed_ += mass_removed_this;
+
+    if(nremoved_this > 0.)
+    {
+        bigint nblocal = atom->nlocal;
+        MPI_Allreduce(&nblocal,&atom->natoms,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+        if (atom->tag_enable && atom->map_style) {
+            atom->nghost = 0;
+            atom->map_init();
+            atom->map_set();
+        }
+
+        if(verbose_ && comm->me == 0)
+        {
+            if(screen) fprintf(screen,"Fix remove %s: removed %d particles (mass %f) at step " BIGINT_FORMAT "\n",
+                               id,static_cast<int>(nremoved_this),mass_removed_this,update->ntimestep);
+            if(logfile) fprintf(logfile,"Fix remove %s: removed %d particles (mass %f) at step " BIGINT_FORMAT "\n",
+                               id,static_cast<int>(nremoved_this),mass_removed_this,update->ntimestep);
+        }
+    }
+
+    // bodies are removed later in this step via delete_bodies()
+
+    pending_ = false;
+    next_reneighbor = -1;
+}
+
+/* ----------------------------------------------------------------------
+   remove queued multisphere bodies, their atoms are then flagged as lost
+   and deleted by fix multisphere
+------------------------------------------------------------------------- */
+
+void FixRemove::delete_bodies()
+{
+    double nremoved_this = 0.;
+    double mass_removed_this = 0.;
+
+    if(!body_tags_delete_.empty())
+    {
+        Multisphere &ms = fix_ms_->data();
+
+        std::sort(body_tags_delete_.begin(),body_tags_delete_.end());
+
+        // remove_body() moves last body to ilocal, so loop backwards
+        for(int ibody = ms.n_body()-1; ibody >= 0; ibody--)
+        {
+            if(!std::binary_search(body_tags_delete_.begin(),body_tags_delete_.end(),ms.tag(ibody)))
+                continue;
+
+            nremoved_this += 1.;
+            mass_removed_this += ms.mass(ibody);
+            ms.remove_body(ibody);
+        }
+
+        body_tags_delete_.clear();
+    }
+
+    MPI_Sum_Scalar(nremoved_this,world);
+    MPI_Sum_Scalar(mass_removed_this,world);
+
+    nremoved_ += nremoved_this;
+    mass_removed_ += mass_removed_this;
+
+    if(nremoved_this > 0. && verbose_ && comm->me == 0)
+    {
+        if(screen) fprintf(screen,"Fix remove %s: removed %d bodies (mass %f) at step " BIGINT_FORMAT "\n",
+                           id,static_cast<int>(nremoved_this),mass_removed_this,update->ntimestep);
+        if(logfile) fprintf(logfile,"Fix remove %s: removed %d bodies (mass %f) at step " BIGINT_FORMAT "\n",
+                           id,static_cast<int>(nremoved_this),mass_removed_this,update->ntimestep);
+    }
+}
+
+/* ----------------------------------------------------------------------
+   pack entire state of Fix into one write
+------------------------------------------------------------------------- */
+
+void FixRemove::write_restart(FILE *fp)
+{
+  int n = 0;
+  double list[2];
+  list[n++] = nremoved_;
+  list[n++] = mass_removed_;
+
+  if (comm->me == 0) {
+    int size = n * sizeof(double);
+    fwrite(&size,sizeof(int),1,fp);
+    fwrite(list,sizeof(double),n,fp);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   use state info from restart file to restart the Fix
+------------------------------------------------------------------------- */
+
+void FixRemove::restart(char *buf)
+{
+  int n = 0;
+  double *list = (double *) buf;
+
+  nremoved_ = list[n++];
+  mass_removed_ = list[n++];
+}
+
+/* ----------------------------------------------------------------------
+   output # and mass of removed particles
+------------------------------------------------------------------------- */
+
+double FixRemove::compute_vector(int index)
+{
+    if(index == 0)   return nremoved_;
+    return mass_removed_;
+}
@@ -1 +1,111 @@
-namespace LAMMPS_NS {class FixRemove { public: void delete_bodies(){} };}
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(remove,FixRemove)
+
+#else
+
+#ifndef LMP_FIX_REMOVE_H
+#define LMP_FIX_REMOVE_H
+
+#include "fix.h"
+#include <vector>
+
+namespace LAMMPS_NS {
+
+class FixRemove : public Fix {
+
+ public:
+
+  FixRemove(class LAMMPS *lmp, int narg, char ** arg);
+  ~FixRemove();
+
+  void post_create();
+  void pre_delete(bool unfixflag);
+
+  int setmask();
+  void init();
+
+  void end_of_step();
+  void pre_exchange();
+
+  // called by fix multisphere in pre_neighbor()
+  void delete_bodies();
+
+  void write_restart(FILE *fp);
+  void restart(char *buf);
+
+  double compute_vector(int index);
+
+ private:
+
+  int mark_atoms();
+  int mark_bodies();
+
+  int iregion_;
+  char *idregion_;
+
+  // max # of steps a marked particle may wait for a regular re-neighboring
+  int max_delay_;
+  bool verbose_;
+
+  // per-atom flag for particles queued for removal
+  char fixid_[200];
+  class FixPropertyAtom *fix_delflag_;
+
+  // tags of local multisphere bodies queued for removal
+  class FixMultisphere *fix_ms_;
+  std::vector<int> body_tags_delete_;
+
+  // true if any particle or body is queued on any proc
+  bool pending_;
+
+  // removed so far
+  double nremoved_;
+  double mass_removed_;
+
+}; //end class
+
+}
+#endif
+#endif
@@ -0,0 +1,469 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fix_snapshot.h"
+#include "lammps.h"
+#include "atom.h"
+#include "atom_vec.h"
+#include "update.h"
+#include "domain.h"
+#include "comm.h"
+#include "irregular.h"
+#include "modify.h"
+#include "memory.h"
+#include "error.h"
+#include "fix_mesh_surface.h"
+#include "tri_mesh.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+/* ---------------------------------------------------------------------- */
+
+FixSnapshot::FixSnapshot(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  saved(false),
+  ntimestep(0),
+  atimestep(0),
+  atime(0.),
+  natoms(0),
+  xy(0.), xz(0.), yz(0.),
+  abuf(NULL),
+  nabuf(0),
+  maxabuf(0),
+  nextra(0)
+{
+  if (narg != 3) error->fix_error(FLERR,this,"wrong number of arguments");
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixSnapshot::~FixSnapshot()
+{
+  memory->destroy(abuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixSnapshot::setmask()
+{
+  int mask = 0;
+  return mask;
+}
+
+/* ----------------------------------------------------------------------
+   capture current state
+   same preparation as write_restart: per-atom fix data is brought up to
+   date and atoms are migrated to their owning procs before packing
+------------------------------------------------------------------------- */
+
+void FixSnapshot::save()
+{
+  for (int i = 0; i < modify->nfix; i++)
+    if (strncmp(modify->fix[i]->style,"multisphere",11) == 0)
+      error->all(FLERR,"Snapshot does not support fix multisphere");
+
+  lmp->init();
+
+  modify->setup_pre_exchange();
+
+  if (domain->triclinic) domain->x2lamda(atom->nlocal);
+  domain->pbc();
+  domain->reset_box();
+  comm->setup();
+  comm->exchange();
+  comm->borders();
+  if (domain->triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
+
+  modify->forceMeshExchange();
+
+  ntimestep = update->ntimestep;
+  atimestep = update->atimestep;
+  atime = update->atime;
+  natoms = atom->natoms;
+  for (int dim = 0; dim < 3; dim++) {
+    boxlo[dim] = domain->boxlo[dim];
+    boxhi[dim] = domain->boxhi[dim];
+  }
+  xy = domain->xy;
+  xz = domain->xz;
+  yz = domain->yz;
+
+  // global fix data first, as in a restart file, since writing it
+  // may prepare per-atom data for packing (e.g. mesh contact history)
+
+  save_fixes();
+  save_atoms();
+  save_meshes();
+
+  saved = true;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSnapshot::save_atoms()
+{
+  AtomVec *avec = atom->avec;
+  int nlocal = atom->nlocal;
+
+  int n = avec->size_restart();
+  if (n > maxabuf) {
+    maxabuf = n;
+    memory->destroy(abuf);
+    memory->create(abuf,maxabuf,"snapshot:abuf");
+  }
+
+  int nmine = 0;
+  nabuf = 0;
+  for (int i = 0; i < nlocal; i++) {
+    int m = avec->pack_restart(i,&abuf[nabuf]);
+    nmine = MAX(nmine,m);
+    nabuf += m;
+  }
+  MPI_Allreduce(&nmine,&nextra,1,MPI_INT,MPI_MAX,world);
+
+  peratom_id.clear();
+  for (int iextra = 0; iextra < atom->nextra_restart; iextra++)
+    peratom_id.push_back(modify->fix[atom->extra_restart[iextra]]->id);
+}
+
+/* ----------------------------------------------------------------------
+   global fix data is written by proc 0 into a temporary file
+   in the same layout as in a restart file (size in bytes + data)
+   fix mesh is handled in save_meshes() since its restart() adds elements
+------------------------------------------------------------------------- */
+
+void FixSnapshot::save_fixes()
+{
+  global_id.clear();
+  global_style.clear();
+  global_state.clear();
+
+  for (int i = 0; i < modify->nfix; i++) {
+    Fix *fix = modify->fix[i];
+    if (!fix->restart_global || dynamic_cast<FixMesh*>(fix)) continue;
+
+    FILE *fp = NULL;
+
+    if (comm->me == 0) {
+      fp = tmpfile();
+      if (fp == NULL) error->one(FLERR,"Snapshot could not open temporary file");
+    }
+
+    fix->write_restart(fp);
+
+    int size = 0;
+    std::vector<char> state;
+
+    if (comm->me == 0) {
+      const long nstream = ftell(fp);
+      rewind(fp);
+      if (nstream >= (long) sizeof(int)) {
+        if (fread(&size,sizeof(int),1,fp) != 1 || size < 0 ||
+            nstream < (long) sizeof(int) + size)
+          error->one(FLERR,"Snapshot received corrupted fix restart data");
+        state.resize(size);
+        if (size && fread(&state[0],sizeof(char),size,fp) != (size_t) size)
+          error->one(FLERR,"Snapshot received corrupted fix restart data");
+      }
+      fclose(fp);
+    }
+
+    MPI_Bcast(&size,1,MPI_INT,0,world);
+    state.resize(size);
+    if (size) MPI_Bcast(&state[0],size,MPI_CHAR,0,world);
+
+    global_id.push_back(fix->id);
+    global_style.push_back(fix->style);
+    global_state.push_back(state);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   element geometry of owned elements is summed into a global array
+   so they can be restored regardless of where elements reside later
+------------------------------------------------------------------------- */
+
+void FixSnapshot::save_meshes()
+{
+  mesh_id.clear();
+  mesh_nodes.clear();
+
+  for (int i = 0; i < modify->nfix; i++) {
+    FixMeshSurface *fix_mesh = dynamic_cast<FixMeshSurface*>(modify->fix[i]);
+    if (!fix_mesh) continue;
+
+    TriMesh *mesh = fix_mesh->triMesh();
+    const int nlocal = mesh->sizeLocal();
+    const int nnodes = mesh->numNodes();
+
+    int idmax = -1, idmax_all;
+    for (int iel = 0; iel < nlocal; iel++)
+      idmax = MAX(idmax,mesh->id(iel));
+    MPI_Allreduce(&idmax,&idmax_all,1,MPI_INT,MPI_MAX,world);
+
+    // per element: nodes, center, bounding radius
+
+    const int nper = nnodes*3 + 4;
+    const int nvalues = (idmax_all+1)*nper;
+    std::vector<double> nodes(nvalues,0.);
+    std::vector<double> nodes_all(nvalues,0.);
+    double ***node = mesh->nodePtr();
+
+    for (int iel = 0; iel < nlocal; iel++) {
+      double *ptr = &nodes[mesh->id(iel)*nper];
+      for (int j = 0; j < nnodes; j++)
+        for (int k = 0; k < 3; k++)
+          ptr[j*3+k] = node[iel][j][k];
+      ptr += nnodes*3;
+      mesh->center(iel,ptr);
+      ptr[3] = mesh->rBound_(iel);
+    }
+
+    if (nvalues)
+      MPI_Allreduce(&nodes[0],&nodes_all[0],nvalues,MPI_DOUBLE,MPI_SUM,world);
+
+    mesh_id.push_back(fix_mesh->id);
+    mesh_nodes.push_back(nodes_all);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   roll back to captured state
+   neighbor lists, ghosts and mesh properties are rebuilt by the setup
+   of the next run, just as after read_restart
+------------------------------------------------------------------------- */
+
+void FixSnapshot::restore()
+{
+  if (!saved) error->all(FLERR,"Snapshot restore called before snapshot save");
+
+  // flush contact history into per-atom arrays so that setup of the
+  // next run does not overwrite restored data with the old neighbor lists
+
+  modify->setup_pre_exchange();
+
+  restore_time();
+  restore_atoms();
+  restore_fixes();
+  restore_meshes();
+}
+
+/* ----------------------------------------------------------------------
+   reset timestep first so that fixes shift their time-dependent state
+   before it is overwritten with the captured one
+------------------------------------------------------------------------- */
+
+void FixSnapshot::restore_time()
+{
+  update->set_force_dt_reset(true);
+  update->reset_timestep(ntimestep);
+  update->set_force_dt_reset(false);
+  update->atimestep = atimestep;
+  update->atime = atime;
+
+  for (int dim = 0; dim < 3; dim++) {
+    domain->boxlo[dim] = boxlo[dim];
+    domain->boxhi[dim] = boxhi[dim];
+  }
+  domain->xy = xy;
+  domain->xz = xz;
+  domain->yz = yz;
+
+  domain->set_global_box();
+  domain->set_local_box();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSnapshot::restore_atoms()
+{
+  AtomVec *avec = atom->avec;
+
+  atom->nlocal = 0;
+  atom->nghost = 0;
+  atom->natoms = natoms;
+
+  // per-atom fix data goes through atom->extra as in read_restart
+
+  if (nextra) {
+    memory->destroy(atom->extra);
+    memory->create(atom->extra,atom->nmax,nextra,"atom:extra");
+    atom->nextra_store = nextra;
+  }
+
+  int m = 0;
+  while (m < nabuf) m += avec->unpack_restart(&abuf[m]);
+
+  int nlocal = atom->nlocal;
+  for (int j = 0; j < (int) peratom_id.size(); j++) {
+    int ifix = modify->find_fix(peratom_id[j].c_str());
+    if (ifix < 0) {
+      char str[200];
+      sprintf(str,"Snapshot restore: fix %s holding per-atom data was deleted",
+              peratom_id[j].c_str());
+      error->all(FLERR,str);
+    }
+    Fix *fix = modify->fix[ifix];
+    for (int i = 0; i < nlocal; i++) fix->unpack_restart(i,j);
+    fix->recent_restart = 1;
+  }
+
+  if (atom->nextra_store) {
+    memory->destroy(atom->extra);
+    atom->extra = NULL;
+    atom->nextra_store = 0;
+  }
+
+  for (int iextra = 0; iextra < atom->nextra_restart; iextra++) {
+    Fix *fix = modify->fix[atom->extra_restart[iextra]];
+    bool found = false;
+    for (int j = 0; j < (int) peratom_id.size(); j++)
+      if (peratom_id[j] == fix->id) found = true;
+    if (!found && comm->me == 0) {
+      char str[200];
+      sprintf(str,"Snapshot restore: per-atom data of fix %s "
+              "was not part of the snapshot",fix->id);
+      error->warning(FLERR,str);
+    }
+  }
+
+  // move atoms that are far from their owning proc,
+  // e.g. after load-balancing, the next run does the rest
+
+  if (atom->map_style) atom->map_init();
+  if (domain->triclinic) domain->x2lamda(atom->nlocal);
+  Irregular *irregular = new Irregular(lmp);
+  if (irregular->migrate_check()) irregular->migrate_atoms();
+  delete irregular;
+  if (domain->triclinic) domain->lamda2x(atom->nlocal);
+
+  bigint nblocal = atom->nlocal;
+  bigint ntotal;
+  MPI_Allreduce(&nblocal,&ntotal,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  if (ntotal != natoms)
+    error->all(FLERR,"Snapshot restore did not assign all atoms correctly");
+
+  if (atom->map_style) {
+    atom->map_init();
+    atom->map_set();
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSnapshot::restore_fixes()
+{
+  for (int k = 0; k < (int) global_id.size(); k++) {
+    Fix *fix = modify->find_fix_id(global_id[k].c_str());
+    if (!fix || strcmp(fix->style,global_style[k].c_str()) != 0) {
+      if (comm->me == 0) {
+        char str[200];
+        sprintf(str,"Snapshot restore: fix %s not found, its state is not restored",
+                global_id[k].c_str());
+        error->warning(FLERR,str);
+      }
+      continue;
+    }
+    if (global_state[k].empty()) continue;
+    fix->restart(&global_state[k][0]);
+    fix->recent_restart = 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   restore nodes, centers and bounding radii of owned and ghost elements
+   surface properties are re-calculated in FixMesh::setup_pre_force()
+------------------------------------------------------------------------- */
+
+void FixSnapshot::restore_meshes()
+{
+  for (int k = 0; k < (int) mesh_id.size(); k++) {
+    FixMeshSurface *fix_mesh =
+      dynamic_cast<FixMeshSurface*>(modify->find_fix_id(mesh_id[k].c_str()));
+    if (!fix_mesh) {
+      if (comm->me == 0) {
+        char str[200];
+        sprintf(str,"Snapshot restore: mesh %s not found, its nodes are not restored",
+                mesh_id[k].c_str());
+        error->warning(FLERR,str);
+      }
+      continue;
+    }
+
+    TriMesh *mesh = fix_mesh->triMesh();
+    const int nall = mesh->sizeLocal() + mesh->sizeGhost();
+    const int nnodes = mesh->numNodes();
+    const int nper = nnodes*3 + 4;
+    const int nid = mesh_nodes[k].size() / nper;
+    double ***node = mesh->nodePtr();
+
+    for (int iel = 0; iel < nall; iel++) {
+      const int id = mesh->id(iel);
+      if (id < 0 || id >= nid) continue;
+      const double *ptr = &mesh_nodes[k][id*nper];
+      for (int j = 0; j < nnodes; j++)
+        for (int d = 0; d < 3; d++)
+          node[iel][j][d] = ptr[j*3+d];
+      ptr += nnodes*3;
+      for (int d = 0; d < 3; d++)
+        mesh->center_(iel)[d] = ptr[d];
+      mesh->rBound_(iel) = ptr[3];
+    }
+
+    mesh->updateGlobalBoundingBox();
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixSnapshot::memory_usage()
+{
+  double bytes = maxabuf * sizeof(double);
+  for (int k = 0; k < (int) global_state.size(); k++)
+    bytes += global_state[k].size();
+  for (int k = 0; k < (int) mesh_nodes.size(); k++)
+    bytes += mesh_nodes[k].size() * sizeof(double);
+  return bytes;
+}
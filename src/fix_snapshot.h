@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(SNAPSHOT,FixSnapshot)
+
+#else
+
+#ifndef LMP_FIX_SNAPSHOT_H
+#define LMP_FIX_SNAPSHOT_H
+
+#include "fix.h"
+#include <string>
+#include <vector>
+
+namespace LAMMPS_NS {
+
+/* ----------------------------------------------------------------------
+   in-memory copy of the simulation state, created by the snapshot command
+   atoms and per-atom fix data are stored per processor in restart format,
+   global fix data as written by Fix::write_restart(),
+   mesh element geometry by element ID
+------------------------------------------------------------------------- */
+
+class FixSnapshot : public Fix {
+ public:
+  FixSnapshot(class LAMMPS *, int, char **);
+  ~FixSnapshot();
+  int setmask();
+  double memory_usage();
+
+  void save();
+  void restore();
+
+ private:
+  bool saved;
+
+  // time and box
+
+  bigint ntimestep,atimestep;
+  double atime;
+  bigint natoms;
+  double boxlo[3],boxhi[3];
+  double xy,xz,yz;
+
+  // atoms owned by this proc, packed by AtomVec::pack_restart()
+
+  double *abuf;
+  int nabuf,maxabuf;
+  int nextra;                             // max # of extra values per atom
+
+  // fixes with per-atom restart data, in order of Atom::extra_restart
+
+  std::vector<std::string> peratom_id;
+
+  // fixes with global restart data
+
+  std::vector<std::string> global_id;
+  std::vector<std::string> global_style;
+  std::vector<std::vector<char> > global_state;
+
+  // element geometry of surface meshes, indexed by element ID
+
+  std::vector<std::string> mesh_id;
+  std::vector<std::vector<double> > mesh_nodes;
+
+  void save_atoms();
+  void save_fixes();
+  void save_meshes();
+  void restore_time();
+  void restore_atoms();
+  void restore_fixes();
+  void restore_meshes();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Snapshot restore called before snapshot save
+
+Self-explanatory.
+
+E: Snapshot restore: fix holding per-atom data was deleted
+
+Per-atom data can only be restored into the fix that stored it.
+
+E: Snapshot restore did not assign all atoms correctly
+
+Atoms could not be migrated to the processors owning them.
+
+W: Snapshot restore: fix not found, its state is not restored
+
+The fix was deleted after the snapshot was saved.
+
+*/
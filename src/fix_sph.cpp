@@ -68,6 +68,7 @@ FixSph::FixSph(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg)
 {
   kernel_flag = 1;  // default: kernel is used
+  neighlist_flag = 1;
   kernel_id = -1;   // default value
   kernel_cut = -1;
   kernel_style = NULL;
@@ -104,9 +105,11 @@ void FixSph::init()
   int ntypes = atom->ntypes;
   // need a half neighbor list, built when ever re-neighboring occurs
 
-  int irequest = neighbor->request((void *) this);
-  neighbor->requests[irequest]->pair = 0;
-  neighbor->requests[irequest]->fix = 1;
+  if (neighlist_flag) {
+    int irequest = neighbor->request((void *) this);
+    neighbor->requests[irequest]->pair = 0;
+    neighbor->requests[irequest]->fix = 1;
+  }
 
   if (strcmp(update->integrate_style,"respa") == 0)
     nlevels_respa = ((Respa *) update->integrate)->nlevels;
@@ -59,6 +59,7 @@ class FixSph : public Fix {
   inline void set_kernel_id(int newid){kernel_id = newid;};
 
   int kernel_flag;        // 1 if Fix uses sph kernel, 0 if not
+  int neighlist_flag;     // 1 if Fix requests its own neighbor list, 0 if not
 
  protected:
   inline double interpDist(double disti, double distj) {return 0.5*(disti+distj);};
@@ -0,0 +1,382 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <mpi.h>
+#include <string.h>
+#include <stdlib.h>
+#include "fix_sph_density_fused.h"
+#include "update.h"
+#include "atom.h"
+#include "force.h"
+#include "pair.h"
+#include "pair_sph.h"
+#include "modify.h"
+#include "comm.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "memory.h"
+#include "error.h"
+#include "sph_kernels.h"
+#include "fix_property_atom.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+/* ---------------------------------------------------------------------- */
+
+FixSphDensityFused::FixSphDensityFused(LAMMPS *lmp, int narg, char **arg) :
+  FixSph(lmp, narg, arg),
+  every_(0),
+  ago_(0),
+  cache_list_(NULL),
+  cache_step_(-1),
+  cache_ncalls_(-1),
+  nmax_(0),
+  rhoSum_(NULL),
+  shepard_(NULL)
+{
+  int iarg = 3;
+
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"shepard") == 0) {
+      if (iarg+3 > narg) error->fix_error(FLERR,this,"not enough arguments for 'shepard'");
+      if (strcmp(arg[iarg+1],"every") != 0) error->fix_error(FLERR,this,"expecting keyword 'every' after 'shepard'");
+      every_ = force->inumeric(FLERR,arg[iarg+2]);
+      if (every_ <= 0) error->fix_error(FLERR,this,"every <= 0 not allowed");
+      iarg += 3;
+    } else if (strcmp(arg[iarg],"sphkernel") == 0) {
+      if (iarg+2 > narg) error->fix_error(FLERR,this,"not enough arguments for 'sphkernel'");
+
+      if(kernel_style) delete []kernel_style;
+      kernel_style = new char[strlen(arg[iarg+1])+1];
+      strcpy(kernel_style,arg[iarg+1]);
+
+      // check uniqueness of kernel IDs
+
+      int flag = SPH_KERNEL_NS::sph_kernels_unique_id();
+      if(flag < 0) error->fix_error(FLERR,this,"Cannot proceed, sph kernels need unique IDs, check all sph_kernel_* files");
+
+      // get kernel id
+
+      kernel_id = SPH_KERNEL_NS::sph_kernel_id(kernel_style);
+      if(kernel_id < 0) error->fix_error(FLERR,this,"unknown sph kernel");
+
+      iarg += 2;
+    } else error->fix_error(FLERR,this,"unknown keyword");
+  }
+
+  // traverses the neighbor list of the pair style
+
+  neighlist_flag = 0;
+  time_depend = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixSphDensityFused::~FixSphDensityFused()
+{
+  memory->destroy(rhoSum_);
+  memory->destroy(shepard_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixSphDensityFused::setmask()
+{
+  int mask = 0;
+  mask |= PRE_FORCE;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSphDensityFused::init()
+{
+  FixSph::init();
+
+  if (!force->pair || !dynamic_cast<PairSph*>(force->pair))
+    error->fix_error(FLERR,this,"requires a sph pair style");
+  if (force->newton_pair)
+    error->fix_error(FLERR,this,"requires newton pair off");
+
+  // fix nve/sph integrates drho
+  // fix sph/pressure has to come after me to see the corrected density
+  // and communicates density and pressure to ghosts
+
+  int idx_integ = -1, idx_pres = -1, idx_me = -1;
+  for(int i = 0; i < modify->nfix; i++)
+  {
+    if(modify->fix[i] == this) idx_me = i;
+    if(idx_integ < 0 && (strncmp("nve/sph",modify->fix[i]->style,7) == 0 || strncmp("nve/xsph",modify->fix[i]->style,8) == 0))
+      idx_integ = i;
+    if(idx_pres < 0 && strcmp("sph/pressure",modify->fix[i]->style) == 0)
+      idx_pres = i;
+    if(i != idx_me && strncmp("sph/density",modify->fix[i]->style,11) == 0)
+      error->fix_error(FLERR,this,"cannot be used together with other fix sph/density styles");
+  }
+
+  if(idx_integ == -1) error->fix_error(FLERR,this,"Requires to define a fix nve/sph also");
+  if(idx_pres < idx_me) error->fix_error(FLERR,this,"Requires a fix sph/pressure defined after this fix");
+
+  cache_step_ = -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSphDensityFused::pre_force(int)
+{
+  //template function for using per atom or per atomtype smoothing length
+  if (mass_type) pre_force_eval<1>();
+  else pre_force_eval<0>();
+}
+
+/* ----------------------------------------------------------------------
+   single traversal of the pair neighbor list:
+   density rate (continuity equation), shepard sums if due and
+   kernel values and gradients for the pair style
+   ghost positions, velocities and densities are current from the
+   regular communication at the start of the step
+------------------------------------------------------------------------- */
+
+template <int MASSFLAG>
+void FixSphDensityFused::pre_force_eval()
+{
+  int itype = 0,jtype;
+  double sli = 0.,slj,slCom,imass,jmass;
+
+  double **x = atom->x;
+  double **v = atom->vest;
+  double *rho = atom->rho;
+  double *drho = atom->drho;
+  int *mask = atom->mask;
+  const int nlocal = atom->nlocal;
+  const int nall = nlocal + atom->nghost;
+
+  int *type = atom->type;       // if MASSFLAG
+  double *mass = atom->mass;    // if MASSFLAG
+  double *rmass = atom->rmass;  // if !MASSFLAG
+  double *radius = atom->radius;  // if !MASSFLAG
+  double ** const cutsqPair = force->pair->cutsq;  // if MASSFLAG
+
+  if (!MASSFLAG) fppaSl->do_forward_comm();
+  updatePtrs(); // get sl
+
+  NeighList * const plist = force->pair->list;
+  const int inum = plist->inum;
+  int * const ilist = plist->ilist;
+  int * const numneigh = plist->numneigh;
+  int ** const firstneigh = plist->firstneigh;
+
+  // shepard correction due this step
+
+  bool correct = false;
+  if (every_ > 0 && ++ago_ % every_ == 0) {
+    ago_ = 0;
+    correct = true;
+  }
+
+  if (correct) {
+    if (nall > nmax_) {
+      nmax_ = nall;
+      memory->destroy(rhoSum_);
+      memory->destroy(shepard_);
+      memory->create(rhoSum_,nmax_,"sph/density/fused:rhoSum_");
+      memory->create(shepard_,nmax_,"sph/density/fused:shepard_");
+    }
+
+    // contribution of self
+
+    for (int i = 0; i < nlocal; i++) {
+      if (MASSFLAG) {
+        itype = type[i];
+        sli = sl[itype-1];
+        imass = mass[itype];
+      } else {
+        sli = sl[i];
+        imass = rmass[i];
+      }
+
+      const double W = SPH_KERNEL_NS::sph_kernel(kernel_id,0.,sli,1./sli);
+      if (W < 0.) error->one(FLERR,"Illegal kernel used, W < 0");
+
+      rhoSum_[i] = W*imass;
+      shepard_[i] = W*imass / rho[i];
+    }
+  }
+
+  // offsets of the atoms into the cache
+
+  offset_.resize(inum+1);
+  offset_[0] = 0;
+  for (int ii = 0; ii < inum; ii++)
+    offset_[ii+1] = offset_[ii] + numneigh[ilist[ii]];
+  cache_.resize(offset_[inum]+1);
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    int * const jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+    SphPairData * const data = &cache_[offset_[ii]];
+
+    if (!(mask[i] & groupbit)) {
+      for (int jj = 0; jj < jnum; jj++)
+        data[jj].rinv = 0.;
+      continue;
+    }
+
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+
+    if (MASSFLAG) {
+      itype = type[i];
+      imass = mass[itype];
+    } else {
+      imass = rmass[i];
+      sli = sl[i];
+    }
+
+    for (int jj = 0; jj < jnum; jj++) {
+      const int j = jlist[jj];
+      data[jj].rinv = 0.;
+
+      if (!(mask[j] & groupbit)) continue;
+
+      if (MASSFLAG) {
+        jtype = type[j];
+        jmass = mass[jtype];
+        slCom = slComType[itype][jtype];
+      } else {
+        jmass = rmass[j];
+        slj = sl[j];
+        slCom = interpDist(sli,slj);
+      }
+
+      const double cut = slCom*kernel_cut;
+      const double delx = xtmp - x[j][0];
+      const double dely = ytmp - x[j][1];
+      const double delz = ztmp - x[j][2];
+      const double rsq = delx*delx + dely*dely + delz*delz;
+
+      // pair style uses its own cutoff: type-based cutsq or
+      // radius-based for per-atom smoothing length
+
+      bool inPair;
+      if (MASSFLAG) {
+        inPair = rsq < cutsqPair[itype][jtype];
+      } else {
+        const double rcom = interpDist(radius[i],radius[j]);
+        inPair = rsq < rcom*rcom;
+      }
+      const bool inKernel = rsq < cut*cut;
+
+      if (!inPair && !inKernel) continue;
+
+      const double r = sqrt(rsq);
+      if (r == 0.) {
+        fprintf(screen,"Particle %i and %i are at same position (%f, %f, %f)\n",i,j,xtmp,ytmp,ztmp);
+        error->one(FLERR,"Zero distance between SPH particles!");
+      }
+      const double rinv = 1./r;
+      const double slComInv = 1./slCom;
+      const double s = r*slComInv;
+
+      const double gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+      const double W = SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv);
+
+      if (inPair) {
+        data[jj].rinv = rinv;
+        data[jj].W = W;
+        data[jj].gradWmag = gradWmag;
+      }
+
+      if (!inKernel) continue;
+      if (W < 0.) error->one(FLERR,"Illegal kernel used, W < 0");
+
+      // continuity equation
+      // have a half neigh list and newton off, so do it for local j
+
+      const double delVDotDelR = rinv * ( delx*(v[i][0]-v[j][0]) + dely*(v[i][1]-v[j][1]) + delz*(v[i][2]-v[j][2]) );
+
+      drho[i] += jmass*gradWmag*delVDotDelR;
+      if (j < nlocal) drho[j] += imass*gradWmag*delVDotDelR;
+
+      // shepard sums with densities before correction
+
+      if (correct) {
+        rhoSum_[i] += W*jmass;
+        shepard_[i] += W*jmass / rho[j];
+        if (j < nlocal) {
+          rhoSum_[j] += W*imass;
+          shepard_[j] += W*imass / rho[i];
+        }
+      }
+    }
+  }
+
+  // normalize rho
+  // ghosts are updated by fix sph/pressure together with the pressure
+
+  if (correct) {
+    for (int i = 0; i < nlocal; i++)
+      if (mask[i] & groupbit)
+        rho[i] = rhoSum_[i]/shepard_[i];
+  }
+
+  cache_list_ = plist;
+  cache_step_ = update->ntimestep;
+  cache_ncalls_ = neighbor->ncalls;
+}
+
+/* ----------------------------------------------------------------------
+   cache is valid if computed this step for the same neighbor list build,
+   with the same kernel, and for all atoms
+------------------------------------------------------------------------- */
+
+bool FixSphDensityFused::pair_cache_valid(const NeighList *plist, const int pair_kernel_id) const
+{
+  return igroup == 0 &&
+         plist == cache_list_ &&
+         cache_step_ == update->ntimestep &&
+         cache_ncalls_ == neighbor->ncalls &&
+         pair_kernel_id == kernel_id;
+}
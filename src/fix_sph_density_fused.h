@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(sph/density/fused,FixSphDensityFused)
+
+#else
+
+#ifndef LMP_FIX_SPH_DENSITY_FUSED_H
+#define LMP_FIX_SPH_DENSITY_FUSED_H
+
+#include "fix_sph.h"
+#include <vector>
+
+namespace LAMMPS_NS {
+
+// kernel data of one entry of the pair neighbor list
+// rinv = 0 if the pair is not within the cutoff of the pair style
+
+struct SphPairData {
+  double rinv;
+  double W;
+  double gradWmag;
+};
+
+class FixSphDensityFused : public FixSph {
+ public:
+  FixSphDensityFused(class LAMMPS *, int, char **);
+  ~FixSphDensityFused();
+  int setmask();
+  void init();
+  void pre_force(int);
+
+  // kernel data of the current step, stored in order of the pair
+  // neighbor list, entries of atom ilist[ii] start at pair_cache_offset()[ii]
+
+  bool pair_cache_valid(const class NeighList *plist, const int pair_kernel_id) const;
+  inline const SphPairData *pair_cache() const
+  { return &cache_[0]; }
+  inline const int *pair_cache_offset() const
+  { return &offset_[0]; }
+
+ private:
+  template <int> void pre_force_eval();
+
+  // shepard correction every this many steps, 0 if off
+  int every_;
+  int ago_;
+
+  std::vector<SphPairData> cache_;
+  std::vector<int> offset_;
+  const class NeighList *cache_list_;
+  bigint cache_step_;
+  bigint cache_ncalls_;
+
+  // shepard sums
+  int nmax_;
+  double *rhoSum_;
+  double *shepard_;
+};
+
+}
+
+#endif
+#endif
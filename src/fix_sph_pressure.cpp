@@ -57,7 +57,6 @@
 #include "neigh_request.h"
 #include "memory.h"
 #include "error.h"
-#include "timer.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -118,6 +117,9 @@ FixSPHPressure::FixSPHPressure(LAMMPS *lmp, int narg, char **arg) :
     else error->fix_error(FLERR,this,"Unknown style. Valid styles are 'absolut' or 'Tait' \n");
 
     kernel_flag = 0; // does not need any kernel
+    neighlist_flag = 0;
+    comm_ghosts_ = false;
+    comm_forward = 2;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -160,6 +162,8 @@ void FixSPHPressure::init()
   }
 
   if(dens == -1) error->fix_error(FLERR,this,"Requires to define a fix sph/density also \n");
+
+  comm_ghosts_ = (strcmp("sph/density/fused",modify->fix[dens]->style) == 0);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -209,4 +213,41 @@ void FixSPHPressure::pre_force(int vflag)
       }
     }
   }
+
+  // ghost pressure is needed by the pair style, comm is done
+  // at the sync point before the force computation
+
+  if (comm_ghosts_)
+    comm->queue_forward_comm_fix(this);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixSPHPressure::pack_comm(int n, int *list, double *buf, int pbc_flag, int *pbc)
+{
+  double *rho = atom->rho;
+  double *p = atom->p;
+
+  int m = 0;
+  for (int i = 0; i < n; i++) {
+    const int j = list[i];
+    buf[m++] = rho[j];
+    buf[m++] = p[j];
+  }
+  return 2;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSPHPressure::unpack_comm(int n, int first, double *buf)
+{
+  double *rho = atom->rho;
+  double *p = atom->p;
+
+  int m = 0;
+  const int last = first + n;
+  for (int i = first; i < last; i++) {
+    rho[i] = buf[m++];
+    p[i] = buf[m++];
+  }
 }
@@ -62,6 +62,8 @@ class FixSPHPressure : public FixSph {
   int setmask();
   void init();
   void pre_force(int);
+  int pack_comm(int, int *, double *, int, int *);
+  void unpack_comm(int, int, double *);
 
   double return_rho0() {
     if (pressureStyle == PRESSURESTYLE_ABSOLUT) return 0;
@@ -71,6 +73,10 @@ class FixSPHPressure : public FixSph {
  private:
   int pressureStyle;
   double B,rho0,rho0inv,gamma,P0;
+
+  // with fix sph/density/fused, density and pressure of ghosts
+  // are communicated here after the equation of state
+  bool comm_ghosts_;
 };
 
 }
@@ -466,7 +466,9 @@ void FixStoreState::end_of_step()
       if (which[m] == COMPUTE) {
         Compute *compute = modify->compute[n];
         if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+          compute->begin_time_recording();
           compute->compute_peratom();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_PERATOM;
         }
 
@@ -0,0 +1,508 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <stdlib.h>
+#include <string.h>
+#include "atom.h"
+#include "comm.h"
+#include "domain.h"
+#include "force.h"
+#include "pair.h"
+#include "modify.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+#include "fix_nve_sphere.h"
+#include "fix_wall_gran.h"
+#include "fix_property_atom.h"
+#include "vector_liggghts.h"
+#include "mpi_liggghts.h"
+#include "fix_subcycle_gran.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+#define INERTIA 0.4          // moment of inertia prefactor for sphere
+
+/* ---------------------------------------------------------------------- */
+
+FixSubcycleGran::FixSubcycleGran(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  nsub_(0),
+  dtsub_(0.),
+  pass_(PASS_ALL),
+  fix_ft_fine_(0),
+  nmax_(0),
+  ft_coarse_(0),
+  ft_mixed_(0),
+  ft_other_(0),
+  nfine_(0.)
+{
+    int iarg = 3;
+
+    bool hasargs = true;
+    while(iarg < narg && hasargs)
+    {
+        hasargs = false;
+
+        if(strcmp(arg[iarg],"nsub") == 0) {
+            if(narg < iarg+2)
+                error->fix_error(FLERR,this,"not enough arguments for 'nsub'");
+            nsub_ = atoi(arg[iarg+1]);
+            if(nsub_ < 1)
+                error->fix_error(FLERR,this,"'nsub' >= 1 required");
+            iarg += 2;
+            hasargs = true;
+        } else if(strcmp(style,"subcycle/gran") == 0)
+            error->fix_error(FLERR,this,"unknown keyword");
+    }
+
+    if(nsub_ == 0)
+        error->fix_error(FLERR,this,"expecting keyword 'nsub'");
+
+    time_integrate = 1;
+
+    scalar_flag = 1;
+    global_freq = 1;
+    extscalar = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixSubcycleGran::~FixSubcycleGran()
+{
+    memory->destroy(ft_coarse_);
+    memory->destroy(ft_mixed_);
+    memory->destroy(ft_other_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSubcycleGran::post_create()
+{
+    // force and torque of the sub-cycled particles, carried over to the next coarse step
+
+    const char * fixarg[15];
+
+    sprintf(fixid_,"subcycleForceTorque_%s",id);
+    fixarg[0]=fixid_;
+    fixarg[1]="all";
+    fixarg[2]="property/atom";
+    fixarg[3]=fixid_;
+    fixarg[4]="vector";
+    fixarg[5]="no";     // restart
+    fixarg[6]="no";     // communicate ghost
+    fixarg[7]="no";     // communicate rev
+    fixarg[8]="0.";
+    fixarg[9]="0.";
+    fixarg[10]="0.";
+    fixarg[11]="0.";
+    fixarg[12]="0.";
+    fixarg[13]="0.";
+    modify->add_fix(14,const_cast<char**>(fixarg));
+
+    fix_ft_fine_ = static_cast<FixPropertyAtom*>(modify->find_fix_property(fixid_,"property/atom","vector",6,0,style));
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSubcycleGran::pre_delete(bool unfixflag)
+{
+    if (unfixflag) modify->delete_fix(fixid_);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixSubcycleGran::setmask()
+{
+    int mask = 0;
+    mask |= PRE_FORCE;
+    mask |= PRE_FINAL_INTEGRATE;
+    return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSubcycleGran::init()
+{
+    if (!atom->sphere_flag)
+        error->fix_error(FLERR,this,"requires atom style sphere");
+    if (!comm->ghost_velocity)
+        error->fix_error(FLERR,this,"requires ghost atoms store velocity, use 'communicate single vel yes'");
+    if (!strstr(update->integrate_style,"verlet"))
+        error->fix_error(FLERR,this,"requires run_style verlet");
+    if (!force->pair_match("gran",0))
+        error->fix_error(FLERR,this,"requires a granular pair style");
+    if (modify->n_fixes_style("subcycle/gran") > 1)
+        error->fix_error(FLERR,this,"may only be used once");
+    if (modify->n_fixes_style("multisphere") > 0 || modify->n_fixes_style("rigid") > 0)
+        error->fix_error(FLERR,this,"does not support rigid bodies");
+    if (modify->n_fixes_style("heat/gran") > 0)
+        error->fix_error(FLERR,this,"does not support heat transfer");
+
+    // fused forces of fix nve/sphere are not applied to the sub-cycled particles
+
+    for (int ifix = 0; ifix < modify->n_fixes_style("nve/sphere"); ifix++)
+    {
+        FixNVESphere *fnve = static_cast<FixNVESphere*>(modify->find_fix_style("nve/sphere",ifix));
+        if (fnve->fused())
+            error->fix_error(FLERR,this,"cannot be used together with fix nve/sphere 'fused yes'");
+    }
+
+    // particles of this fix must not be integrated by any other fix
+
+    const int *const mask = atom->mask;
+    const int nlocal = atom->nlocal;
+    int overlap = 0;
+    for (int ifix = 0; ifix < modify->nfix; ifix++)
+    {
+        Fix *fix = modify->fix[ifix];
+        if (fix == this || !fix->time_integrate) continue;
+        for (int i = 0; i < nlocal; i++)
+            if ((mask[i] & groupbit) && (mask[i] & fix->groupbit))
+                overlap = 1;
+    }
+    MPI_Max_Scalar(overlap,world);
+    if (overlap)
+        error->fix_error(FLERR,this,"particles of the group must not be integrated by another fix");
+
+    // fixes re-applied in every sub-step, other post_force fixes are
+    // only invoked once per coarse step, their contribution to the
+    // sub-cycled particles is added in every sub-step
+    // fixes that set instead of add forces cannot be treated this way
+
+    fix_substep_.clear();
+    for (int ifix = 0; ifix < modify->nfix; ifix++)
+    {
+        if (!(modify->fmask[ifix] & POST_FORCE)) continue;
+        Fix *fix = modify->fix[ifix];
+        if (strcmp(fix->style,"gravity") == 0 || strcmp(fix->style,"viscous") == 0 ||
+            strcmp(fix->style,"wall/gran") == 0)
+        {
+            fix_substep_.push_back(fix);
+            continue;
+        }
+
+        if (strcmp(fix->style,"setforce") != 0 && strcmp(fix->style,"freeze") != 0 &&
+            strcmp(fix->style,"aveforce") != 0 && strcmp(fix->style,"enforce2d") != 0 &&
+            strcmp(fix->style,"lineforce") != 0 && strcmp(fix->style,"planeforce") != 0)
+            continue;
+
+        int overlap_set = 0;
+        for (int i = 0; i < nlocal; i++)
+            if ((mask[i] & groupbit) && (mask[i] & fix->groupbit))
+                overlap_set = 1;
+        MPI_Max_Scalar(overlap_set,world);
+        if (overlap_set)
+        {
+            char str[512];
+            sprintf(str,"does not support fix %s %s acting on particles of the group, "
+                    "since it sets forces",fix->style,fix->id);
+            error->fix_error(FLERR,this,str);
+        }
+    }
+
+    fix_ft_fine_ = static_cast<FixPropertyAtom*>(modify->find_fix_property(fixid_,"property/atom","vector",6,0,style));
+
+    reset_dt();
+    pass_ = PASS_ALL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSubcycleGran::reset_dt()
+{
+    dtsub_ = update->dt / static_cast<double>(nsub_);
+}
+
+/* ----------------------------------------------------------------------
+   forces of setup() contain all contacts, store them for the first sub-step
+------------------------------------------------------------------------- */
+
+void FixSubcycleGran::setup(int vflag)
+{
+    // walls that accumulate forces, stresses or energies over the time-step
+    // would count contacts of sub-cycled particles nsub times
+    // checked here since compute wall/gran/local registers after init()
+
+    for (size_t k = 0; k < fix_substep_.size(); k++)
+        if (strcmp(fix_substep_[k]->style,"wall/gran") == 0 &&
+            !static_cast<FixWallGran*>(fix_substep_[k])->subcyclable())
+        {
+            char str[512];
+            sprintf(str,"does not support fix wall/gran %s, which stores forces, stresses, wear or energies",
+                    fix_substep_[k]->id);
+            error->fix_error(FLERR,this,str);
+        }
+
+    double **f = atom->f;
+    double **torque = atom->torque;
+    double **ft_fine = fix_ft_fine_->array_atom;
+    const int *const mask = atom->mask;
+    const int nlocal = atom->nlocal;
+
+    int nfine = 0;
+    for (int i = 0; i < nlocal; i++)
+    {
+        if (!(mask[i] & groupbit)) continue;
+        vectorCopy3D(f[i],&(ft_fine[i][0]));
+        vectorCopy3D(torque[i],&(ft_fine[i][3]));
+        nfine++;
+    }
+    MPI_Sum_Scalar(nfine,world);
+    nfine_ = static_cast<double>(nfine);
+
+    pass_ = PASS_ALL;
+}
+
+/* ----------------------------------------------------------------------
+   main force evaluation of the coarse step skips all sub-cycled contacts
+------------------------------------------------------------------------- */
+
+void FixSubcycleGran::pre_force(int vflag)
+{
+    pass_ = PASS_COARSE;
+}
+
+/* ----------------------------------------------------------------------
+   integrate the sub-cycled particles over the coarse step in nsub
+   velocity-Verlet sub-steps; coarse particles are held at their
+   positions of the end of the coarse step and receive the mean force of
+   their contacts with sub-cycled particles
+   called after all post_force() contributions of the coarse step, so
+   the coarse forces are complete
+------------------------------------------------------------------------- */
+
+void FixSubcycleGran::pre_final_integrate()
+{
+    const double dt = update->dt;
+
+    grow_arrays_local();
+
+    double **f = atom->f;
+    double **torque = atom->torque;
+    double **ft_fine = fix_ft_fine_->array_atom;
+    const int *const mask = atom->mask;
+    const int nlocal = atom->nlocal;
+
+    // store the coarse forces
+    // contacts of sub-cycled particles are skipped in the coarse pass, so
+    // their coarse force minus that of the fixes re-applied in the
+    // sub-steps is the contribution of all other post_force fixes
+    // wall/gran adds nothing to sub-cycled particles in the coarse pass
+
+    for (int i = 0; i < nlocal; i++)
+    {
+        vectorCopy3D(f[i],&(ft_coarse_[i][0]));
+        vectorCopy3D(torque[i],&(ft_coarse_[i][3]));
+        vectorZeroize3D(f[i]);
+        vectorZeroize3D(torque[i]);
+    }
+
+    for (size_t k = 0; k < fix_substep_.size(); k++)
+        if (strcmp(fix_substep_[k]->style,"wall/gran") != 0)
+            fix_substep_[k]->post_force(0);
+
+    // restore forces of last sub-step for sub-cycled particles
+
+    int nfine = 0;
+    for (int i = 0; i < nlocal; i++)
+    {
+        if (mask[i] & groupbit)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                ft_other_[i][k] = ft_coarse_[i][k] - f[i][k];
+                ft_other_[i][3+k] = ft_coarse_[i][3+k] - torque[i][k];
+            }
+            vectorCopy3D(&(ft_fine[i][0]),f[i]);
+            vectorCopy3D(&(ft_fine[i][3]),torque[i]);
+            nfine++;
+        }
+        else
+            vectorZeroizeN(ft_mixed_[i],6);
+    }
+    MPI_Sum_Scalar(nfine,world);
+    nfine_ = static_cast<double>(nfine);
+
+    if (nfine > 0)
+    {
+        // contact models read the time-step from update, so the
+        // tangential history of sub-cycled contacts is built up with dtsub
+
+        update->dt = dtsub_;
+
+        for (int isub = 0; isub < nsub_; isub++)
+        {
+            integrate_half(true);
+
+            comm->forward_comm();
+
+            const int nall = atom->nlocal + atom->nghost;
+            for (int i = 0; i < nall; i++)
+            {
+                vectorZeroize3D(f[i]);
+                vectorZeroize3D(torque[i]);
+            }
+
+            pass_ = PASS_FINE;
+            force->pair->compute(0,0);
+            if (force->newton) comm->reverse_comm();
+
+            // mixed contacts of coarse particles; other forces acting on
+            // coarse particles are already contained in the coarse force
+
+            for (int i = 0; i < nlocal; i++)
+            {
+                if (mask[i] & groupbit) continue;
+                vectorAdd3D(&(ft_mixed_[i][0]),f[i],&(ft_mixed_[i][0]));
+                vectorAdd3D(&(ft_mixed_[i][3]),torque[i],&(ft_mixed_[i][3]));
+            }
+
+            for (size_t k = 0; k < fix_substep_.size(); k++)
+                fix_substep_[k]->post_force(0);
+
+            for (int i = 0; i < nlocal; i++)
+            {
+                if (!(mask[i] & groupbit)) continue;
+                vectorAdd3D(f[i],&(ft_other_[i][0]),f[i]);
+                vectorAdd3D(torque[i],&(ft_other_[i][3]),torque[i]);
+            }
+
+            integrate_half(false);
+        }
+
+        update->dt = dt;
+    }
+
+    pass_ = PASS_ALL;
+
+    // coarse particles: coarse force plus mean of the mixed contacts
+    // sub-cycled particles: keep force of last sub-step for next coarse step
+
+    const double nsubinv = 1./static_cast<double>(nsub_);
+    for (int i = 0; i < nlocal; i++)
+    {
+        if (mask[i] & groupbit)
+        {
+            vectorCopy3D(f[i],&(ft_fine[i][0]));
+            vectorCopy3D(torque[i],&(ft_fine[i][3]));
+        }
+        else
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                f[i][k] = ft_coarse_[i][k] + nsubinv*ft_mixed_[i][k];
+                torque[i][k] = ft_coarse_[i][3+k] + nsubinv*ft_mixed_[i][3+k];
+            }
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   half sub-step for v and omega of the sub-cycled particles,
+   optionally followed by a full sub-step for x
+------------------------------------------------------------------------- */
+
+void FixSubcycleGran::integrate_half(const bool drift)
+{
+    double **x = atom->x;
+    double **v = atom->v;
+    double **f = atom->f;
+    double **omega = atom->omega;
+    double **torque = atom->torque;
+    const double *const radius = atom->radius;
+    const double *const rmass = atom->rmass;
+    const int *const mask = atom->mask;
+    const int nlocal = atom->nlocal;
+
+    const double dtf = 0.5 * dtsub_ * force->ftm2v;
+    double dtfrotate;
+    if (domain->dimension == 2) dtfrotate = dtf / 0.5;
+    else dtfrotate = dtf / INERTIA;
+
+    for (int i = 0; i < nlocal; i++)
+    {
+        if (!(mask[i] & groupbit)) continue;
+
+        const double dtfm = dtf / rmass[i];
+        v[i][0] += dtfm * f[i][0];
+        v[i][1] += dtfm * f[i][1];
+        v[i][2] += dtfm * f[i][2];
+
+        const double dtirotate = dtfrotate / (radius[i]*radius[i]*rmass[i]);
+        omega[i][0] += dtirotate * torque[i][0];
+        omega[i][1] += dtirotate * torque[i][1];
+        omega[i][2] += dtirotate * torque[i][2];
+
+        if (drift)
+        {
+            x[i][0] += dtsub_ * v[i][0];
+            x[i][1] += dtsub_ * v[i][1];
+            x[i][2] += dtsub_ * v[i][2];
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSubcycleGran::grow_arrays_local()
+{
+    if (atom->nmax <= nmax_) return;
+
+    nmax_ = atom->nmax;
+    memory->destroy(ft_coarse_);
+    memory->destroy(ft_mixed_);
+    memory->destroy(ft_other_);
+    memory->create(ft_coarse_,nmax_,6,"subcycle/gran:ft_coarse_");
+    memory->create(ft_mixed_,nmax_,6,"subcycle/gran:ft_mixed_");
+    memory->create(ft_other_,nmax_,6,"subcycle/gran:ft_other_");
+}
+
+/* ----------------------------------------------------------------------
+   # of sub-cycled particles
+------------------------------------------------------------------------- */
+
+double FixSubcycleGran::compute_scalar()
+{
+    return nfine_;
+}
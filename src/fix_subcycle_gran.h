@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(subcycle/gran,FixSubcycleGran)
+
+#else
+
+#ifndef LMP_FIX_SUBCYCLE_GRAN_H
+#define LMP_FIX_SUBCYCLE_GRAN_H
+
+#include "fix.h"
+#include <vector>
+
+namespace LAMMPS_NS {
+
+class FixSubcycleGran : public Fix {
+
+ public:
+
+  FixSubcycleGran(class LAMMPS *lmp, int narg, char ** arg);
+  ~FixSubcycleGran();
+
+  void post_create();
+  void pre_delete(bool unfixflag);
+
+  int setmask();
+  void init();
+  void setup(int vflag);
+  void pre_force(int vflag);
+  void pre_final_integrate();
+  void reset_dt();
+
+  double compute_scalar();
+
+  // which pairs and particle-wall contacts are evaluated
+  // PASS_COARSE: main force evaluation of the coarse step, all contacts
+  //              that do not involve a particle of this fix's group
+  // PASS_FINE:   force evaluation of a sub-step, all contacts that
+  //              involve at least one particle of this fix's group
+
+  enum
+  {
+      PASS_ALL,
+      PASS_COARSE,
+      PASS_FINE
+  };
+
+  inline bool skip_pair(const int maski, const int maskj) const
+  {
+      if (pass_ == PASS_ALL)
+          return false;
+      const bool fine = (maski & groupbit) || (maskj & groupbit);
+      return (pass_ == PASS_COARSE) == fine;
+  }
+
+  inline bool skip_particle(const int maski) const
+  {
+      if (pass_ == PASS_ALL)
+          return false;
+      const bool fine = (maski & groupbit);
+      return (pass_ == PASS_COARSE) == fine;
+  }
+
+  inline bool active() const
+  { return pass_ != PASS_ALL; }
+
+ private:
+
+  void integrate_half(const bool drift);
+  void grow_arrays_local();
+
+  // # of sub-steps per coarse time-step
+  int nsub_;
+  double dtsub_;
+
+  int pass_;
+
+  // post_force fixes that are re-applied in every sub-step
+  std::vector<class Fix*> fix_substep_;
+
+  // force and torque of the sub-cycled particles at the end of the last sub-step
+  char fixid_[200];
+  class FixPropertyAtom *fix_ft_fine_;
+
+  // force and torque of coarse particles, split in coarse and mixed contributions
+  // for sub-cycled particles: once per step contribution of other post_force fixes
+  int nmax_;
+  double **ft_coarse_;
+  double **ft_mixed_;
+  double **ft_other_;
+
+  // # of owned sub-cycled particles (global)
+  double nfine_;
+};
+
+}
+
+#endif
+#endif
@@ -48,6 +48,7 @@ a Fortran version of the MC integrator
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 #include "fix_template_multiplespheres.h"
 #include "fix_property_atom.h"
 #include "math_extra.h"
@@ -68,6 +69,11 @@ a Fortran version of the MC integrator
 #include "fix_rigid.h"
 #include "particleToInsert.h"
 #include "input_multisphere.h"
+#include "mpi_liggghts.h"
+
+#if defined(_OPENMP)
+#include "omp.h"
+#endif
 
 using namespace LAMMPS_NS;
 using namespace LMP_PROBABILITY_NS;
@@ -75,12 +81,19 @@ using namespace LMP_PROBABILITY_NS;
 #define LARGE 1e8
 #define EPSILON 1.0e-7
 #define N_SHUFFLE_BOUND 200
+#define OCTREE_LEVEL_MAX 16
 
 /* ---------------------------------------------------------------------- */
 
 FixTemplateMultiplespheres::FixTemplateMultiplespheres(LAMMPS *lmp, int narg, char **arg) :
   FixTemplateSphere(lmp, narg, arg),
-  scale_fact(1.0)
+  scale_fact(1.0),
+  integration_method(INTEGRATION_MC),
+  octree_level(8),
+  cache_dir(0),
+  octree_done(false),
+  volume_octree(0.),
+  volumeweight_octree(0)
 {
   if(pdf_density->rand_style() != RANDOM_CONSTANT) error->all(FLERR,"Fix particletemplate/multiplespheres currently only supports constant density");
   if(pdf_radius) error->fix_error(FLERR,this,"currently does not support keyword 'radius'");
@@ -217,17 +230,17 @@ FixTemplateMultiplespheres::FixTemplateMultiplespheres(LAMMPS *lmp, int narg, ch
             error->fix_error(FLERR,this,"expecting 'yes' or 'no' after 'bonded'");
         iarg+=2;
     }
+    else if(parse_integration_keyword(iarg,narg,arg))
+        hasargs = true;
     else if(strcmp(style,"particletemplate/multiplespheres") == 0)
         error->fix_error(FLERR,this,"unknown keyword");
   }
 
   if(!spheres_read) error->fix_error(FLERR,this,"need to define spheres for the template");
 
-  if(comm->me == 0 && screen) fprintf(screen,"Calculating the properties of the given template.\n   Depending on ntry, this may take a while...\n");
-
-  if(ntry < 1e3) error->fix_error(FLERR,this,"ntry is too low");
-  if(comm->me == 0 && ntry < 1e5) error->warning(FLERR,"fix particletemplate/multisphere: ntry is very low");
-
+  vectorZeroize3D(xcm_octree);
+  for(int i = 0; i < 3; i++)
+    vectorZeroize3D(moi_octree[i]);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -237,6 +250,72 @@ FixTemplateMultiplespheres::~FixTemplateMultiplespheres()
     memory->destroy(x_sphere);
     delete []r_sphere;
     if(atom_type_sphere) delete []atom_type_sphere;
+    if(cache_dir) delete []cache_dir;
+    if(volumeweight_octree) delete []volumeweight_octree;
+}
+
+/* ----------------------------------------------------------------------
+   keywords selecting how the properties of the template are integrated
+   also parsed by derived classes, returns true if a keyword was found
+------------------------------------------------------------------------- */
+
+bool FixTemplateMultiplespheres::parse_integration_keyword(int &iarg, int narg, char **arg)
+{
+    if(strcmp(arg[iarg],"integration") == 0)
+    {
+        if (narg < iarg+2)
+            error->fix_error(FLERR,this,"not enough arguments for 'integration'");
+        if(0 == strcmp(arg[iarg+1],"mc"))
+            integration_method = INTEGRATION_MC;
+        else if(0 == strcmp(arg[iarg+1],"octree"))
+            integration_method = INTEGRATION_OCTREE;
+        else
+            error->fix_error(FLERR,this,"expecting 'mc' or 'octree' after 'integration'");
+        iarg += 2;
+        return true;
+    }
+    else if(strcmp(arg[iarg],"octree_level") == 0)
+    {
+        if (narg < iarg+2)
+            error->fix_error(FLERR,this,"not enough arguments for 'octree_level'");
+        octree_level = atoi(arg[iarg+1]);
+        if(octree_level < 1 || octree_level > OCTREE_LEVEL_MAX)
+            error->fix_error(FLERR,this,"'octree_level' must be between 1 and 16");
+        iarg += 2;
+        return true;
+    }
+    else if(strcmp(arg[iarg],"cache_dir") == 0)
+    {
+        if (narg < iarg+2)
+            error->fix_error(FLERR,this,"not enough arguments for 'cache_dir'");
+        if(cache_dir) delete []cache_dir;
+        cache_dir = new char[strlen(arg[iarg+1])+1];
+        strcpy(cache_dir,arg[iarg+1]);
+        iarg += 2;
+        return true;
+    }
+    return false;
+}
+
+/* ----------------------------------------------------------------------
+   checks before the template properties are integrated
+------------------------------------------------------------------------- */
+
+void FixTemplateMultiplespheres::init_integration()
+{
+    if(INTEGRATION_OCTREE == integration_method)
+    {
+        if(comm->me == 0 && screen) fprintf(screen,"Calculating the properties of the given template using an octree of level %d\n",octree_level);
+        return;
+    }
+
+    if(cache_dir)
+        error->fix_error(FLERR,this,"keyword 'cache_dir' requires 'integration octree'");
+
+    if(comm->me == 0 && screen) fprintf(screen,"Calculating the properties of the given template.\n   Depending on ntry, this may take a while...\n");
+
+    if(ntry < 1e3) error->fix_error(FLERR,this,"ntry is too low");
+    if(comm->me == 0 && ntry < 1e5) error->warning(FLERR,"fix particletemplate/multisphere: ntry is very low");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -246,6 +325,7 @@ void FixTemplateMultiplespheres::post_create()
     // calculate bounding sphere and center of mass
     // also transforms sphere coordinates so that com = 0/0/0
 
+    init_integration();
     calc_bounding_sphere();
     calc_center_of_mass();
 
@@ -457,38 +537,50 @@ void FixTemplateMultiplespheres::generate_xtry(double *x_try)
 
 void FixTemplateMultiplespheres::calc_center_of_mass()
 {
-  // mc integration, calc volume and com, mass weight
-  int nsuccess = 0;
+  double xcm[3];
 
-  double x_try[3],xcm[3],dist_j_sqr;
+  if(INTEGRATION_OCTREE == integration_method)
+  {
+      calc_properties_octree();
+      vectorCopy3D(xcm_octree,xcm);
+      volume_expect = volume_octree;
+  }
+  else
+  {
+      // mc integration, calc volume and com, mass weight
+      int nsuccess = 0;
 
-  vectorZeroize3D(xcm);
+      double x_try[3],dist_j_sqr;
 
-  bool alreadyChecked = false;
-  for(int i = 0; i < ntry; i++)
-  {
-      generate_xtry(x_try);
+      vectorZeroize3D(xcm);
 
-      alreadyChecked = false;
-      for(int j = 0; j < nspheres; j++)
+      bool alreadyChecked = false;
+      for(int i = 0; i < ntry; i++)
       {
-          dist_j_sqr = dist_sqr(j,x_try);
+          generate_xtry(x_try);
 
-          // only count once if contained in multiple spheres
-          if (alreadyChecked) break;
-          if(dist_j_sqr < r_sphere[j]*r_sphere[j])
+          alreadyChecked = false;
+          for(int j = 0; j < nspheres; j++)
           {
-              xcm[0] = (xcm[0]*static_cast<double>(nsuccess)+x_try[0])/static_cast<double>(nsuccess+1);
-              xcm[1] = (xcm[1]*static_cast<double>(nsuccess)+x_try[1])/static_cast<double>(nsuccess+1);
-              xcm[2] = (xcm[2]*static_cast<double>(nsuccess)+x_try[2])/static_cast<double>(nsuccess+1);
-              nsuccess++;
-              alreadyChecked = true;
+              dist_j_sqr = dist_sqr(j,x_try);
+
+              // only count once if contained in multiple spheres
+              if (alreadyChecked) break;
+              if(dist_j_sqr < r_sphere[j]*r_sphere[j])
+              {
+                  xcm[0] = (xcm[0]*static_cast<double>(nsuccess)+x_try[0])/static_cast<double>(nsuccess+1);
+                  xcm[1] = (xcm[1]*static_cast<double>(nsuccess)+x_try[1])/static_cast<double>(nsuccess+1);
+                  xcm[2] = (xcm[2]*static_cast<double>(nsuccess)+x_try[2])/static_cast<double>(nsuccess+1);
+                  nsuccess++;
+                  alreadyChecked = true;
+              }
           }
       }
+
+      volume_expect = static_cast<double>(nsuccess)/static_cast<double>(ntry)*(x_max[0]-x_min[0])*(x_max[1]-x_min[1])*(x_max[2]-x_min[2]);
   }
 
   // expectancy values
-  volume_expect = static_cast<double>(nsuccess)/static_cast<double>(ntry)*(x_max[0]-x_min[0])*(x_max[1]-x_min[1])*(x_max[2]-x_min[2]);
   mass_expect = volume_expect*expectancy(pdf_density);
   r_equiv = pow(6.*mass_expect/(8.*expectancy(pdf_density)*M_PI),1./3.);
 
@@ -503,6 +595,362 @@ void FixTemplateMultiplespheres::calc_center_of_mass()
 
 }
 
+/* ----------------------------------------------------------------------
+   calc volume, center of mass, inertia tensor and volume weights of the
+   union of spheres by an adaptive octree over the bounding box
+
+   cells fully inside or outside of every sphere are integrated exactly,
+   only cells cut by a sphere surface are refined up to octree_level,
+   cells at the finest level are classified by their center
+   the top level cells are distributed over procs and threads
+------------------------------------------------------------------------- */
+
+void FixTemplateMultiplespheres::calc_properties_octree()
+{
+    if(octree_done)
+        return;
+
+    if(!volumeweight_octree)
+        volumeweight_octree = new double[nspheres];
+
+    // try to read from cache
+
+    char *filename = 0;
+    int cached = 0;
+    if(cache_dir)
+    {
+        filename = new char[strlen(cache_dir)+64];
+        sprintf(filename,"%s/multisphere_%08x.cache",cache_dir,geometry_hash());
+        if(comm->me == 0)
+            cached = read_properties_cache(filename) ? 1 : 0;
+        MPI_Bcast(&cached,1,MPI_INT,0,world);
+    }
+
+    if(cached)
+    {
+        MPI_Bcast(&volume_octree,1,MPI_DOUBLE,0,world);
+        MPI_Bcast(xcm_octree,3,MPI_DOUBLE,0,world);
+        MPI_Bcast(&moi_octree[0][0],9,MPI_DOUBLE,0,world);
+        MPI_Bcast(volumeweight_octree,nspheres,MPI_DOUBLE,0,world);
+
+        if(comm->me == 0 && logfile)
+            fprintf(logfile,"Template properties read from cache file %s\n",filename);
+    }
+    else
+    {
+        // sums: volume, 1st moments, 2nd moments xx yy zz xy xz yz, volume per sphere
+
+        const int nsums = 10+nspheres;
+        const int nprocs = comm->nprocs;
+        int nthreads = 1;
+#if defined(_OPENMP)
+        nthreads = comm->nthreads;
+#endif
+
+        // enough top level cells for load balancing
+
+        int level_top = 1;
+        while((1 << (3*level_top)) < 16*nprocs*nthreads && level_top < octree_level)
+            level_top++;
+        const int ndiv = 1 << level_top;
+        const int ncells = ndiv*ndiv*ndiv;
+
+        std::vector<int> mycells;
+        for(int icell = comm->me; icell < ncells; icell += nprocs)
+            mycells.push_back(icell);
+        const int nmycells = mycells.size();
+
+        double cellsize[3];
+        for(int d = 0; d < 3; d++)
+            cellsize[d] = (x_max[d]-x_min[d])/static_cast<double>(ndiv);
+
+        // scratch for candidate sphere lists, one segment per level
+
+        const int nscratch = nspheres*(octree_level+2);
+        double *sums_thread = new double[nthreads*nsums];
+        int *cand_thread = new int[nthreads*nscratch];
+        vectorZeroizeN(sums_thread,nthreads*nsums);
+
+#if defined(_OPENMP)
+        #pragma omp parallel num_threads(nthreads)
+#endif
+        {
+            int ithread = 0;
+#if defined(_OPENMP)
+            ithread = omp_get_thread_num();
+#endif
+            double * const sums = &sums_thread[ithread*nsums];
+            int * const cand = &cand_thread[ithread*nscratch];
+
+#if defined(_OPENMP)
+            #pragma omp for schedule(dynamic)
+#endif
+            for(int ii = 0; ii < nmycells; ii++)
+            {
+                const int icell = mycells[ii];
+                const int idx[3] = { icell % ndiv, (icell/ndiv) % ndiv, icell/(ndiv*ndiv) };
+                double lo[3],hi[3];
+                for(int d = 0; d < 3; d++)
+                {
+                    lo[d] = x_min[d] + idx[d]*cellsize[d];
+                    hi[d] = (idx[d] == ndiv-1) ? x_max[d] : lo[d] + cellsize[d];
+                }
+
+                for(int j = 0; j < nspheres; j++)
+                    cand[j] = j;
+                integrate_octree_cell(lo,hi,level_top,cand,nspheres,sums);
+            }
+        }
+
+        double *sums = new double[nsums];
+        vectorZeroizeN(sums,nsums);
+        for(int it = 0; it < nthreads; it++)
+            for(int k = 0; k < nsums; k++)
+                sums[k] += sums_thread[it*nsums+k];
+        MPI_Sum_Vector(sums,nsums,world);
+
+        if(sums[0] <= 0.)
+            error->fix_error(FLERR,this,"octree integration failed, template volume is zero");
+
+        // volume and center of mass
+
+        volume_octree = sums[0];
+        for(int d = 0; d < 3; d++)
+            xcm_octree[d] = sums[1+d]/volume_octree;
+
+        // 2nd moments wrt center of mass, inertia tensor for unit density
+
+        const double sxx = sums[4] - volume_octree*xcm_octree[0]*xcm_octree[0];
+        const double syy = sums[5] - volume_octree*xcm_octree[1]*xcm_octree[1];
+        const double szz = sums[6] - volume_octree*xcm_octree[2]*xcm_octree[2];
+        const double sxy = sums[7] - volume_octree*xcm_octree[0]*xcm_octree[1];
+        const double sxz = sums[8] - volume_octree*xcm_octree[0]*xcm_octree[2];
+        const double syz = sums[9] - volume_octree*xcm_octree[1]*xcm_octree[2];
+
+        moi_octree[0][0] = syy + szz;
+        moi_octree[1][1] = sxx + szz;
+        moi_octree[2][2] = sxx + syy;
+        moi_octree[0][1] = moi_octree[1][0] = -sxy;
+        moi_octree[0][2] = moi_octree[2][0] = -sxz;
+        moi_octree[1][2] = moi_octree[2][1] = -syz;
+
+        for(int j = 0; j < nspheres; j++)
+            volumeweight_octree[j] = sums[10+j];
+
+        delete []sums;
+        delete []sums_thread;
+        delete []cand_thread;
+
+        if(filename && comm->me == 0)
+            write_properties_cache(filename);
+    }
+
+    if(filename)
+        delete []filename;
+
+    octree_done = true;
+}
+
+/* ----------------------------------------------------------------------
+   integrate cell lo/hi of the octree
+   cand holds the ncand spheres that may intersect the cell,
+   the candidates of the child cells are stored behind it
+------------------------------------------------------------------------- */
+
+void FixTemplateMultiplespheres::integrate_octree_cell(const double *lo, const double *hi, const int level,
+                                                       int *cand, const int ncand, double *sums) const
+{
+    // drop spheres which do not touch the cell
+    // count spheres which contain the cell completely
+
+    int * const cand_child = cand + nspheres;
+    int nchild = 0;
+    bool partial = false;
+
+    for(int k = 0; k < ncand; k++)
+    {
+        const int j = cand[k];
+        double dmin = 0., dmax = 0.;
+        for(int d = 0; d < 3; d++)
+        {
+            const double dlo = x_sphere[j][d] - lo[d];
+            const double dhi = hi[d] - x_sphere[j][d];
+            if(dlo < 0.)
+                dmin += dlo*dlo;
+            else if(dhi < 0.)
+                dmin += dhi*dhi;
+            dmax += std::max(dlo*dlo,dhi*dhi);
+        }
+
+        const double rsq = r_sphere[j]*r_sphere[j];
+        if(dmin >= rsq)
+            continue;
+        if(dmax > rsq)
+            partial = true;
+        cand_child[nchild++] = j;
+    }
+
+    if(0 == nchild)
+        return;
+
+    // refine cells cut by a sphere surface
+
+    if(partial && level < octree_level)
+    {
+        const double mid[3] = { 0.5*(lo[0]+hi[0]), 0.5*(lo[1]+hi[1]), 0.5*(lo[2]+hi[2]) };
+        double clo[3],chi[3];
+        for(int ichild = 0; ichild < 8; ichild++)
+        {
+            for(int d = 0; d < 3; d++)
+            {
+                const bool upper = (ichild >> d) & 1;
+                clo[d] = upper ? mid[d] : lo[d];
+                chi[d] = upper ? hi[d] : mid[d];
+            }
+            integrate_octree_cell(clo,chi,level+1,cand_child,nchild,sums);
+        }
+        return;
+    }
+
+    // cell is inside of all remaining candidates
+    // at finest level the cell center decides
+
+    const double mid[3] = { 0.5*(lo[0]+hi[0]), 0.5*(lo[1]+hi[1]), 0.5*(lo[2]+hi[2]) };
+    int nin = 0;
+    for(int k = 0; k < nchild; k++)
+    {
+        const int j = cand_child[k];
+        if(!partial || pointDistanceSquared(mid,x_sphere[j]) < r_sphere[j]*r_sphere[j])
+            cand_child[nin++] = j;
+    }
+
+    if(0 == nin)
+        return;
+
+    // exact moments of the cell
+
+    const double h[3] = { hi[0]-lo[0], hi[1]-lo[1], hi[2]-lo[2] };
+    const double vol = h[0]*h[1]*h[2];
+
+    sums[0] += vol;
+    sums[1] += vol*mid[0];
+    sums[2] += vol*mid[1];
+    sums[3] += vol*mid[2];
+    sums[4] += vol*(mid[0]*mid[0] + h[0]*h[0]/12.);
+    sums[5] += vol*(mid[1]*mid[1] + h[1]*h[1]/12.);
+    sums[6] += vol*(mid[2]*mid[2] + h[2]*h[2]/12.);
+    sums[7] += vol*mid[0]*mid[1];
+    sums[8] += vol*mid[0]*mid[2];
+    sums[9] += vol*mid[1]*mid[2];
+
+    // volume shared among all spheres containing the cell
+
+    const double vol_each = vol/static_cast<double>(nin);
+    for(int k = 0; k < nin; k++)
+        sums[10+cand_child[k]] += vol_each;
+}
+
+/* ----------------------------------------------------------------------
+   hash of the template geometry, used as name of the cache file
+------------------------------------------------------------------------- */
+
+unsigned int FixTemplateMultiplespheres::geometry_hash() const
+{
+    // FNV-1a over the bytes of positions, radii and octree level
+
+    unsigned int hash = 2166136261u;
+    const int nvalues = 4*nspheres+1;
+    double *values = new double[nvalues];
+    for(int i = 0; i < nspheres; i++)
+    {
+        vectorCopy3D(x_sphere[i],&values[4*i]);
+        values[4*i+3] = r_sphere[i];
+    }
+    values[4*nspheres] = static_cast<double>(octree_level);
+
+    const unsigned char *bytes = reinterpret_cast<const unsigned char*>(values);
+    for(size_t k = 0; k < nvalues*sizeof(double); k++)
+    {
+        hash ^= bytes[k];
+        hash *= 16777619u;
+    }
+
+    delete []values;
+    return hash;
+}
+
+/* ----------------------------------------------------------------------
+   read template properties from cache file
+   only accepted if the geometry stored in the file matches exactly
+------------------------------------------------------------------------- */
+
+bool FixTemplateMultiplespheres::read_properties_cache(const char *filename)
+{
+    FILE *fp = fopen(filename,"r");
+    if(!fp)
+        return false;
+
+    bool match = true;
+    int n = 0, level = 0;
+    double value[4];
+
+    if(2 != fscanf(fp,"multisphere_cache %d %d",&n,&level) || n != nspheres || level != octree_level)
+        match = false;
+
+    for(int i = 0; match && i < nspheres; i++)
+    {
+        if(4 != fscanf(fp,"%lg %lg %lg %lg",&value[0],&value[1],&value[2],&value[3]) ||
+           value[0] != x_sphere[i][0] || value[1] != x_sphere[i][1] ||
+           value[2] != x_sphere[i][2] || value[3] != r_sphere[i])
+            match = false;
+    }
+
+    if(match && 1 != fscanf(fp,"%lg",&volume_octree))
+        match = false;
+    for(int d = 0; match && d < 3; d++)
+        if(1 != fscanf(fp,"%lg",&xcm_octree[d]))
+            match = false;
+    for(int k = 0; match && k < 9; k++)
+        if(1 != fscanf(fp,"%lg",&moi_octree[k/3][k%3]))
+            match = false;
+    for(int j = 0; match && j < nspheres; j++)
+        if(1 != fscanf(fp,"%lg",&volumeweight_octree[j]))
+            match = false;
+
+    fclose(fp);
+
+    if(!match)
+        error->warning(FLERR,"fix particletemplate/multisphere: cache file does not match template, re-calculating");
+
+    return match;
+}
+
+/* ----------------------------------------------------------------------
+   write template properties to cache file
+------------------------------------------------------------------------- */
+
+void FixTemplateMultiplespheres::write_properties_cache(const char *filename) const
+{
+    FILE *fp = fopen(filename,"w");
+    if(!fp)
+    {
+        error->warning(FLERR,"fix particletemplate/multisphere: could not write cache file");
+        return;
+    }
+
+    fprintf(fp,"multisphere_cache %d %d\n",nspheres,octree_level);
+    for(int i = 0; i < nspheres; i++)
+        fprintf(fp,"%.17g %.17g %.17g %.17g\n",x_sphere[i][0],x_sphere[i][1],x_sphere[i][2],r_sphere[i]);
+    fprintf(fp,"%.17g\n",volume_octree);
+    fprintf(fp,"%.17g %.17g %.17g\n",xcm_octree[0],xcm_octree[1],xcm_octree[2]);
+    for(int d = 0; d < 3; d++)
+        fprintf(fp,"%.17g %.17g %.17g\n",moi_octree[d][0],moi_octree[d][1],moi_octree[d][2]);
+    for(int j = 0; j < nspheres; j++)
+        fprintf(fp,"%.17g\n",volumeweight_octree[j]);
+
+    fclose(fp);
+}
+
 /* ----------------------------------------------------------------------*/
 
 double FixTemplateMultiplespheres::max_r_bound()
@@ -136,6 +136,19 @@ class FixTemplateMultiplespheres : public FixTemplateSphere {
   // generate random point in bbox
   void generate_xtry(double *xtry);
 
+  // volume integration of the sphere union, ntry checks
+  bool parse_integration_keyword(int &iarg, int narg, char **arg);
+  void init_integration();
+
+  // volume, com, inertia and volume weights by an adaptive octree,
+  // computed once and optionally cached on disk
+  void calc_properties_octree();
+  void integrate_octree_cell(const double *lo, const double *hi, const int level,
+                             int *cand, const int ncand, double *sums) const;
+  unsigned int geometry_hash() const;
+  bool read_properties_cache(const char *filename);
+  void write_properties_cache(const char *filename) const;
+
   // number of spheres in template
   int nspheres;
 
@@ -164,6 +177,24 @@ class FixTemplateMultiplespheres : public FixTemplateSphere {
   // number of tries for mc
   int ntry;
 
+  // volume integration method, mc or octree
+  enum { INTEGRATION_MC, INTEGRATION_OCTREE };
+  int integration_method;
+
+  // max refinement level of the octree
+  int octree_level;
+
+  // directory for cached template properties, NULL if not used
+  char *cache_dir;
+
+  // octree results, wrt coords of x_sphere at time of integration
+  // moi_octree is the inertia tensor wrt com for unit density
+  bool octree_done;
+  double volume_octree;
+  double xcm_octree[3];
+  double moi_octree[3][3];
+  double *volumeweight_octree;
+
   bool overlap_slightly;
 
   bool no_overlap;
@@ -205,6 +205,8 @@ FixTemplateMultisphere::FixTemplateMultisphere(LAMMPS *lmp, int narg, char **arg
             moi_[2][1] = moi_[1][2];
             moi_set_ = true;
             hasargs = true;
+        } else if(parse_integration_keyword(iarg,narg,arg)) {
+            hasargs = true;
         } else if(strcmp(style,"particletemplate/multisphere") == 0)
             error->fix_error(FLERR,this,"unknown keyword");
     }
@@ -260,6 +262,7 @@ void FixTemplateMultisphere::post_create()
   // use density specified in input script  and mass specified in input script ; volume calculated
   else
   {
+      init_integration();
       calc_bounding_sphere();
 
       check_overlap();
@@ -325,6 +328,16 @@ void FixTemplateMultisphere::init()
 
 void FixTemplateMultisphere::calc_volumeweight()
 {
+    // volume of each sphere shared by overlapping spheres is known from octree
+
+    if(INTEGRATION_OCTREE == integration_method)
+    {
+        calc_properties_octree();
+        for(int j = 0; j < nspheres; j++)
+            volumeweight_[j] = volumeweight_octree[j]/volume_octree;
+        return;
+    }
+
     double x_try[3],distSqr,n_hits;
 
     bool *hits_j = new bool[nspheres];
@@ -376,6 +389,17 @@ void FixTemplateMultisphere::calc_volumeweight()
 
 void FixTemplateMultisphere::calc_inertia()
 {
+  // octree inertia is wrt com already and exactly symmetric
+
+  if(INTEGRATION_OCTREE == integration_method)
+  {
+      calc_properties_octree();
+      for(int i = 0; i < 3; i++)
+          for(int j = 0; j < 3; j++)
+              moi_[i][j] = expectancy(pdf_density)*moi_octree[i][j];
+      return;
+  }
+
   double x_try[3],xcm[3],distSqr;
   bool alreadyChecked;
 
@@ -425,7 +449,7 @@ void FixTemplateMultisphere::calc_inertia()
   moi_[1][0] = moi_[0][1];
   moi_[0][2] = (moi_[0][2]+moi_[2][0])/2.;
   moi_[2][0] = moi_[0][2];
-  moi_[2][1] = (moi_[2][1]+moi_[2][0])/2.;
+  moi_[2][1] = (moi_[2][1]+moi_[1][2])/2.;
   moi_[1][2] = moi_[2][1];
 }
 
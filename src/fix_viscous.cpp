@@ -81,6 +81,8 @@ FixViscous::FixViscous(LAMMPS *lmp, int narg, char **arg) :
       iarg += 3;
     } else error->all(FLERR,"Illegal fix viscous command");
   }
+
+  skip_step_ = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -141,6 +143,9 @@ void FixViscous::post_force(int vflag)
   // direction is opposed to velocity vector
   // magnitude depends on atom type
 
+  // drag is applied by fused integrator
+  if (skip_step_ == update->ntimestep && !update->setupflag) return;
+
   double **v = atom->v;
   double **f = atom->f;
   int *mask = atom->mask;
@@ -68,9 +68,17 @@ class FixViscous : public Fix {
   void post_force_respa(int, int, int);
   void min_post_force(int);
 
+  // fused integration via fix nve/sphere
+  bool fusable() { return true; }
+  void skip_post_force(bigint step) { skip_step_ = step; }
+  inline const double* get_gamma() { return gamma; }
+
  protected:
   double *gamma;
   int nlevels_respa;
+
+  // step for which particle loop is done by fused integrator
+  bigint skip_step_;
 };
 
 }
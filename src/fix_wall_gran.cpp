@@ -75,6 +75,7 @@
 #include "contact_interface.h"
 #include "fix_property_global.h"
 #include "domain_wedge.h"
+#include "fix_subcycle_gran.h"
 #include <vector>
 
 #ifdef SUPERQUADRIC_ACTIVE_FLAG
@@ -131,6 +132,7 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
     fix_wallforce_contact_stress_ = 0;
     fix_store_multicontact_data_ = NULL;
     fix_rigid_ = NULL;
+    fix_subcycle_ = NULL;
     heattransfer_flag_ = false;
 
     FixMesh_list_ = NULL;
@@ -142,6 +144,11 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
     addflag_ = 0;
     cwl_ = NULL;
 
+    omp_mesh_ = false;
+    nthreads_ = 1;
+    nmax_mesh_atoms_ = nmax_mesh_contacts_ = n_mesh_atoms_ = 0;
+    mesh_contact_start_ = mesh_contact_tri_ = mesh_contact_atoms_ = NULL;
+
     computeflag_ = 1;
 
     meshwall_ = -1;
@@ -376,9 +383,9 @@ FixWallGran::FixWallGran(LAMMPS *lmp, int narg, char **arg) :
         store_force_contact_stress_ = true;
 
     if (!allow_special_domain_periodic                               &&
-        (domain->triclinic || dynamic_cast<DomainWedge*>(domain))     &&
+        domain->triclinic                                             &&
         (domain->xperiodic || domain->yperiodic || domain->zperiodic) )
-        error->fix_error(FLERR, this, "Triclinic or wedge domain is not allowed with periodic boundary conditions and meshes. This can be overridden by using the allow_special_domain_periodic option of fix wall/gran. In this case the user must ensure that meshes are sufficiently far away from periodic boundaries");
+        error->fix_error(FLERR, this, "Triclinic domain is not allowed with periodic boundary conditions and meshes. This can be overridden by using the allow_special_domain_periodic option of fix wall/gran. In this case the user must ensure that meshes are sufficiently far away from periodic boundaries");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -389,6 +396,7 @@ void FixWallGran::post_create()
     {
       // case non-granular (sph)
       dnum_ = 0;
+      history_ids_.clear();
     }
 
     // register storage for wall force if required
@@ -486,6 +494,8 @@ void FixWallGran::post_create()
        
        FixMesh_list_[i]->createWallNeighList(igroup);
        FixMesh_list_[i]->createContactHistory(dnum());
+       if(FixMesh_list_[i]->contactHistory())
+         FixMesh_list_[i]->contactHistory()->set_history_ids(history_ids_);
 
        if(store_force_contact_)
          FixMesh_list_[i]->createMeshforceContact();
@@ -517,6 +527,7 @@ void FixWallGran::post_create()
           modify->add_fix(8+dnum_,const_cast<char**>(fixarg));
           fix_history_primitive_ =
               static_cast<FixPropertyAtom*>(modify->find_fix_property(hist_name,"property/atom","vector",dnum_,0,style));
+          FixContactHistory::find_history_vectors(history_ids_,history_vec_,history_pos_);
           delete []fixarg;
           delete []hist_name;
    }
@@ -565,6 +576,10 @@ FixWallGran::~FixWallGran()
     if(primitiveWall_ != 0) delete primitiveWall_;
     if(FixMesh_list_) delete []FixMesh_list_;
     delete impl;
+
+    memory->destroy(mesh_contact_start_);
+    memory->destroy(mesh_contact_tri_);
+    memory->destroy(mesh_contact_atoms_);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -610,6 +625,9 @@ void FixWallGran::init()
         // check if a fix rigid is registered - important for damp
         fix_rigid_ = static_cast<FixRigid*>(modify->find_fix_style_strict("rigid",0));
 
+        // check if contacts are sub-cycled
+        fix_subcycle_ = static_cast<FixSubcycleGran*>(modify->find_fix_style("subcycle/gran",0));
+
         if (strcmp(update->integrate_style,"respa") == 0)
           nlevels_respa_ = ((Respa *) update->integrate)->nlevels;
 
@@ -641,6 +659,22 @@ void FixWallGran::init()
         (
             modify->find_fix_property("sum_normal_force_","property/atom","scalar",0,0,style, false)
         );
+
+    // threaded mesh contacts are only used for models that do not
+    // accumulate into shared data other than the mesh modules
+    // per-contact output and energy tracking are not buffered per thread
+
+    nthreads_ = comm->nthreads;
+    const bool omp_requested = is_mesh_wall() && nthreads_ > 1 && impl;
+    omp_mesh_ = omp_requested &&
+                !atom->shapetype_flag && !atom->superquadric_flag &&
+                !modify->find_fix_style("calculate/wall_dissipated_energy",0) &&
+                !store_force_contact_ && !store_force_contact_stress_ &&
+                !track_energy_ && !store_sum_normal_force();
+    if(omp_requested && !omp_mesh_ && 0 == comm->me)
+        error->warning(FLERR,"Fix wall/gran: mesh contacts are evaluated serially with the selected options");
+    if(omp_mesh_)
+        mesh_contributions_.resize(nthreads_);
 }
 
 void FixWallGran::createMulticontactData()
@@ -812,22 +846,25 @@ void FixWallGran::post_force_wall(int vflag)
   else
     post_force_primitive(vflag);
 
+  // ghost contact data is only used for output, comm is done
+  // at the next sync point of the integrator
+
   if(meshwall_ == 0 && store_force_contact_)
-    fix_wallforce_contact_->do_forward_comm();
+    fix_wallforce_contact_->queue_forward_comm();
 
   if(meshwall_ == 0 && store_force_contact_stress_)
-    fix_wallforce_contact_stress_->do_forward_comm();
+    fix_wallforce_contact_stress_->queue_forward_comm();
 
   if(meshwall_ == 1 && store_force_contact_)
   {
     for(int imesh = 0; imesh < n_FixMesh_; imesh++)
-        FixMesh_list_[imesh]->meshforceContact()->do_forward_comm();
+        FixMesh_list_[imesh]->meshforceContact()->queue_forward_comm();
   }
 
   if(meshwall_ == 1 && store_force_contact_stress_)
   {
     for(int imesh = 0; imesh < n_FixMesh_; imesh++)
-        FixMesh_list_[imesh]->meshforceContactStress()->do_forward_comm();
+        FixMesh_list_[imesh]->meshforceContactStress()->queue_forward_comm();
   }
 }
 
@@ -845,15 +882,11 @@ void FixWallGran::post_force_respa(int vflag, int ilevel, int iloop)
 void FixWallGran::post_force_mesh(int vflag)
 {
     
-    // contact properties
-    double v_wall[3],bary[3];
-    double delta[3],deltan;
     MultiVectorContainer<double,3,3> *vMeshC;
-    double *radius = atom->radius;
-    double ***vMesh = 0;
+    double ***vMesh;
     int nlocal = atom->nlocal;
     int nTriAll, barysign = -1;
-    const double contactDistanceMultiplier = neighbor->contactDistanceFactor - 1.0;
+    const bool omp_mesh = use_omp_mesh();
 
     SurfacesIntersectData sidata;
     sidata.is_wall = true;
@@ -868,6 +901,15 @@ void FixWallGran::post_force_mesh(int vflag)
       
       if(fix_contact) fix_contact->markAllContacts();
 
+      // particles handled in another pass of the sub-cycling keep their contacts
+
+      if(fix_contact && fix_subcycle_ && fix_subcycle_->active())
+      {
+        for(int i = 0; i < nlocal; i++)
+          if(fix_subcycle_->skip_particle(atom->mask[i]))
+            fix_contact->keepContacts(i);
+      }
+
       if(store_force_contact_)
         fix_wallforce_contact_ = FixMesh_list_[iMesh]->meshforceContact();
 
@@ -880,141 +922,309 @@ void FixWallGran::post_force_mesh(int vflag)
       FixNeighlistMesh * meshNeighlist = FixMesh_list_[iMesh]->meshNeighlist();
 
       // moving mesh
-      vectorZeroize3D(v_wall);
       vMeshC = mesh->prop().getElementProperty<MultiVectorContainer<double,3,3> >("v");
-      if(vMeshC)
-        vMesh = vMeshC->begin();
+      vMesh = vMeshC ? vMeshC->begin() : NULL;
 
       atom_type_wall_ = FixMesh_list_[iMesh]->atomTypeWall();
 
-      // loop owned and ghost triangles
-      for(int iTri = 0; iTri < nTriAll; iTri++)
+      if(omp_mesh)
+      {
+          build_mesh_contact_lists(meshNeighlist,nTriAll);
+          post_force_mesh_omp(iMesh,mesh,fix_contact,vMesh);
+      }
+      else
       {
-          const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
-          const int numneigh = neighborList.size();
-          for(int iCont = 0; iCont < numneigh; iCont++)
+          // loop owned and ghost triangles
+          for(int iTri = 0; iTri < nTriAll; iTri++)
           {
-            
-            const int iPart = neighborList[iCont];
+              const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
+              const int numneigh = neighborList.size();
+              for(int iCont = 0; iCont < numneigh; iCont++)
+              {
+                const int iPart = neighborList[iCont];
 
-            // do not handle ghost particles
-            if (iPart >= nlocal) continue;
-
-            int idTri = mesh->id(iTri);
-
-            #ifdef SUPERQUADRIC_ACTIVE_FLAG
-                if(atom->superquadric_flag) {
-                  #ifdef LIGGGHTS_DEBUG
-                    if(std::isnan(vectorMag3D(x_[iPart])))
-                      error->fix_error(FLERR,this,"x_[iPart] is NaN!");
-                    if(std::isnan(vectorMag4D(quat_[iPart])))
-                      error->fix_error(FLERR,this,"quat_[iPart] is NaN!");
-                  #endif
-
-                  Superquadric particle(x_[iPart], quat_[iPart], shape_[iPart], blockiness_[iPart]);
-
-                  if(mesh->sphereTriangleIntersection(iTri, radius_[iPart], x_[iPart])) //check for Bounding Sphere-triangle intersection
-                  {
-                    deltan = mesh->resolveTriSuperquadricContact(iTri, delta, sidata.contact_point, particle, bary);
-                    #ifdef LIGGGHTS_DEBUG
-                        if(std::isnan(deltan))
-                          error->fix_error(FLERR,this,"deltan is NaN!");
-                        if(std::isnan(vectorMag3D(delta)))
-                          error->fix_error(FLERR,this,"delta is NaN!");
-                        if(std::isnan(vectorMag3D(sidata.contact_point)))
-                          error->fix_error(FLERR,this,"sidata.contact_point is NaN!");
-                    #endif
-                  }
-                  else
-                    deltan = LARGE_TRIMESH;
-                  sidata.is_non_spherical = true; //by default it is false
-                } else {
-                  sidata.radi = radius_ ? radius_[iPart] : r0_;
-                  if (fix_store_multicontact_data_)
-                  {
-                      double * deltaData = NULL;
-                      const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
-                      if (contact)
-                          sidata.radi += deltaData[3];
-                  }
-                  deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
-                }
-            #else
-                sidata.radi = radius_ ? radius_[iPart] : r0_;
-                if (fix_store_multicontact_data_)
-                {
-                    double * deltaData = NULL;
-                    const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
-                    if (contact)
-                        sidata.radi += deltaData[3];
-                }
-                
-                deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
-            #endif
-            
-            if(deltan > cutneighmax_) continue;
+                // do not handle ghost particles
+                if (iPart >= nlocal) continue;
 
-            sidata.i = iPart;
+                handle_mesh_contact(iMesh,mesh,fix_contact,vMesh,iTri,iPart,sidata,barysign);
+              }
+          }
+      }
 
-            bool intersectflag = (deltan <= 0);
+      // clean-up contacts
+      
+      if(fix_contact) fix_contact->cleanUpContacts();
+    }
+}
 
-            sidata.mesh = mesh;
+/* ----------------------------------------------------------------------
+   contact of owned particle iPart with triangle iTri of mesh iMesh
+   only touches per-particle data, mesh module contributions are
+   deferred if called from within a parallel region
+------------------------------------------------------------------------- */
 
-            if(atom->shapetype_flag)
-            {
-                
-                sidata.j = iTri;
-                fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,false);
-                if(vMeshC)
-                {
-                    for(int i = 0; i < 3; i++)
-                        v_wall[i] = (bary[0]*vMesh[iTri][0][i] +
-                                     bary[1]*vMesh[iTri][1][i] +
-                                     bary[2]*vMesh[iTri][2][i] );
-                }
-                sidata.v_i = atom->v[iPart];
-                sidata.omega_i = atom->omega[iPart];
-                sidata.v_j = v_wall;
-                sidata.shearupdate = shearupdate_;
-                sidata.computeflag = computeflag_;
-                intersectflag = impl->checkSurfaceIntersect(sidata);
-                deltan = -sidata.deltan;
-                
-            }
+void FixWallGran::handle_mesh_contact(int iMesh, TriMesh *mesh, FixContactHistoryMesh *fix_contact,
+                                      double ***vMesh, int iTri, int iPart, SurfacesIntersectData &sidata, int &barysign)
+{
+    double v_wall[3],bary[3];
+    double delta[3],deltan;
+    double *radius = atom->radius;
+    const double contactDistanceMultiplier = neighbor->contactDistanceFactor - 1.0;
 
-            sidata.fix_mesh = FixMesh_list_[iMesh];
+    vectorZeroize3D(v_wall);
 
-            if(deltan <= 0 || (radius && deltan < contactDistanceMultiplier*radius[iPart]))
-            {
-              
-              if(!atom->shapetype_flag && fix_contact && ! fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,7 == barysign)) continue;
+    if (fix_subcycle_ && fix_subcycle_->skip_particle(atom->mask[iPart])) return;
 
-              if(vMeshC && !atom->shapetype_flag)
-              {
-                for(int i = 0; i < 3; i++)
-                    v_wall[i] = (bary[0]*vMesh[iTri][0][i] + bary[1]*vMesh[iTri][1][i] + bary[2]*vMesh[iTri][2][i]);
-              }
+    int idTri = mesh->id(iTri);
 
-              if(!sidata.is_non_spherical || atom->superquadric_flag)
-                sidata.deltan   = -deltan;
-              sidata.delta[0] = -delta[0];
-              sidata.delta[1] = -delta[1];
-              sidata.delta[2] = -delta[2];
-              if(impl)
-                impl->compute_force(this, sidata, intersectflag,v_wall,FixMesh_list_[iMesh],iMesh,mesh,iTri);
-              else
-              {
-                sidata.r =  r0_ - sidata.deltan;
-                compute_force(sidata, v_wall); // LEGACY CODE (SPH)
-              }
-            }
+    #ifdef SUPERQUADRIC_ACTIVE_FLAG
+        if(atom->superquadric_flag) {
+          #ifdef LIGGGHTS_DEBUG
+            if(std::isnan(vectorMag3D(x_[iPart])))
+              error->fix_error(FLERR,this,"x_[iPart] is NaN!");
+            if(std::isnan(vectorMag4D(quat_[iPart])))
+              error->fix_error(FLERR,this,"quat_[iPart] is NaN!");
+          #endif
+
+          Superquadric particle(x_[iPart], quat_[iPart], shape_[iPart], blockiness_[iPart]);
+
+          if(mesh->sphereTriangleIntersection(iTri, radius_[iPart], x_[iPart])) //check for Bounding Sphere-triangle intersection
+          {
+            deltan = mesh->resolveTriSuperquadricContact(iTri, delta, sidata.contact_point, particle, bary);
+            #ifdef LIGGGHTS_DEBUG
+                if(std::isnan(deltan))
+                  error->fix_error(FLERR,this,"deltan is NaN!");
+                if(std::isnan(vectorMag3D(delta)))
+                  error->fix_error(FLERR,this,"delta is NaN!");
+                if(std::isnan(vectorMag3D(sidata.contact_point)))
+                  error->fix_error(FLERR,this,"sidata.contact_point is NaN!");
+            #endif
           }
-      }
+          else
+            deltan = LARGE_TRIMESH;
+          sidata.is_non_spherical = true; //by default it is false
+        } else {
+          sidata.radi = radius_ ? radius_[iPart] : r0_;
+          if (fix_store_multicontact_data_)
+          {
+              double * deltaData = NULL;
+              const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
+              if (contact)
+                  sidata.radi += deltaData[3];
+          }
+          deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
+        }
+    #else
+        sidata.radi = radius_ ? radius_[iPart] : r0_;
+        if (fix_store_multicontact_data_)
+        {
+            double * deltaData = NULL;
+            const bool contact = fix_store_multicontact_data_->haveContact(iPart, idTri, deltaData);
+            if (contact)
+                sidata.radi += deltaData[3];
+        }
+        
+        deltan = mesh->resolveTriSphereContactBary(iPart, iTri, sidata.radi, x_[iPart], delta, bary, barysign, atom->shapetype_flag ? false : true);
+    #endif
+    
+    if(deltan > cutneighmax_) return;
 
-      // clean-up contacts
+    sidata.i = iPart;
+
+    bool intersectflag = (deltan <= 0);
+
+    sidata.mesh = mesh;
+
+    if(atom->shapetype_flag)
+    {
+        
+        sidata.j = iTri;
+        fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,false);
+        if(vMesh)
+        {
+            for(int i = 0; i < 3; i++)
+                v_wall[i] = (bary[0]*vMesh[iTri][0][i] +
+                             bary[1]*vMesh[iTri][1][i] +
+                             bary[2]*vMesh[iTri][2][i] );
+        }
+        sidata.v_i = atom->v[iPart];
+        sidata.omega_i = atom->omega[iPart];
+        sidata.v_j = v_wall;
+        sidata.shearupdate = shearupdate_;
+        sidata.computeflag = computeflag_;
+        intersectflag = impl->checkSurfaceIntersect(sidata);
+        deltan = -sidata.deltan;
+        
+    }
+
+    sidata.fix_mesh = FixMesh_list_[iMesh];
+
+    if(deltan <= 0 || (radius && deltan < contactDistanceMultiplier*radius[iPart]))
+    {
       
-      if(fix_contact) fix_contact->cleanUpContacts();
+      if(!atom->shapetype_flag && fix_contact && ! fix_contact->handleContact(iPart,idTri,sidata.contact_history,intersectflag,7 == barysign)) return;
+
+      if(vMesh && !atom->shapetype_flag)
+      {
+        for(int i = 0; i < 3; i++)
+            v_wall[i] = (bary[0]*vMesh[iTri][0][i] + bary[1]*vMesh[iTri][1][i] + bary[2]*vMesh[iTri][2][i]);
+      }
+
+      if(!sidata.is_non_spherical || atom->superquadric_flag)
+        sidata.deltan   = -deltan;
+      sidata.delta[0] = -delta[0];
+      sidata.delta[1] = -delta[1];
+      sidata.delta[2] = -delta[2];
+      if(impl)
+        impl->compute_force(this, sidata, intersectflag,v_wall,FixMesh_list_[iMesh],iMesh,mesh,iTri);
+      else
+      {
+        sidata.r =  r0_ - sidata.deltan;
+        compute_force(sidata, v_wall); // LEGACY CODE (SPH)
+      }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   threaded path can be used if models are thread-safe and no shared
+   per-contact output is collected (see init), and no compute or
+   multicontact surface model reads the contacts in this step
+------------------------------------------------------------------------- */
+
+bool FixWallGran::use_omp_mesh() const
+{
+    if(!omp_mesh_ || cwl_ || heattransfer_flag_)
+        return false;
+
+    for(int iMesh = 0; iMesh < n_FixMesh_; iMesh++)
+        if(FixMesh_list_[iMesh]->meshMulticontactData())
+            return false;
+
+    return true;
+}
+
+/* ----------------------------------------------------------------------
+   invert the triangle-based mesh neighbor lists into a particle-based
+   CSR list, triangles of a particle are kept in ascending order so
+   each particle sees its contacts in the same order as the serial loop
+------------------------------------------------------------------------- */
+
+void FixWallGran::build_mesh_contact_lists(FixNeighlistMesh *meshNeighlist, int nTriAll)
+{
+    const int nlocal = atom->nlocal;
+
+    if(nlocal+1 > nmax_mesh_atoms_)
+    {
+        nmax_mesh_atoms_ = nlocal+1;
+        memory->destroy(mesh_contact_start_);
+        memory->destroy(mesh_contact_atoms_);
+        memory->create(mesh_contact_start_,nmax_mesh_atoms_,"wall/gran:mesh_contact_start_");
+        memory->create(mesh_contact_atoms_,nmax_mesh_atoms_,"wall/gran:mesh_contact_atoms_");
+    }
+
+    // count contacts per owned particle
+
+    for(int i = 0; i <= nlocal; i++)
+        mesh_contact_start_[i] = 0;
+
+    for(int iTri = 0; iTri < nTriAll; iTri++)
+    {
+        const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
+        const int numneigh = neighborList.size();
+        for(int iCont = 0; iCont < numneigh; iCont++)
+        {
+            const int iPart = neighborList[iCont];
+            if(iPart < nlocal)
+                mesh_contact_start_[iPart+1]++;
+        }
+    }
+
+    // prefix sum, remember particles that have contacts
+
+    n_mesh_atoms_ = 0;
+    for(int i = 0; i < nlocal; i++)
+    {
+        if(mesh_contact_start_[i+1] > 0)
+            mesh_contact_atoms_[n_mesh_atoms_++] = i;
+        mesh_contact_start_[i+1] += mesh_contact_start_[i];
+    }
+
+    const int ncontacts = mesh_contact_start_[nlocal];
+    if(ncontacts > nmax_mesh_contacts_)
+    {
+        nmax_mesh_contacts_ = ncontacts;
+        memory->destroy(mesh_contact_tri_);
+        memory->create(mesh_contact_tri_,nmax_mesh_contacts_,"wall/gran:mesh_contact_tri_");
+    }
+
+    // fill, using the start array as insertion pointer and shifting it back afterwards
+
+    for(int iTri = 0; iTri < nTriAll; iTri++)
+    {
+        const std::vector<int> & neighborList = meshNeighlist->get_contact_list(iTri);
+        const int numneigh = neighborList.size();
+        for(int iCont = 0; iCont < numneigh; iCont++)
+        {
+            const int iPart = neighborList[iCont];
+            if(iPart < nlocal)
+                mesh_contact_tri_[mesh_contact_start_[iPart]++] = iTri;
+        }
+    }
+
+    for(int i = nlocal; i > 0; i--)
+        mesh_contact_start_[i] = mesh_contact_start_[i-1];
+    mesh_contact_start_[0] = 0;
+}
+
+/* ----------------------------------------------------------------------
+   particle-parallel evaluation of mesh contacts
+   force, torque and contact history are per particle and thus private
+   to the thread handling the particle, mesh module contributions
+   (stress, wear) are buffered per thread and added afterwards
+------------------------------------------------------------------------- */
+
+void FixWallGran::post_force_mesh_omp(int iMesh, TriMesh *mesh, FixContactHistoryMesh *fix_contact, double ***vMesh)
+{
+#if defined(_OPENMP)
+    const int n_mesh_atoms = n_mesh_atoms_;
+    const int * const start = mesh_contact_start_;
+    const int * const tri = mesh_contact_tri_;
+    const int * const atoms = mesh_contact_atoms_;
+
+    #pragma omp parallel num_threads(nthreads_)
+    {
+        SurfacesIntersectData sidata;
+        sidata.is_wall = true;
+        int barysign = -1;
+
+        mesh_contributions_[omp_get_thread_num()].clear();
+
+        // static schedule keeps the order of the buffered
+        // contributions reproducible
+
+        #pragma omp for schedule(static)
+        for(int ii = 0; ii < n_mesh_atoms; ii++)
+        {
+            const int iPart = atoms[ii];
+            for(int k = start[iPart]; k < start[iPart+1]; k++)
+                handle_mesh_contact(iMesh,mesh,fix_contact,vMesh,tri[k],iPart,sidata,barysign);
+        }
+    }
+
+    FixMeshSurface *fix_mesh = FixMesh_list_[iMesh];
+    for(int it = 0; it < nthreads_; it++)
+    {
+        std::vector<MeshContribution> &contrib = mesh_contributions_[it];
+        const int ncontrib = contrib.size();
+        for(int ic = 0; ic < ncontrib; ic++)
+        {
+            MeshContribution &mc = contrib[ic];
+            fix_mesh->add_particle_contribution(mc.ip,mc.frc,mc.delta,mc.iTri,mc.v_wall);
+        }
     }
+#else
+    (void) iMesh; (void) mesh; (void) fix_contact; (void) vMesh;
+#endif
 }
 
 /* ----------------------------------------------------------------------
@@ -1051,6 +1261,8 @@ void FixWallGran::post_force_primitive(int vflag)
 
     if(!(mask[iPart] & groupbit)) continue;
 
+    if(fix_subcycle_ && fix_subcycle_->skip_particle(mask[iPart])) continue;
+
     sidata.radi = radius_ ? radius_[iPart] : r0_;
     if (fix_store_multicontact_data_)
     {
@@ -1392,3 +1604,16 @@ void FixWallGran::addHeatFlux(TriMesh *mesh,int ip, const double ri, double delt
         cwl_->add_heat_wall(ip,(Temp_wall-Temp_p[ip]) * hc);
     
 }
+
+/* ----------------------------------------------------------------------
+   rotate primitive wall history of owned particle i, called by
+   domain wedge when the particle is mapped across a periodic face
+------------------------------------------------------------------------- */
+
+void FixWallGran::rotate_history(int i, const DomainWedge *dw, int sign)
+{
+    if(!fix_history_primitive_ || (history_vec_.empty() && history_pos_.empty()))
+        return;
+
+    FixContactHistory::rotate_history_values(fix_history_primitive_->array_atom[i],history_vec_,history_pos_,dw,sign);
+}
@@ -58,6 +58,10 @@ FixStyle(wall/gran,FixWallGran)
 #include "fix_contact_property_atom_wall.h"
 #include "compute_pair_gran_local.h"
 
+#if defined(_OPENMP)
+#include "omp.h"
+#endif
+
 namespace LCM = LIGGGHTS::ContactModels;
 
 namespace LAMMPS_NS {
@@ -101,7 +105,7 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   { return iarg_; }
 
   int add_history_value(std::string name, std::string newtonflag)
-  {  return dnum_++; }
+  {  history_ids_.push_back(name); return dnum_++; }
 
   int get_history_offset(const std::string hname)
   {  return impl->get_history_offset(hname);}
@@ -145,6 +149,12 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   inline bool store_force_contact_stress() const
   { return store_force_contact_stress_; }
 
+  // true if contacts can be evaluated several times per time-step,
+  // i.e. no forces, stresses, wear or energies are accumulated
+  inline bool subcyclable() const
+  { return !stress_flag_ && !store_force_ && !store_force_contact_ &&
+           !store_force_contact_stress_ && !track_energy_ && !heattransfer_flag_ && !cwl_; }
+
   inline ComputePairGranLocal * compute_wall_gran_local() const
   { return cwl_; }
 
@@ -190,6 +200,26 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
     }
   }
 
+  // mesh stress/wear contributions are deferred while contacts are
+  // evaluated by several threads and added after the threaded loop
+  inline void add_particle_contribution(class FixMeshSurface *fix_mesh,int ip,double *frc,double *delta,int iTri,double *v_wall)
+  {
+#if defined(_OPENMP)
+    if(omp_in_parallel())
+    {
+      MeshContribution mc;
+      mc.ip = ip;
+      mc.iTri = iTri;
+      vectorCopy3D(frc,mc.frc);
+      vectorCopy3D(delta,mc.delta);
+      vectorCopy3D(v_wall,mc.v_wall);
+      mesh_contributions_[omp_get_thread_num()].push_back(mc);
+      return;
+    }
+#endif
+    fix_mesh->add_particle_contribution(ip,frc,delta,iTri,v_wall);
+  }
+
   bool store_sum_normal_force() const
   { return fix_sum_normal_force_ != NULL; }
 
@@ -210,6 +240,9 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   void wall_temperature_unique(bool &has_temp,bool &temp_unique, double &temperature_unique);
   void addHeatFlux(class TriMesh *mesh,int i,const double ri,double rsq,double area_ratio);
 
+  // rotate primitive wall history of particle i across periodic wedge faces
+  void rotate_history(int i, const class DomainWedge *dw, int sign);
+
  protected:
 
   int iarg_, narg_;
@@ -246,6 +279,28 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   virtual void post_force_mesh(int);
   virtual void post_force_primitive(int);
 
+  // evaluates the contact of owned particle iPart with triangle iTri
+  void handle_mesh_contact(int iMesh,class TriMesh *mesh,class FixContactHistoryMesh *fix_contact,
+                           double ***vMesh,int iTri,int iPart,LCM::SurfacesIntersectData &sidata,int &barysign);
+
+  // threaded mesh contact path: contact lists are inverted so that
+  // each thread handles all contacts of a set of particles
+  bool use_omp_mesh() const;
+  void build_mesh_contact_lists(class FixNeighlistMesh *meshNeighlist,int nTriAll);
+  void post_force_mesh_omp(int iMesh,class TriMesh *mesh,class FixContactHistoryMesh *fix_contact,double ***vMesh);
+
+  struct MeshContribution
+  {
+    int ip, iTri;
+    double frc[3], delta[3], v_wall[3];
+  };
+
+  bool omp_mesh_;
+  int nthreads_;
+  int nmax_mesh_atoms_, nmax_mesh_contacts_, n_mesh_atoms_;
+  int *mesh_contact_start_, *mesh_contact_tri_, *mesh_contact_atoms_;
+  std::vector<std::vector<MeshContribution> > mesh_contributions_;
+
   // virtual functions that allow implementation of the
   // actual physics in the derived classes
   virtual void compute_force(LCM::SurfacesIntersectData & sidata, double *vwall);
@@ -260,6 +315,7 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   int n_FixMesh_;
   class FixMeshSurface **FixMesh_list_;
   class FixRigid *fix_rigid_;
+  class FixSubcycleGran *fix_subcycle_;
   int *body_;
   double *masstotal_;
 
@@ -315,6 +371,10 @@ class FixWallGran : public Fix, public LIGGGHTS::IContactHistorySetup {
   class PrimitiveWall *primitiveWall_;
   class FixPropertyAtom *fix_history_primitive_;
 
+  // history value names and offsets of vector-valued entries
+  std::vector<std::string> history_ids_;
+  std::vector<int> history_vec_, history_pos_;
+
   // class to keep track of wall contacts
   bool rebuildPrimitiveNeighlist_;
 
@@ -355,7 +355,7 @@ public:
             delta[0] = -sidata.delta[0];
             delta[1] = -sidata.delta[1];
             delta[2] = -sidata.delta[2];
-            fix_mesh->add_particle_contribution (ip,f_pw,delta,iTri,vwall);
+            wg->add_particle_contribution(fix_mesh,ip,f_pw,delta,iTri,vwall);
         }
     }
   }
@@ -57,6 +57,8 @@
 #include "respa.h"
 #include "error.h"
 #include "force.h"
+#include "neighbor.h"
+#include "memory.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -100,6 +102,10 @@ FixWallRegion::FixWallRegion(LAMMPS *lmp, int narg, char **arg) :
 
   eflag = 0;
   ewall[0] = ewall[1] = ewall[2] = ewall[3] = 0.0;
+
+  ncandidates = maxcandidates = 0;
+  candidates = NULL;
+  candidates_ncalls = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -107,6 +113,7 @@ FixWallRegion::FixWallRegion(LAMMPS *lmp, int narg, char **arg) :
 FixWallRegion::~FixWallRegion()
 {
   delete [] idregion;
+  memory->destroy(candidates);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -185,6 +192,9 @@ void FixWallRegion::init()
 
   if (strstr(update->integrate_style,"respa"))
     nlevels_respa = ((Respa *) update->integrate)->nlevels;
+
+  // force rebuild of candidate list
+  candidates_ncalls = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -226,11 +236,22 @@ void FixWallRegion::post_force(int vflag)
   Region *region = domain->regions[iregion];
   int onflag = 0;
 
+  // for static regions, only loop particles close to the surface
+
+  int nloop = nlocal;
+  int *list = NULL;
+  if (use_candidates()) {
+    if (neighbor->ncalls != candidates_ncalls) build_candidates(region);
+    nloop = ncandidates;
+    list = candidates;
+  }
+
   // region->match() insures particle is in region or on surface, else error
   // if returned contact dist r = 0, is on surface, also an error
   // in COLLOID case, r <= radius is an error
 
-  for (i = 0; i < nlocal; i++)
+  for (int ii = 0; ii < nloop; ii++) {
+    i = list ? list[ii] : ii;
     if (mask[i] & groupbit) {
       if (!region->match(x[i][0],x[i][1],x[i][2])) {
         onflag = 1;
@@ -264,6 +285,7 @@ void FixWallRegion::post_force(int vflag)
         ewall[3] -= fz;
       }
     }
+  }
 
   if (onflag) error->one(FLERR,"Particle on or inside surface of region "
                          "used in fix wall/region");
@@ -283,6 +305,82 @@ void FixWallRegion::min_post_force(int vflag)
   post_force(vflag);
 }
 
+/* ----------------------------------------------------------------------
+   candidate list can be used if region is static and atoms are binned
+------------------------------------------------------------------------- */
+
+int FixWallRegion::use_candidates()
+{
+  Region *region = domain->regions[iregion];
+  if (region->dynamic_check() || region->varshape) return 0;
+  if (neighbor->style != 1 || !neighbor->bins || !neighbor->binhead) return 0;
+  if (neighbor->includegroup) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   collect owned particles within cutoff + skin of the region surface
+   only bins whose center is outside the region or within reach of the
+   surface are visited, particles outside the region are kept so
+   post_force() can flag them as error
+------------------------------------------------------------------------- */
+
+void FixWallRegion::build_candidates(Region *region)
+{
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+
+  // manually trigger binning if no pairwise neigh lists exist
+  if (neighbor->n_blist() == 0) neighbor->bin_atoms();
+
+  if (nlocal > maxcandidates) {
+    maxcandidates = atom->nmax;
+    memory->destroy(candidates);
+    memory->create(candidates,maxcandidates,"wall/region:candidates");
+  }
+
+  const double dx = 0.5*neighbor->binsizex;
+  const double dy = 0.5*neighbor->binsizey;
+  const double dz = 0.5*neighbor->binsizez;
+  const double maxdiag = sqrt(dx*dx + dy*dy + dz*dz);
+  const double reach = cutoff + neighbor->skin;
+  const int mbinx = neighbor->mbinx;
+  const int mbiny = neighbor->mbiny;
+  const int mbins = neighbor->mbins;
+  const int *bins = neighbor->bins;
+  const int *binhead = neighbor->binhead;
+  double center[3];
+
+  ncandidates = 0;
+  for (int ibin = 0; ibin < mbins; ibin++) {
+    if (binhead[ibin] < 0 || binhead[ibin] >= nlocal) continue;
+
+    neighbor->bin_center(ibin % mbinx,(ibin/mbinx) % mbiny,ibin/(mbinx*mbiny),center);
+    if (region->match(center[0],center[1],center[2]) &&
+        region->surface(center[0],center[1],center[2],reach+maxdiag) == 0)
+      continue;
+
+    // owned atoms are at the front of each bin
+    for (int i = binhead[ibin]; i >= 0 && i < nlocal; i = bins[i]) {
+      if (region->match(x[i][0],x[i][1],x[i][2]) &&
+          region->surface(x[i][0],x[i][1],x[i][2],reach) == 0)
+        continue;
+      candidates[ncandidates++] = i;
+    }
+  }
+
+  candidates_ncalls = neighbor->ncalls;
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of candidate list
+------------------------------------------------------------------------- */
+
+double FixWallRegion::memory_usage()
+{
+  return maxcandidates*sizeof(int);
+}
+
 /* ----------------------------------------------------------------------
    energy of wall interaction
 ------------------------------------------------------------------------- */
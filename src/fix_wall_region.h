@@ -69,6 +69,7 @@ class FixWallRegion : public Fix {
   void min_post_force(int);
   double compute_scalar();
   double compute_vector(int);
+  double memory_usage();
 
  private:
   int style,iregion;
@@ -86,6 +87,15 @@ class FixWallRegion : public Fix {
   void lj126(double);
   void colloid(double, double);
   void harmonic(double);
+
+  // particles near the wall, taken from neighbor bins close to the surface
+  // only used for static regions, refreshed on each neighbor list build
+  int use_candidates();
+  void build_candidates(class Region *);
+
+  int ncandidates,maxcandidates;
+  int *candidates;
+  bigint candidates_ncalls;
 };
 
 }
@@ -163,8 +163,27 @@ void Force::init()
   if (angle) angle->init();
   if (dihedral) dihedral->init();
   if (improper) improper->init();
-  if(cg_active() && warn_cg() && atom->ntypes != int(coarsegrainingTypeBased_.size()))
-    error->warningAll(FLERR,"Coarse graining factor not specified for all atom types. will use maximum CG for unspecified atom types.\n\n");
+
+  if(int(coarsegrainingTypeBased_.size()) > atom->ntypes)
+    error->all(FLERR,"Coarse-graining factor specified for atom type that does not exist");
+}
+
+/* ----------------------------------------------------------------------
+   print coarse-graining factors to screen and logfile
+------------------------------------------------------------------------- */
+
+void Force::reportCG()
+{
+  if (comm->me != 0) return;
+
+  if (screen) fprintf(screen,"Coarse-graining factor: %g\n",coarsegraining_);
+  if (logfile) fprintf(logfile,"Coarse-graining factor: %g\n",coarsegraining_);
+  for(unsigned int it=0;it<coarsegrainingTypeBased_.size();it++)
+  {
+    if(coarsegrainingTypeBased_[it] <= 0.) continue;
+    if (screen) fprintf(screen,"  type %d: coarse-graining factor %g\n",it+1,coarsegrainingTypeBased_[it]);
+    if (logfile) fprintf(logfile,"  type %d: coarse-graining factor %g\n",it+1,coarsegrainingTypeBased_[it]);
+  }
 }
 
 /* ----------------------------------------------------------------------
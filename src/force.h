@@ -161,32 +161,29 @@ class Force : protected Pointers {
   int inumeric(const char *, const int, const char *const);
   bigint memory_usage();
 
-  bool setCG(double cg)
+  // global coarse-graining factor, used for all types without override
+  void setCG(double cg)
+  { coarsegraining_ = cg; }
+
+  // per-type override, unset entries (0) fall back to the global factor
+  void setCG(int typeID, double cg)
   {
-      bool useTypeSpecific = false;
-      if(coarsegraining_>1.0)
-      {
-        coarsegraining_ = std::max(coarsegraining_,cg); //set maximum we use type-specific CG
-        useTypeSpecific = true;
-      }
-      else
-        coarsegraining_ = cg;
-
-      coarsegrainingTypeBased_.push_back(cg);
-
-      return useTypeSpecific;
+      if(typeID > int(coarsegrainingTypeBased_.size()))
+        coarsegrainingTypeBased_.resize(typeID,0.);
+      coarsegrainingTypeBased_[typeID-1] = cg;
   }
 
-  void reportCG()
+  void setCGCheck(bool error_cg, bool warn_cg)
   {
-    printf("Force: coarsegrainingfactor: %g.\n", coarsegraining_);
-    for(unsigned int it=0;it<coarsegrainingTypeBased_.size();it++)
-        printf("Force: type-specific coarsegrainingfactor(%d): %g.\n", it,coarsegrainingTypeBased_[it]);
+      error_coarsegraining_ = error_cg;
+      warn_coarsegraining_ = warn_cg;
   }
 
+  void reportCG();
+
   inline double cg(int typeID)
   {
-    if(typeID<=int(coarsegrainingTypeBased_.size()))
+    if(typeID > 0 && typeID<=int(coarsegrainingTypeBased_.size()) && coarsegrainingTypeBased_[typeID-1] > 0.)
         return coarsegrainingTypeBased_[typeID-1];
     else
         return coarsegraining_;
@@ -207,7 +204,7 @@ class Force : protected Pointers {
   //{ return coarsegraining_; }
 
   inline bool cg_active() 
-  { return (coarsegraining_ > 1. || coarsegrainingTypeBased_.size() > 0); }
+  { return cg_max() > 1.; }
 
   inline bool error_cg() 
   { return error_coarsegraining_; }
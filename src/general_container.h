@@ -134,7 +134,7 @@ namespace LAMMPS_NS
                            bool scale=false,bool translate=false, bool rotate=false);
           inline int pushElemListToBufferReverse(int first, int n, double *buf, int operation,
                            bool scale=false,bool translate=false, bool rotate=false);
-          inline int popElemListFromBufferReverse(int n, int *list, double *buf, int operation,
+          inline int popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, double *dlo, double *dhi,
                            bool scale=false,bool translate=false, bool rotate=false);
 
           // push / pop one single element
@@ -747,10 +747,15 @@ int GeneralContainer<T,NUM_VEC,LEN_VEC>::pushElemListToBuffer(int n, int *list,
     if(!this->decideCommOperation(operation))
         return 0;
 
+    // ghosts across the periodic faces of a wedge domain are rotated
+    // positions around the wedge axis, other 3-vectors as directions
+    const bool wrapRot = LEN_VEC == 3 && (wrapPeriodic() || !isRotationInvariant());
+
     for(int ii = 0; ii < n; ii++)
     {
         i = list[ii];
         for(int j = 0; j < NUM_VEC; j++)
+        {
             for(int k = 0; k < LEN_VEC; k++)
             {
                 buf[m] = static_cast<double>(arr_[i][j][k]);
@@ -771,6 +776,9 @@ int GeneralContainer<T,NUM_VEC,LEN_VEC>::pushElemListToBuffer(int n, int *list,
                 }
                 m++;
             }
+            if (wrapRot && (wraplist[ii] & (IS_GHOST_WRAP_ROT_NEG | IS_GHOST_WRAP_ROT_POS)))
+                wrapRotate(&buf[m-LEN_VEC],wraplist[ii],dlo,dhi,wrapPeriodic(),false);
+        }
     }
 
     return (n*NUM_VEC*LEN_VEC);
@@ -824,7 +832,7 @@ int GeneralContainer<T,NUM_VEC,LEN_VEC>::pushElemListToBufferReverse(int first,
 }
 
 template<typename T, int NUM_VEC, int LEN_VEC>
-int GeneralContainer<T,NUM_VEC,LEN_VEC>::popElemListFromBufferReverse(int n, int *list,double *buf,int operation,bool scale,bool translate, bool rotate)
+int GeneralContainer<T,NUM_VEC,LEN_VEC>::popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf,int operation, double *dlo, double *dhi, bool scale,bool translate, bool rotate)
 {
     int i,m = 0;
 
@@ -833,13 +841,21 @@ int GeneralContainer<T,NUM_VEC,LEN_VEC>::popElemListFromBufferReverse(int n, int
 
     if(COMM_TYPE_REVERSE == this->communicationType())
     {
-        
+        // contributions from ghosts across the periodic faces of a wedge
+        // domain are rotated back before they are added
+        const bool wrapRot = LEN_VEC == 3 && !isRotationInvariant();
+
         for(int ii = 0; ii < n; ii++)
         {
             i = list[ii];
+            const bool rotateBack = wrapRot && (wraplist[ii] & (IS_GHOST_WRAP_ROT_NEG | IS_GHOST_WRAP_ROT_POS));
             for(int j = 0; j < NUM_VEC; j++)
+            {
+                if (rotateBack)
+                    wrapRotate(&buf[m],wraplist[ii],dlo,dhi,false,true);
                 for(int k = 0; k < LEN_VEC; k++)
                     arr_[i][j][k] += static_cast<T>(buf[m++]);
+            }
         }
     }
     else if(sizeof(int) == sizeof(T) && COMM_TYPE_REVERSE_BITFIELD == this->communicationType())
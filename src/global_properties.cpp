@@ -543,6 +543,162 @@ namespace MODEL_PARAMS
     return matrix;
   }
 
+  /* ----------------------------------------------------------------------
+     per-type-pair coefficient tables derived from static material
+     properties; they move the type-only factors and square roots of the
+     contact laws out of the per-contact evaluation
+  ------------------------------------------------------------------------- */
+
+  MatrixProperty * createHertzKnCoefficient(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+
+    registry.registerProperty("Yeff", &createYeff);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** Yeff = registry.getMatrixProperty("Yeff",caller)->data;
+
+    // kn = 4/3 Yeff sqrt(reff deltan)
+
+    for(int i=1;i< max_type+1; i++)
+      for(int j=1;j<max_type+1;j++)
+        matrix->data[i][j] = 4./3.*Yeff[i][j];
+
+    return matrix;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  MatrixProperty * createHertzKtCoefficient(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+
+    registry.registerProperty("Geff", &createGeff);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** Geff = registry.getMatrixProperty("Geff",caller)->data;
+
+    // kt = St = 8 Geff sqrt(reff deltan)
+
+    for(int i=1;i< max_type+1; i++)
+      for(int j=1;j<max_type+1;j++)
+        matrix->data[i][j] = 8.*Geff[i][j];
+
+    return matrix;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  MatrixProperty * createHertzGammanCoefficient(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+    const double sqrtFiveOverSix = 0.91287092917527685576161630466800355658790782499663875;
+
+    registry.registerProperty("Yeff", &createYeff);
+    registry.registerProperty("betaeff", &createBetaEff);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** Yeff = registry.getMatrixProperty("Yeff",caller)->data;
+    double ** betaeff = registry.getMatrixProperty("betaeff",caller)->data;
+
+    // gamman = -2 sqrt(5/6) betaeff sqrt(Sn meff) with Sn = 2 Yeff sqrt(reff deltan)
+
+    for(int i=1;i< max_type+1; i++)
+      for(int j=1;j<max_type+1;j++)
+        matrix->data[i][j] = -2.*sqrtFiveOverSix*betaeff[i][j]*sqrt(2.*Yeff[i][j]);
+
+    return matrix;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  MatrixProperty * createHertzGammatCoefficient(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+    const double sqrtFiveOverSix = 0.91287092917527685576161630466800355658790782499663875;
+
+    registry.registerProperty("Geff", &createGeff);
+    registry.registerProperty("betaeff", &createBetaEff);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** Geff = registry.getMatrixProperty("Geff",caller)->data;
+    double ** betaeff = registry.getMatrixProperty("betaeff",caller)->data;
+
+    // gammat = -2 sqrt(5/6) betaeff sqrt(St meff) with St = 8 Geff sqrt(reff deltan)
+
+    for(int i=1;i< max_type+1; i++)
+      for(int j=1;j<max_type+1;j++)
+        matrix->data[i][j] = -2.*sqrtFiveOverSix*betaeff[i][j]*sqrt(8.*Geff[i][j]);
+
+    return matrix;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  MatrixProperty * createHookeKnCoefficient(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+
+    registry.registerProperty("Yeff", &createYeff);
+    registry.registerProperty("charVel", &createCharacteristicVelocity);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** Yeff = registry.getMatrixProperty("Yeff",caller)->data;
+    const double charVel = registry.getScalarProperty("charVel",caller)->data;
+
+    // kn = 16/15 sqrt(reff) Yeff (15 meff charVel^2 / (16 sqrt(reff) Yeff))^0.2
+    //    = 16/15 Yeff (15 charVel^2 / (16 Yeff))^0.2 * sqrt(reff) (meff / sqrt(reff))^0.2
+
+    for(int i=1;i< max_type+1; i++)
+      for(int j=1;j<max_type+1;j++)
+        matrix->data[i][j] = 16./15.*Yeff[i][j]*pow(15.*charVel*charVel/(16.*Yeff[i][j]),0.2);
+
+    return matrix;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  MatrixProperty * createHookeDampingFactor(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+
+    registry.registerProperty("coeffRestLog", &createCoeffRestLog);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** coeffRestLog = registry.getMatrixProperty("coeffRestLog",caller)->data;
+
+    // gamman = sqrt(4 meff kn log(e)^2 / (log(e)^2 + pi^2))
+
+    for(int i=1;i< max_type+1; i++)
+    {
+      for(int j=1;j<max_type+1;j++)
+      {
+        const double logSq = coeffRestLog[i][j]*coeffRestLog[i][j];
+        matrix->data[i][j] = 4.*logSq/(logSq+M_PI*M_PI);
+      }
+    }
+
+    return matrix;
+  }
+
+  /* ---------------------------------------------------------------------- */
+
+  MatrixProperty * createCoeffRestMaxLog(PropertyRegistry & registry, const char * caller, bool)
+  {
+    const int max_type = registry.max_type();
+
+    registry.registerProperty("coeffRestMax", &createCoeffRestMax);
+
+    MatrixProperty * matrix = new MatrixProperty(max_type+1, max_type+1);
+    double ** coeffRestMax = registry.getMatrixProperty("coeffRestMax",caller)->data;
+
+    for(int i=1;i< max_type+1; i++)
+      for(int j=1;j<max_type+1;j++)
+        matrix->data[i][j] = log(coeffRestMax[i][j]);
+
+    return matrix;
+  }
+
   /* ---------------------------------------------------------------------- */
 
   MatrixProperty* createCoeffFrict(PropertyRegistry & registry, const char * caller, bool)
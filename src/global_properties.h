@@ -82,6 +82,15 @@ namespace MODEL_PARAMS
     MatrixProperty* createCoeffRestLog(PropertyRegistry & registry, const char * caller, bool sanity_checks);
     MatrixProperty* createBetaEff(PropertyRegistry & registry, const char * caller, bool sanity_checks);
 
+    // per-type-pair coefficient tables of the contact models
+    MatrixProperty* createHertzKnCoefficient(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+    MatrixProperty* createHertzKtCoefficient(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+    MatrixProperty* createHertzGammanCoefficient(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+    MatrixProperty* createHertzGammatCoefficient(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+    MatrixProperty* createHookeKnCoefficient(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+    MatrixProperty* createHookeDampingFactor(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+    MatrixProperty* createCoeffRestMaxLog(PropertyRegistry & registry, const char * caller, bool sanity_checks);
+
     MatrixProperty* createCoeffFrict(PropertyRegistry & registry, const char * caller, bool sanity_checks);
     MatrixProperty* createCoeffRollFrict(PropertyRegistry & registry, const char * caller, bool sanity_checks);
     MatrixProperty* createCoeffFricVisc(PropertyRegistry & registry, const char * caller, bool sanity_checks); // For new models
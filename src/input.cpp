@@ -78,6 +78,7 @@
 #include "kspace.h"
 #include "update.h"
 #include "neighbor.h"
+#include "timer.h"
 #include "special.h"
 #include "variable.h"
 #include "accelerator_cuda.h"
@@ -583,6 +584,7 @@ int Input::execute_command()
   else if (!strcmp(command,"bond_style")) bond_style();
   else if (!strcmp(command,"boundary")) boundary();
   else if (!strcmp(command,"box")) box();
+  else if (!strcmp(command,"coarsegraining")) coarsegraining();
   else if (!strcmp(command,"communicate")) communicate();
   else if (!strcmp(command,"compute")) compute();
   else if (!strcmp(command,"compute_modify")) compute_modify();
@@ -1270,6 +1272,54 @@ void Input::box()
 }
 
 /* ---------------------------------------------------------------------- */
+
+void Input::coarsegraining()
+{
+  if (narg < 1) error->all(FLERR,"Illegal coarsegraining command");
+  if (atom->natoms > 0 || modify->n_fixes_style("particletemplate") > 0)
+    error->all(FLERR,"coarsegraining must be used before particles or "
+               "particle templates are defined");
+
+  const double cg = force->numeric(FLERR,arg[0]);
+  if (cg < 1.)
+    error->all(FLERR,"Illegal coarsegraining command, "
+               "coarse-graining factor must be >= 1");
+  force->setCG(cg);
+
+  int iarg = 1;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"type") == 0) {
+      if (iarg+3 > narg) error->all(FLERR,"Illegal coarsegraining command");
+      const int itype = force->inumeric(FLERR,arg[iarg+1]);
+      const double cg_type = force->numeric(FLERR,arg[iarg+2]);
+      if (itype < 1)
+        error->all(FLERR,"Illegal coarsegraining command, "
+                   "atom type must be >= 1");
+      if (cg_type < 1.)
+        error->all(FLERR,"Illegal coarsegraining command, "
+                   "coarse-graining factor must be >= 1");
+      force->setCG(itype,cg_type);
+      iarg += 3;
+    } else if (strcmp(arg[iarg],"model_check") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal coarsegraining command");
+      if (strcmp(arg[iarg+1],"error") == 0)
+        force->setCGCheck(true,false);
+      else if (strcmp(arg[iarg+1],"warn") == 0)
+        force->setCGCheck(false,true);
+      else if (strcmp(arg[iarg+1],"off") == 0)
+        force->setCGCheck(false,false);
+      else
+        error->all(FLERR,"Illegal coarsegraining command, "
+                   "model_check expects 'error', 'warn' or 'off'");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal coarsegraining command");
+  }
+
+  force->reportCG();
+}
+
+/* ---------------------------------------------------------------------- */
+
 void Input::communicate()
 {
   comm->set(narg,arg);
@@ -1509,7 +1559,7 @@ void Input::modify_timing()
 {
   int timing = 0;
 
-  if (narg == 1) {
+  if (narg == 1 || narg == 4) {
     if (strcmp(arg[0],"off") == 0) timing = 0;
     else if (strcmp(arg[0],"on") == 0) timing = 1;
     else if (strcmp(arg[0],"verbose") == 0) timing = 2;
@@ -1517,6 +1567,16 @@ void Input::modify_timing()
   } else error->all(FLERR,"Illegal modify_timing command");
 
   modify->timing = timing;
+
+  // optional export of fix and compute times every N steps
+
+  if (narg == 4) {
+    if (strcmp(arg[1],"timeline") != 0 || timing == 0)
+      error->all(FLERR,"Illegal modify_timing command");
+    int every = force->inumeric(FLERR,arg[2]);
+    if (every <= 0) error->all(FLERR,"Illegal modify_timing command");
+    timer->set_timeline(every,arg[3]);
+  } else timer->set_timeline(0,NULL);
 }
 
 /* ---------------------------------------------------------------------- */
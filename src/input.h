@@ -132,6 +132,7 @@ class Input : protected Pointers {
   void bond_style();
   void boundary();
   void box();
+  void coarsegraining();
   void communicate();
   void compute();
   void compute_modify();
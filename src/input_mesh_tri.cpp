@@ -55,23 +55,39 @@
 #include "domain.h"
 #include <cmath>
 #include "vector_liggghts.h"
+#include "math_extra_liggghts.h"
 #include "input_mesh_tri.h"
 #include "tri_mesh.h"
+#include <vector>
+#include <algorithm>
 
 using namespace LAMMPS_NS;
 
+#define DELTA_FACETS 16384
+#define BCAST_CHUNK  100000
+#define STL_RECORD   50
+
 InputMeshTri::InputMeshTri(LAMMPS *lmp, int argc, char **argv) : Input(lmp, argc, argv),
 verbose_(false),
 i_exclusion_list_(0),
 size_exclusion_list_(0),
-exclusion_list_(0)
+exclusion_list_(0),
+nfacets_(0),
+maxfacets_(0),
+facets_(0),
+facet_lines_(0)
 {}
 
 InputMeshTri::~InputMeshTri()
-{}
+{
+  memory->destroy(facets_);
+  memory->destroy(facet_lines_);
+}
 
 /* ----------------------------------------------------------------------
    process all input from filename
+   file is parsed on proc 0 only, facets are then broadcast in bulk
+   and added to the mesh on all procs
 ------------------------------------------------------------------------- */
 
 void InputMeshTri::meshtrifile(const char *filename, class TriMesh *mesh,bool verbose,
@@ -81,7 +97,8 @@ void InputMeshTri::meshtrifile(const char *filename, class TriMesh *mesh,bool ve
   verbose_ = verbose;
   size_exclusion_list_ = size_exclusion_list;
   exclusion_list_ = exclusion_list;
-  
+  nfacets_ = 0;
+
   if(strlen(filename) < 5)
     error->all(FLERR,"Illegal command, file name too short for input of triangular mesh");
   const char *ext = &(filename[strlen(filename)-3]);
@@ -92,6 +109,9 @@ void InputMeshTri::meshtrifile(const char *filename, class TriMesh *mesh,bool ve
   bool is_stl = (strcmp(ext,"stl") == 0) || (strcmp(ext,"STL") == 0);
   bool is_vtk = (strcmp(ext,"vtk") == 0) || (strcmp(ext,"VTK") == 0);
 
+  if(!is_stl && !is_vtk)
+    error->all(FLERR,"Illegal command, need either an STL file or a VTK file as input for triangular mesh.");
+
   // error if another nested file still open
   // if single open file is not stdin, close it
   // open new filename and set stl___file
@@ -104,96 +124,86 @@ void InputMeshTri::meshtrifile(const char *filename, class TriMesh *mesh,bool ve
       sprintf(str,"Cannot open mesh file %s",filename);
       error->one(FLERR,str);
     }
+
+    if(is_stl)
+    {
+        fprintf(screen,"\nReading STL file '%s' (mesh processing step 1/3) \n",filename);
+        meshtrifile_stl(filename);
+    }
+    else
+    {
+        fprintf(screen,"\nReading VTK file '%s' (mesh processing step 1/3) \n",filename);
+        meshtrifile_vtk();
+    }
+
+    if(nonlammps_file) fclose(nonlammps_file);
   } else nonlammps_file = NULL;
 
-  if(is_stl)
-  {
-      if (comm->me == 0) fprintf(screen,"\nReading STL file '%s' (mesh processing step 1/3) \n",filename);
-      meshtrifile_stl(mesh,region,filename);
-      
-  }
-  else if(is_vtk)
-  {
-      if (comm->me == 0) fprintf(screen,"\nReading VTK file '%s' (mesh processing step 1/3) \n",filename);
-      meshtrifile_vtk(mesh,region);
+  bcast_facets();
+  add_facets(mesh,region,filename);
+}
+
+/* ----------------------------------------------------------------------
+   read a line from the mesh file, only called on proc 0
+   return n = length of line including str terminator, 0 if end of file
+   if line ends in continuation char '&', concatenate next line
+------------------------------------------------------------------------- */
+
+int InputMeshTri::read_line()
+{
+  int n = 0, m = 0;
+
+  while (1) {
+    if (maxline-m < 2) reallocate(line,maxline,0);
+    if (fgets(&line[m],maxline-m,nonlammps_file) == NULL) {
+      if (m) n = strlen(line) + 1;
+      else n = 0;
+      break;
+    }
+    m = strlen(line);
+    if (line[m-1] != '\n') continue;
+
+    m--;
+    while (m >= 0 && isspace(line[m])) m--;
+    if (m < 0 || line[m] != '&') {
+      line[m+1] = '\0';
+      n = m+2;
+      break;
+    }
   }
-  else error->all(FLERR,"Illegal command, need either an STL file or a VTK file as input for triangular mesh.");
 
-  if(nonlammps_file) fclose(nonlammps_file);
+  return n;
 }
 
 /* ----------------------------------------------------------------------
-   process VTK file
+   process VTK file, only called on proc 0
 ------------------------------------------------------------------------- */
 
-void InputMeshTri::meshtrifile_vtk(class TriMesh *mesh,class Region *region)
+void InputMeshTri::meshtrifile_vtk()
 {
-  int n,m;
-
   double **points = NULL;
   int ipoint = 0,npoints = 0;
 
   int **cells = NULL, *lines = NULL;
   int icell = 0,ncells = 0;
 
-  int ntris = 0;
   int iLine = 0;
 
   int nLines = 0;
 
-  while (1)
+  while (read_line() > 0)
   {
-    // read a line from input script
-    // n = length of line including str terminator, 0 if end of file
-    // if line ends in continuation char '&', concatenate next line
-
-    if (me == 0) {
-      m = 0;
-      while (1) {
-        if (maxline-m < 2) reallocate(line,maxline,0);
-        if (fgets(&line[m],maxline-m,nonlammps_file) == NULL) {
-          if (m) n = strlen(line) + 1;
-          else n = 0;
-          break;
-        }
-        m = strlen(line);
-        if (line[m-1] != '\n') continue;
-
-        m--;
-        while (m >= 0 && isspace(line[m])) m--;
-        if (m < 0 || line[m] != '&') {
-          line[m+1] = '\0';
-          n = m+2;
-          break;
-        }
-      }
-    }
-
-    // bcast the line
-    // if n = 0, end-of-file
-    // error if label_active is set, since label wasn't encountered
-    // if original input file, code is done
-    // else go back to previous input file
-
-    MPI_Bcast(&n,1,MPI_INT,0,world);
-    if (n == 0) {
-      break;
-    }
-
-    if (n > maxline) reallocate(line,maxline,n);
-    MPI_Bcast(line,n,MPI_CHAR,0,world);
-
     // lines start with 1 (not 0)
     nLines++;
 
-    if (0 == (nLines % 100000) && comm->me == 0)
+    if (0 == (nLines % 100000))
         fprintf(screen,"   successfully read a chunk of 100000 elements in VTK file\n");
 
     // parse one line from the file
     parse_nonlammps();
     // skip empty lines
     if(narg == 0){
-         if (me == 0 && verbose_)
+         if (verbose_)
             fprintf(screen,"Note: Skipping empty line in VTK mesh file\n");
       continue;
     }
@@ -206,21 +216,21 @@ void InputMeshTri::meshtrifile_vtk(class TriMesh *mesh,class Region *region)
     if(iLine == 3)
     {
         if(strcmp(arg[0],"ASCII"))
-            error->all(FLERR,"Expecting ASCII VTK mesh file, cannot continue");
+            error->one(FLERR,"Expecting ASCII VTK mesh file, cannot continue");
         continue;
     }
 
     if(iLine == 4)
     {
-        if(strcmp(arg[0],"DATASET UNSTRUCTURED_GRID"))
-            error->all(FLERR,"Expecting ASCII VTK unstructured grid mesh file, cannot continue");
+        if(narg < 2 || strcmp(arg[0],"DATASET") || strcmp(arg[1],"UNSTRUCTURED_GRID"))
+            error->one(FLERR,"Expecting ASCII VTK unstructured grid mesh file, cannot continue");
         continue;
     }
 
     if(iLine == 5)
     {
-        if(strcmp(arg[0],"POINTS"))
-            error->all(FLERR,"Expecting 'POINTS' section in ASCII VTK mesh file, cannot continue");
+        if(narg < 2 || strcmp(arg[0],"POINTS"))
+            error->one(FLERR,"Expecting 'POINTS' section in ASCII VTK mesh file, cannot continue");
         npoints = atoi(arg[1]);
         memory->create<double>(points,npoints,3,"input_mesh:points");
         continue;
@@ -229,19 +239,19 @@ void InputMeshTri::meshtrifile_vtk(class TriMesh *mesh,class Region *region)
     if(iLine <= 5+npoints)
     {
         if(narg != 3)
-            error->all(FLERR,"Expecting 3 values for each point in 'POINTS' section of ASCII VTK mesh file, cannot continue");
+            error->one(FLERR,"Expecting 3 values for each point in 'POINTS' section of ASCII VTK mesh file, cannot continue");
 
-        points[ipoint][0] = atof(arg[0]);
-        points[ipoint][1] = atof(arg[1]);
-        points[ipoint][2] = atof(arg[2]);
+        points[ipoint][0] = strtod(arg[0],NULL);
+        points[ipoint][1] = strtod(arg[1],NULL);
+        points[ipoint][2] = strtod(arg[2],NULL);
         ipoint++;
         continue;
     }
 
     if(iLine == 6+npoints)
     {
-        if(strcmp(arg[0],"CELLS"))
-            error->all(FLERR,"Expecting 'CELLS' section in ASCII VTK mesh file, cannot continue");
+        if(narg < 2 || strcmp(arg[0],"CELLS"))
+            error->one(FLERR,"Expecting 'CELLS' section in ASCII VTK mesh file, cannot continue");
         ncells = atoi(arg[1]);
         memory->create<int>(cells,ncells,3,"input_mesh:cells");
         memory->create<int>(lines,ncells,"input_mesh:lines");
@@ -252,7 +262,14 @@ void InputMeshTri::meshtrifile_vtk(class TriMesh *mesh,class Region *region)
     if(iLine <= 6+npoints+ncells)
     {
         if(narg == 4)
-            for (int j=0;j<3;j++) cells[icell][j] = atoi(arg[1+j]);
+        {
+            for (int j=0;j<3;j++)
+            {
+                cells[icell][j] = atoi(arg[1+j]);
+                if(cells[icell][j] < 0 || cells[icell][j] >= npoints)
+                    error->one(FLERR,"Point index out of range in 'CELLS' section of ASCII VTK mesh file, cannot continue");
+            }
+        }
         else
             cells[icell][0] = -1;
 
@@ -264,50 +281,63 @@ void InputMeshTri::meshtrifile_vtk(class TriMesh *mesh,class Region *region)
 
     if(iLine == 7+npoints+ncells)
     {
-        if(strcmp(arg[0],"CELL_TYPES"))
-            error->all(FLERR,"Expecting 'CELL_TYPES' section in ASCII VTK mesh file, cannot continue");
+        if(narg < 2 || strcmp(arg[0],"CELL_TYPES"))
+            error->one(FLERR,"Expecting 'CELL_TYPES' section in ASCII VTK mesh file, cannot continue");
         if(ncells != atoi(arg[1]))
-            error->all(FLERR,"Inconsistency in 'CELL_TYPES' section in ASCII VTK mesh file, cannot continue");
+            error->one(FLERR,"Inconsistency in 'CELL_TYPES' section in ASCII VTK mesh file, cannot continue");
          icell = 0;
         continue;
     }
 
-    //only take triangles (cell type 5 according to VTK standard) - count them
+    //only take triangles (cell type 5 according to VTK standard)
     if(iLine <= 7+npoints+2*ncells)
     {
-        if(strcmp(arg[0],"5")) cells[icell][0] = -1; //remove if not a tet
-        else ntris++;
+        if(strcmp(arg[0],"5")) cells[icell][0] = -1; //remove if not a tri
         icell++;
         continue;
     }
 
   }
 
-  //now that everything is parsed, write the data into the mesh
+  //now that everything is parsed, store the triangles
   for(int i = 0; i < ncells; i++)
   {
       if(cells[i][0] == -1) continue;
-      if(size_exclusion_list_ > 0 && lines[i] == exclusion_list_[i_exclusion_list_])
-      {
-         if(i_exclusion_list_ < size_exclusion_list_-1)
-            i_exclusion_list_++;
-         continue;
-      }
-      if(!region || ( region->match(points[cells[i][0]]) && region->match(points[cells[i][1]]) && region->match(points[cells[i][2]]) ) )
-      addTriangle(mesh,points[cells[i][0]],points[cells[i][1]],points[cells[i][2]],lines[i]);
+      add_facet(points[cells[i][0]],points[cells[i][1]],points[cells[i][2]],lines[i]);
   }
 
   memory->destroy<double>(points);
   memory->destroy<int>(cells);
+  memory->destroy<int>(lines);
 }
 
 /* ----------------------------------------------------------------------
-   process STL file
+   split next whitespace-separated word off str, NULL if none is left
 ------------------------------------------------------------------------- */
 
-void InputMeshTri::meshtrifile_stl(class TriMesh *mesh,class Region *region, const char *filename)
+static char *stl_word(char *&str)
+{
+  char *start = &str[strspn(str," \t\n\v\f\r")];
+  if (*start == '\0') return NULL;
+
+  char *stop = &start[strcspn(start," \t\n\v\f\r")];
+  if (*stop == '\0') str = stop;
+  else
+  {
+      *stop = '\0';
+      str = stop+1;
+  }
+  return start;
+}
+
+/* ----------------------------------------------------------------------
+   process STL file, only called on proc 0
+   lines are split in place and vertices converted with strtod, avoiding
+   the per-line broadcast and generic parsing of the input script reader
+------------------------------------------------------------------------- */
+
+void InputMeshTri::meshtrifile_stl(const char *filename)
 {
-  int n,m;
   int iVertex = 0;
   double vertices[3][3];
   bool insideSolidObject = false;
@@ -316,263 +346,367 @@ void InputMeshTri::meshtrifile_stl(class TriMesh *mesh,class Region *region, con
 
   int nLines = 0, nLinesTri = 0;
 
-  while (1)
+  while (read_line() > 0)
   {
-    
-    // read a line from input script
-    // n = length of line including str terminator, 0 if end of file
-    // if line ends in continuation char '&', concatenate next line
-
-    if (me == 0) {
-      m = 0;
-      while (1) {
-        if (maxline-m < 2) reallocate(line,maxline,0);
-        if (fgets(&line[m],maxline-m,nonlammps_file) == NULL) {
-          if (m) n = strlen(line) + 1;
-          else n = 0;
-          break;
-        }
-        m = strlen(line);
-        if (line[m-1] != '\n') continue;
-
-        m--;
-        while (m >= 0 && isspace(line[m])) m--;
-        if (m < 0 || line[m] != '&') {
-          line[m+1] = '\0';
-          n = m+2;
-          break;
-        }
-      }
-    }
-
-    // bcast the line
-    // if n = 0, end-of-file
-    // error if label_active is set, since label wasn't encountered
-    // if original input file, code is done
-    // else go back to previous input file
-
-    MPI_Bcast(&n,1,MPI_INT,0,world);
-    if (n == 0) {
-      break;
-    }
-
-    if (n > maxline) reallocate(line,maxline,n);
-    MPI_Bcast(line,n,MPI_CHAR,0,world);
-
     // lines start with 1 (not 0)
     nLines++;
 
-    if (0 == (nLines % 100000) && comm->me == 0)
+    if (0 == (nLines % 100000))
         fprintf(screen,"   successfully read a chunk of 100000 elements in STL file '%s'\n",filename);
 
     // parse one line from the stl file
 
-    parse_nonlammps();
+    char *ptr = line;
+    char *word = stl_word(ptr);
 
     // skip empty lines
-    if(narg==0){
-         if (me == 0 && verbose_)
+    if(!word){
+         if (verbose_)
             fprintf(screen,"Note: Skipping empty line in STL file\n");
       continue;
     }
 
-    if (strcmp(arg[0],"solid") != 0 && nLines == 1)
+    if (strcmp(word,"solid") != 0 && nLines == 1)
     {
-        if (me == 0)
-        {
-            fclose(nonlammps_file);
-            if (verbose_)
-                fprintf(screen,"Note: solid keyword not found, assuming binary stl file\n");
-        }
+        fclose(nonlammps_file);
+        if (verbose_)
+            fprintf(screen,"Note: solid keyword not found, assuming binary stl file\n");
         nonlammps_file = NULL;
-        meshtrifile_stl_binary(mesh, region, filename);
+        meshtrifile_stl_binary(filename);
         break;
     }
 
     // detect begin and end of a solid object, facet and vertices
-    if (strcmp(arg[0],"solid") == 0)
+    if (strcmp(word,"solid") == 0)
     {
       if (insideSolidObject)
-        error->all(FLERR,"Corrupt or unknown STL file: New solid object begins without closing prior solid object.");
+        error->one(FLERR,"Corrupt or unknown STL file: New solid object begins without closing prior solid object.");
       insideSolidObject=true;
-      if (me == 0 && verbose_){
+      if (verbose_){
          fprintf(screen,"Solid body detected in STL file\n");
        }
     }
-    else if (strcmp(arg[0],"endsolid") == 0)
+    else if (strcmp(word,"endsolid") == 0)
     {
        if (!insideSolidObject)
-         error->all(FLERR,"Corrupt or unknown STL file: End of solid object found, but no begin.");
+         error->one(FLERR,"Corrupt or unknown STL file: End of solid object found, but no begin.");
        insideSolidObject=false;
-       if (me == 0 && verbose_) {
+       if (verbose_) {
          fprintf(screen,"End of solid body detected in STL file.\n");
        }
     }
 
     // detect begin and end of a facet within a solids object
-    else if (strcmp(arg[0],"facet") == 0)
+    else if (strcmp(word,"facet") == 0)
     {
       if (insideFacet)
-        error->all(FLERR,"Corrupt or unknown STL file: New facet begins without closing prior facet.");
+        error->one(FLERR,"Corrupt or unknown STL file: New facet begins without closing prior facet.");
       if (!insideSolidObject)
-        error->all(FLERR,"Corrupt or unknown STL file: New facet begins outside solid object.");
+        error->one(FLERR,"Corrupt or unknown STL file: New facet begins outside solid object.");
       insideFacet = true;
 
       nLinesTri = nLines;
 
       // check for keyword normal belonging to facet
-      if (strcmp(arg[1],"normal") != 0)
-        error->all(FLERR,"Corrupt or unknown STL file: Facet normal not defined.");
+      word = stl_word(ptr);
+      if (!word || strcmp(word,"normal") != 0)
+        error->one(FLERR,"Corrupt or unknown STL file: Facet normal not defined.");
 
       // do not import facet normal (is calculated later)
     }
-    else if (strcmp(arg[0],"endfacet") == 0)
+    else if (strcmp(word,"endfacet") == 0)
     {
        if (!insideFacet)
-         error->all(FLERR,"Corrupt or unknown STL file: End of facet found, but no begin.");
+         error->one(FLERR,"Corrupt or unknown STL file: End of facet found, but no begin.");
        insideFacet = false;
        if (iVertex != 3)
-         error->all(FLERR,"Corrupt or unknown STL file: Number of vertices not equal to three (no triangle).");
-
-      // add triangle to mesh
-      //printVec3D(screen,"vertex",vertices[0]);
-      //printVec3D(screen,"vertex",vertices[1]);
-      //printVec3D(screen,"vertex",vertices[2]);
-
-      // nLinesTri is the line
-      
-      if(size_exclusion_list_ > 0 && nLinesTri == exclusion_list_[i_exclusion_list_])
-      {
-         
-         if(i_exclusion_list_ < size_exclusion_list_-1)
-         {
-            i_exclusion_list_++;
-            
-            while((exclusion_list_[i_exclusion_list_-1] == exclusion_list_[i_exclusion_list_]) && (i_exclusion_list_ < size_exclusion_list_-1))
-                i_exclusion_list_++;
-         }
-      }
-      else if(!region || ( region->match(vertices[0]) && region->match(vertices[1]) && region->match(vertices[2]) ) )
-      {
-          addTriangle(mesh,vertices[0],vertices[1],vertices[2],nLinesTri);
-      }
+         error->one(FLERR,"Corrupt or unknown STL file: Number of vertices not equal to three (no triangle).");
 
-       if (me == 0) {
-         //fprintf(screen,"  End of facet detected in in solid body.\n");
-       }
+      // store triangle, nLinesTri is the line
+      add_facet(vertices[0],vertices[1],vertices[2],nLinesTri);
     }
 
     //detect begin and end of an outer loop within a facet
-    else if (strcmp(arg[0],"outer") == 0)
+    else if (strcmp(word,"outer") == 0)
     {
       if (insideOuterLoop)
-        error->all(FLERR,"Corrupt or unknown STL file: New outer loop begins without closing prior outer loop.");
+        error->one(FLERR,"Corrupt or unknown STL file: New outer loop begins without closing prior outer loop.");
       if (!insideFacet)
-        error->all(FLERR,"Corrupt or unknown STL file: New outer loop begins outside facet.");
+        error->one(FLERR,"Corrupt or unknown STL file: New outer loop begins outside facet.");
       insideOuterLoop = true;
       iVertex = 0;
-
-      if (me == 0){
-         //fprintf(screen,"    Outer loop detected in facet.\n");
-       }
     }
-    else if (strcmp(arg[0],"endloop") == 0)
+    else if (strcmp(word,"endloop") == 0)
     {
        if (!insideOuterLoop)
-         error->all(FLERR,"Corrupt or unknown STL file: End of outer loop found, but no begin.");
+         error->one(FLERR,"Corrupt or unknown STL file: End of outer loop found, but no begin.");
        insideOuterLoop=false;
-       if (me == 0) {
-         //fprintf(screen,"    End of outer loop detected in facet.\n");
-       }
     }
 
-    else if (strcmp(arg[0],"vertex") == 0)
+    else if (strcmp(word,"vertex") == 0)
     {
        if (!insideOuterLoop)
-         error->all(FLERR,"Corrupt or unknown STL file: Vertex found outside a loop.");
-
-       if (me == 0) {
-         //fprintf(screen,"      Vertex found.\n");
-       }
+         error->one(FLERR,"Corrupt or unknown STL file: Vertex found outside a loop.");
+       if (iVertex >= 3)
+         error->one(FLERR,"Corrupt or unknown STL file: Can not have more than 3 vertices "
+                          "in a facet (only triangular meshes supported).");
 
       // read the vertex
       for (int j=0;j<3;j++)
-        vertices[iVertex][j]=atof(arg[1+j]);
+      {
+        char *end;
+        vertices[iVertex][j] = strtod(ptr,&end);
+        if (end == ptr)
+          error->one(FLERR,"Corrupt or unknown STL file: Vertex with less than three coordinates.");
+        ptr = end;
+      }
 
       iVertex++;
-      if (iVertex > 3)
-         error->all(FLERR,"Corrupt or unknown STL file: Can not have more than 3 vertices "
-                          "in a facet (only triangular meshes supported).");
     }
   }
 }
 
-void InputMeshTri::meshtrifile_stl_binary(class TriMesh *mesh, class Region *region, const char *filename)
+/* ----------------------------------------------------------------------
+   process binary STL file, only called on proc 0
+   records are read in blocks rather than one value at a time
+------------------------------------------------------------------------- */
+
+void InputMeshTri::meshtrifile_stl_binary(const char *filename)
 {
-    unsigned int num_of_facets;
+    unsigned int num_of_facets = 0;
     std::ifstream stl_file;
 
-    if (me == 0) {
-        // open file for reading
-        stl_file.open(filename, std::ifstream::in | std::ifstream::binary);
+    // open file for reading
+    stl_file.open(filename, std::ifstream::in | std::ifstream::binary);
 
-        // read 80 byte header into nirvana
-        for (int i=0; i<20; i++){
-          float dum;
-          stl_file.read((char *)&dum, sizeof(float));
-        }
+    // read 80 byte header into nirvana
+    char header[80];
+    stl_file.read(header, 80);
 
-        // read number of triangles
-        stl_file.read((char *)&num_of_facets, sizeof(int));
-    }
+    // read number of triangles
+    stl_file.read((char *)&num_of_facets, sizeof(int));
+
+    if (!stl_file)
+        error->one(FLERR,"Corrupt STL file: Error in reading binary STL file.");
 
-    // communicate number of triangles
-    MPI_Bcast(&num_of_facets,1,MPI_INT,0,world);
+    // one record is normal + 3 vertices as float and a short attribute
+    const unsigned int nblock = BCAST_CHUNK;
+    char *records = new char[nblock*STL_RECORD];
 
     unsigned int count = 0;
-    int nElems = 0;
-    float tri_data[12];
-    while(1) {
-        if (me == 0) {
-            // read one triangle dataset (normal + 3 vertices)
-            for (int i=0; i<12; i++)
-              stl_file.read((char *)&tri_data[i], sizeof(float));
-            // read triangle attribute into nirvana
-            short dum;
-            stl_file.read((char *)&dum, sizeof(short));
-            // error handling
-            if (!stl_file)
-                error->one(FLERR,"Corrupt STL file: Error in reading binary STL file.");
-        }
-        // communicate triangle data
-        MPI_Bcast(&tri_data,12,MPI_FLOAT,0,world);
-        // increase triangle counter
-        count++;
-        if(size_exclusion_list_ > 0 && count == (unsigned int)exclusion_list_[i_exclusion_list_]) {
-            if(i_exclusion_list_ < size_exclusion_list_-1)
-                i_exclusion_list_++;
-        }
-        else
+    while(count < num_of_facets) {
+        unsigned int nread = MIN(nblock,num_of_facets-count);
+        stl_file.read(records, nread*STL_RECORD);
+
+        // error handling
+        if (!stl_file)
+            error->one(FLERR,"Corrupt STL file: Error in reading binary STL file.");
+
+        for(unsigned int i = 0; i < nread; i++)
         {
-            double vert[9];
+            float tri_data[12];
+            memcpy(tri_data,&records[i*STL_RECORD],12*sizeof(float));
+
             // copy float vertices into double variables (ignore normal at the beginning of tri_data)
-            for (int i=0; i<9; i++)
-                vert[i] = (double) tri_data[i+3];
-            if(!region || ( region->match(&vert[0]) && region->match(&vert[3]) && region->match(&vert[6]) ) )
+            double vert[9];
+            for (int j=0; j<9; j++)
+                vert[j] = (double) tri_data[j+3];
+
+            // increase triangle counter, used as line number
+            count++;
+            add_facet(&vert[0],&vert[3],&vert[6],count);
+        }
+
+        if (nread == nblock)
+            fprintf(screen,"   successfully read a chunk of 100000 elements in STL file '%s'\n",filename);
+    }
+
+    delete []records;
+    stl_file.close();
+}
+
+/* ----------------------------------------------------------------------
+   store a triangle read from file, only called on proc 0
+------------------------------------------------------------------------- */
+
+void InputMeshTri::add_facet(double *a, double *b, double *c,int lineNumber)
+{
+    if(nfacets_ == maxfacets_)
+    {
+        maxfacets_ += DELTA_FACETS;
+        memory->grow(facets_,maxfacets_,9,"input_mesh:facets");
+        memory->grow(facet_lines_,maxfacets_,"input_mesh:facet_lines");
+    }
+
+    vectorCopy3D(a,&facets_[nfacets_][0]);
+    vectorCopy3D(b,&facets_[nfacets_][3]);
+    vectorCopy3D(c,&facets_[nfacets_][6]);
+    facet_lines_[nfacets_] = lineNumber;
+    nfacets_++;
+}
+
+/* ----------------------------------------------------------------------
+   broadcast facets read on proc 0 to all procs
+   done in chunks to keep message size within int range
+------------------------------------------------------------------------- */
+
+void InputMeshTri::bcast_facets()
+{
+    MPI_Bcast(&nfacets_,1,MPI_INT,0,world);
+
+    if(me != 0 && nfacets_ > maxfacets_)
+    {
+        maxfacets_ = nfacets_;
+        memory->grow(facets_,maxfacets_,9,"input_mesh:facets");
+        memory->grow(facet_lines_,maxfacets_,"input_mesh:facet_lines");
+    }
+
+    for(int ifacet = 0; ifacet < nfacets_; ifacet += BCAST_CHUNK)
+    {
+        int n = MIN(BCAST_CHUNK,nfacets_-ifacet);
+        MPI_Bcast(&facets_[ifacet][0],9*n,MPI_DOUBLE,0,world);
+        MPI_Bcast(&facet_lines_[ifacet],n,MPI_INT,0,world);
+    }
+}
+
+/* ----------------------------------------------------------------------
+   apply exclusion list and region, remove duplicates and add the
+   remaining facets to the mesh, called on all procs
+------------------------------------------------------------------------- */
+
+void InputMeshTri::add_facets(TriMesh *mesh,Region *region,const char *filename)
+{
+    int *use = NULL;
+    memory->create(use,nfacets_ > 0 ? nfacets_ : 1,"input_mesh:use");
+
+    for(int i = 0; i < nfacets_; i++)
+    {
+        use[i] = 1;
+
+        // facet line number is compared to the (sorted) exclusion list
+        if(size_exclusion_list_ > 0 && facet_lines_[i] == exclusion_list_[i_exclusion_list_])
+        {
+            use[i] = 0;
+
+            if(i_exclusion_list_ < size_exclusion_list_-1)
             {
-                addTriangle(mesh, &vert[0], &vert[3], &vert[6], count);
-                nElems++;
-                if (0 == (nElems % 100000) && comm->me == 0)
-                    fprintf(screen,"   successfully read a chunk of 100000 elements in STL file '%s'\n",filename);
+               i_exclusion_list_++;
+
+               while((exclusion_list_[i_exclusion_list_-1] == exclusion_list_[i_exclusion_list_]) && (i_exclusion_list_ < size_exclusion_list_-1))
+                   i_exclusion_list_++;
             }
         }
+        else if(region && !( region->match(&facets_[i][0]) && region->match(&facets_[i][3]) && region->match(&facets_[i][6]) ) )
+            use[i] = 0;
+    }
+
+    // the pairwise duplicate check in MultiNodeMesh::addElement() is O(N^2)
+    // for a whole file, so do it here and tell the mesh to skip it
+
+    if(mesh->removeDuplicates())
+    {
+        int ndup = remove_duplicates(mesh->precision(),use);
+        if(me == 0 && verbose_ && ndup > 0)
+            fprintf(screen,"Note: Removed %d duplicate elements from mesh file '%s'\n",ndup,filename);
+        mesh->setImportRemovedDuplicates(true);
+    }
+
+    int nElems = 0;
+    for(int i = 0; i < nfacets_; i++)
+    {
+        if(!use[i]) continue;
+
+        addTriangle(mesh,&facets_[i][0],&facets_[i][3],&facets_[i][6],facet_lines_[i]);
+        nElems++;
+        if (0 == (nElems % 100000) && comm->me == 0)
+            fprintf(screen,"   successfully added a chunk of 100000 elements from file '%s'\n",filename);
+    }
+
+    mesh->setImportRemovedDuplicates(false);
+
+    memory->destroy(use);
+}
+
+/* ----------------------------------------------------------------------
+   flag facets which are duplicates of an earlier facet, O(N log N)
+   same criterion as MultiNodeMesh::addElement(): all nodes shared within
+   precision. all nodes of duplicates match within precision, so do their
+   centers, so only a narrow window around each facet in a list sorted by
+   center x-coordinate has to be checked. facets are processed in file order
+   so the first occurrence is kept. degenerate facets are rejected by the
+   mesh anyway and are not considered as originals
+------------------------------------------------------------------------- */
+
+int InputMeshTri::remove_duplicates(double prec, int *use)
+{
+    std::vector< std::pair<double,int> > order;
+    std::vector<int> pos(nfacets_,-1);
+
+    for(int i = 0; i < nfacets_; i++)
+    {
+        if(!use[i]) continue;
+
+        double *n = facets_[i];
+        if(nodes_equal(&n[0],&n[3],prec) || nodes_equal(&n[3],&n[6],prec) || nodes_equal(&n[0],&n[6],prec))
+            continue;
+
+        order.push_back(std::make_pair((n[0]+n[3]+n[6])/3.,i));
+    }
+
+    std::sort(order.begin(),order.end());
+    const int norder = order.size();
+    for(int p = 0; p < norder; p++)
+        pos[order[p].second] = p;
+
+    // window is twice the precision to be safe w.r.t. round-off of centers
+    const double window = 2.*prec;
+    int ndup = 0;
+
+    for(int i = 0; i < nfacets_; i++)
+    {
+        const int p = pos[i];
+        if(p < 0) continue;
+
+        bool dup = false;
+        for(int q = p-1; !dup && q >= 0 && order[p].first-order[q].first <= window; q--)
+        {
+            const int j = order[q].second;
+            dup = j < i && use[j] && nshared_nodes(i,j,prec) == 3;
+        }
+        for(int q = p+1; !dup && q < norder && order[q].first-order[p].first <= window; q++)
+        {
+            const int j = order[q].second;
+            dup = j < i && use[j] && nshared_nodes(i,j,prec) == 3;
+        }
 
-        if (count == num_of_facets)
-            break;
+        if(dup)
+        {
+            use[i] = 0;
+            ndup++;
+        }
     }
 
-    if (me == 0)
-        stl_file.close();
+    return ndup;
+}
+
+/* ---------------------------------------------------------------------- */
+
+bool InputMeshTri::nodes_equal(double *a, double *b, double prec)
+{
+    for(int i = 0; i < 3; i++)
+      if(!MathExtraLiggghts::compDouble(a[i],b[i],prec))
+        return false;
+    return true;
+}
+
+int InputMeshTri::nshared_nodes(int i, int j, double prec)
+{
+    int nShared = 0;
+    for(int k = 0; k < 3; k++)
+      for(int l = 0; l < 3; l++)
+        if(nodes_equal(&facets_[i][3*k],&facets_[j][3*l],prec))
+          nShared++;
+    return nShared;
 }
 
 /* ----------------------------------------------------------------------
@@ -66,9 +66,24 @@ class InputMeshTri : protected Input
     int size_exclusion_list_;
     int *exclusion_list_;
 
-    void meshtrifile_vtk(class TriMesh *mesh,class Region *region);
-    void meshtrifile_stl(class TriMesh *mesh,class Region *region, const char * filename);
-    void meshtrifile_stl_binary(class TriMesh *, class Region *region, const char * filename);
+    // facets read on proc 0 and broadcast to all procs
+    // 9 node coordinates and the line number per facet
+    int nfacets_, maxfacets_;
+    double **facets_;
+    int *facet_lines_;
+
+    int read_line();
+    void meshtrifile_vtk();
+    void meshtrifile_stl(const char * filename);
+    void meshtrifile_stl_binary(const char * filename);
+
+    void add_facet(double *a, double *b, double *c,int lineNumber);
+    void bcast_facets();
+    void add_facets(class TriMesh *mesh,class Region *region,const char *filename);
+    int remove_duplicates(double prec, int *use);
+    bool nodes_equal(double *a, double *b, double prec);
+    int nshared_nodes(int i, int j, double prec);
+
     inline void addTriangle(class TriMesh *mesh,
          double *a, double *b, double *c,int lineNumber);
 
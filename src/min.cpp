@@ -290,6 +290,7 @@ void Min::setup()
   ev_set(update->ntimestep);
   force_clear();
   modify->setup_pre_force(vflag);
+  comm->flush_comm_fix();
 
   if (pair_compute_flag) force->pair->compute(eflag,vflag);
   else if (force->pair) force->pair->compute_dummy(eflag,vflag);
@@ -316,6 +317,7 @@ void Min::setup()
       requestor[m]->min_xf_get(m);
 
   modify->setup(vflag);
+  comm->flush_comm_fix();
   output->setup();
   update->setupflag = 0;
 
@@ -370,6 +372,7 @@ void Min::setup_minimal(int flag)
   ev_set(update->ntimestep);
   force_clear();
   modify->setup_pre_force(vflag);
+  comm->flush_comm_fix();
 
   if (pair_compute_flag) force->pair->compute(eflag,vflag);
   else if (force->pair) force->pair->compute_dummy(eflag,vflag);
@@ -396,6 +399,7 @@ void Min::setup_minimal(int flag)
       requestor[m]->min_xf_get(m);
 
   modify->setup(vflag);
+  comm->flush_comm_fix();
   update->setupflag = 0;
 
   // stats for Finish to print
@@ -509,6 +513,7 @@ double Min::energy_force(int resetflag)
   ev_set(update->ntimestep);
   force_clear();
   if (modify->n_min_pre_force) modify->min_pre_force(vflag);
+  comm->flush_comm_fix();
 
   timer->stamp();
 
@@ -544,6 +549,7 @@ double Min::energy_force(int resetflag)
   // fixes that affect minimization
 
   if (modify->n_min_post_force) modify->min_post_force(vflag);
+  comm->flush_comm_fix();
 
   // compute potential energy of system
   // normalize if thermo PE does
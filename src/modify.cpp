@@ -118,6 +118,7 @@ Modify::Modify(LAMMPS *lmp) :
 
   nfix_restart_global = 0;
   id_restart_global = style_restart_global = state_restart_global = NULL;
+  size_restart_global = NULL;
   nfix_restart_peratom = 0;
   id_restart_peratom = style_restart_peratom = NULL;
   index_restart_peratom = NULL;
@@ -386,7 +387,7 @@ void Modify::setup_pre_force(int vflag)
 
 void Modify::pre_initial_integrate()
 {
-  call_method_on_fixes(&Fix::pre_initial_integrate, list_pre_initial_integrate, n_pre_initial_integrate);
+  call_method_on_fixes(&Fix::pre_initial_integrate, list_pre_initial_integrate, n_pre_initial_integrate, TIME_FIX_PRE_INITIAL_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -396,7 +397,7 @@ void Modify::pre_initial_integrate()
 void Modify::initial_integrate(int vflag)
 {
   
-  call_method_on_fixes(&Fix::initial_integrate, vflag, list_initial_integrate, n_initial_integrate);
+  call_method_on_fixes(&Fix::initial_integrate, vflag, list_initial_integrate, n_initial_integrate, TIME_FIX_INITIAL_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -405,7 +406,7 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  call_method_on_fixes(&Fix::post_integrate, list_post_integrate, n_post_integrate);
+  call_method_on_fixes(&Fix::post_integrate, list_post_integrate, n_post_integrate, TIME_FIX_POST_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -415,7 +416,7 @@ void Modify::post_integrate()
 void Modify::pre_exchange()
 {
   
-  call_method_on_fixes(&Fix::pre_exchange, list_pre_exchange, n_pre_exchange);
+  call_method_on_fixes(&Fix::pre_exchange, list_pre_exchange, n_pre_exchange, TIME_FIX_PRE_EXCHANGE);
 }
 
 /* ----------------------------------------------------------------------
@@ -425,7 +426,7 @@ void Modify::pre_exchange()
 void Modify::pre_neighbor()
 {
   
-  call_method_on_fixes(&Fix::pre_neighbor, list_pre_neighbor, n_pre_neighbor);
+  call_method_on_fixes(&Fix::pre_neighbor, list_pre_neighbor, n_pre_neighbor, TIME_FIX_PRE_NEIGHBOR);
 }
 
 /* ----------------------------------------------------------------------
@@ -435,7 +436,7 @@ void Modify::pre_neighbor()
 void Modify::pre_force(int vflag)
 {
   
-  call_method_on_fixes(&Fix::pre_force, vflag, list_pre_force, n_pre_force);
+  call_method_on_fixes(&Fix::pre_force, vflag, list_pre_force, n_pre_force, TIME_FIX_PRE_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -445,7 +446,7 @@ void Modify::pre_force(int vflag)
 void Modify::post_force(int vflag)
 {
   
-  call_method_on_fixes(&Fix::post_force, vflag, list_post_force, n_post_force);
+  call_method_on_fixes(&Fix::post_force, vflag, list_post_force, n_post_force, TIME_FIX_POST_FORCE);
 }
 
 /* ----------------------------------------------------------------------
@@ -467,7 +468,7 @@ bool Modify::iterate_implicitly()
 
 void Modify::pre_final_integrate()
 {
-  call_method_on_fixes(&Fix::pre_final_integrate, list_pre_final_integrate, n_pre_final_integrate);
+  call_method_on_fixes(&Fix::pre_final_integrate, list_pre_final_integrate, n_pre_final_integrate, TIME_FIX_PRE_FINAL_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -476,7 +477,7 @@ void Modify::pre_final_integrate()
 
 void Modify::final_integrate()
 {
-  call_method_on_fixes(&Fix::final_integrate, list_final_integrate, n_final_integrate);
+  call_method_on_fixes(&Fix::final_integrate, list_final_integrate, n_final_integrate, TIME_FIX_FINAL_INTEGRATE);
 }
 
 /* ----------------------------------------------------------------------
@@ -492,7 +493,7 @@ void Modify::end_of_step()
         const int ifix = list_end_of_step[i];
         fix[ifix]->begin_time_recording();
         fix[ifix]->end_of_step();
-        fix[ifix]->end_time_recording();
+        fix[ifix]->end_time_recording(TIME_FIX_END_OF_STEP);
       }
     }
   }
@@ -520,7 +521,7 @@ double Modify::thermo_energy()
       const int ifix = list_thermo_energy[i];
       fix[ifix]->begin_time_recording();
       energy += fix[ifix]->compute_scalar();
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(TIME_FIX_THERMO_ENERGY);
     }
   }
   else
@@ -1207,6 +1208,7 @@ int Modify::read_restart(FILE *fp)
     id_restart_global = new char*[nfix_restart_global];
     style_restart_global = new char*[nfix_restart_global];
     state_restart_global = new char*[nfix_restart_global];
+    size_restart_global = new int[nfix_restart_global];
   }
 
   // read each entry and Bcast to all procs
@@ -1229,6 +1231,7 @@ int Modify::read_restart(FILE *fp)
     if (me == 0) fread(&n,sizeof(int),1,fp);
     MPI_Bcast(&n,1,MPI_INT,0,world);
     state_restart_global[i] = new char[n];
+    size_restart_global[i] = n;
     if (me == 0) fread(state_restart_global[i],sizeof(char),n,fp);
     MPI_Bcast(state_restart_global[i],n,MPI_CHAR,0,world);
   }
@@ -1297,6 +1300,7 @@ void Modify::restart_deallocate()
     delete [] id_restart_global;
     delete [] style_restart_global;
     delete [] state_restart_global;
+    delete [] size_restart_global;
   }
 
   if (nfix_restart_peratom) {
@@ -1469,13 +1473,13 @@ void Modify::call_method_on_fixes(FixMethod method) {
    calls a member method on all fixes in the specified list
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum) {
+void Modify::call_method_on_fixes(FixMethod method, int *& ilist, int & inum, int hook) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)();
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(hook);
     }
   }
   else
@@ -1511,13 +1515,13 @@ void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag) {
    specified list
 ------------------------------------------------------------------------- */
 
-void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum) {
+void Modify::call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int hook) {
   if(timing) {
     for (int i = 0; i < inum; i++) {
       const int ifix = ilist[i];
       fix[ifix]->begin_time_recording();
       (fix[ifix]->*method)(vflag);
-      fix[ifix]->end_time_recording();
+      fix[ifix]->end_time_recording(hook);
     }
   }
   else
@@ -1588,7 +1592,9 @@ void Modify::update_computes_on_run_end()
             {
                 if (!(compute[i]->invoked_flag & INVOKED_SCALAR))
                 {
+                  compute[i]->begin_time_recording();
                   compute[i]->compute_scalar();
+                  compute[i]->end_time_recording();
                   compute[i]->invoked_flag |= INVOKED_SCALAR;
                 }
             }
@@ -1596,7 +1602,9 @@ void Modify::update_computes_on_run_end()
             {
                 if (!(compute[i]->invoked_flag & INVOKED_VECTOR))
                 {
+                  compute[i]->begin_time_recording();
                   compute[i]->compute_vector();
+                  compute[i]->end_time_recording();
                   compute[i]->invoked_flag |= INVOKED_VECTOR;
                 }
             }
@@ -1604,7 +1612,9 @@ void Modify::update_computes_on_run_end()
             {
                 if (!(compute[i]->invoked_flag & INVOKED_ARRAY))
                 {
+                  compute[i]->begin_time_recording();
                   compute[i]->compute_array();
+                  compute[i]->end_time_recording();
                   compute[i]->invoked_flag |= INVOKED_ARRAY;
                 }
             }
@@ -177,6 +177,7 @@ class Modify : protected Pointers {
 
   int fix_restart_in_progress();
   bool have_restart_data(Fix *f);
+  int restart_data_size_global(Fix *f);
   bool have_restart_data_style(const char* _style);
   int n_restart_data_global_style(const char* _style);
   char* id_restart_data_global_style(const char* _style,int _rank);
@@ -211,6 +212,7 @@ class Modify : protected Pointers {
   char **id_restart_global;           // stored fix global info
   char **style_restart_global;        // from read-in restart file
   char **state_restart_global;
+  int *size_restart_global;           // bytes of state data
 
   char **id_restart_peratom;          // stored fix peratom info
   char **style_restart_peratom;       // from read-in restart file
@@ -226,9 +228,9 @@ class Modify : protected Pointers {
 
 private:
   inline void call_method_on_fixes(FixMethod method);
-  inline void call_method_on_fixes(FixMethod method, int *& ilist, int & inum);
+  inline void call_method_on_fixes(FixMethod method, int *& ilist, int & inum, int hook = TIME_FIX_OTHER);
   inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag);
-  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum);
+  inline void call_method_on_fixes(FixMethodWithVFlag method, int vflag, int *& ilist, int & inum, int hook = TIME_FIX_OTHER);
 
   inline void call_respa_method_on_fixes(FixMethodRESPA2 method, int arg1, int arg2, int *& ilist, int & inum);
   inline void call_respa_method_on_fixes(FixMethodRESPA3 method, int arg1, int arg2, int arg3, int *& ilist, int & inum);
@@ -446,6 +446,24 @@ bool Modify::have_restart_data(Fix *f)
   return false;
 }
 
+/* ----------------------------------------------------------------------
+   size in bytes of global restart data passed to restart() of this fix
+   returns 0 if no global restart data available
+------------------------------------------------------------------------- */
+
+int Modify::restart_data_size_global(Fix *f)
+{
+  for (int i = 0; i < nfix_restart_global; i++)
+    if (strcmp(id_restart_global[i],f->id) == 0 &&
+          (strcmp(style_restart_global[i],f->style) == 0 ||
+            (f->accepts_restart_data_from_style && strcmp(style_restart_global[i],f->accepts_restart_data_from_style) == 0)
+          )
+       )
+      return size_restart_global[i];
+
+  return 0;
+}
+
 bool Modify::have_restart_data_style(const char* _style)
 {
   
@@ -65,6 +65,7 @@ namespace LAMMPS_NS
   {
       friend class FixMoveMesh;
       friend class MeshMover;
+      friend class FixSnapshot;
 
       public:
 
@@ -72,12 +73,18 @@ namespace LAMMPS_NS
 
         void setPrecision(double _precision);
 
+        inline double precision()
+        { return precision_; }
+
         void setMinFeatureLength(double _min_feature_length);
 
         void setElementExclusionList(FILE *_file);
 
         void autoRemoveDuplicates();
 
+        // duplicates already removed by mesh reader, skip check in addElement()
+        void setImportRemovedDuplicates(bool _removed);
+
         // scale mesh
         virtual void scale(double factor);
 
@@ -243,9 +250,6 @@ namespace LAMMPS_NS
         
         virtual bool resetToOrig();
 
-        inline double precision()
-        { return precision_; }
-
         inline double minFeatureLength()
         { return min_feature_length_; }
 
@@ -264,6 +268,7 @@ namespace LAMMPS_NS
 
         // state if elements should be automatically removed if duplicate
         bool autoRemoveDuplicates_;
+        bool importRemovedDuplicates_;
 
         // flags stating how many move operations are performed on the mesh
         int nMove_;
@@ -64,6 +64,7 @@
     min_feature_length_(-1.),
     element_exclusion_list_(0),
     autoRemoveDuplicates_(false),
+    importRemovedDuplicates_(false),
     nMove_(0),
     nScale_(0),
     nTranslate_(0),
@@ -130,6 +131,12 @@
       autoRemoveDuplicates_ = true;
   }
 
+  template<int NUM_NODES>
+  void MultiNodeMesh<NUM_NODES>::setImportRemovedDuplicates(bool _removed)
+  {
+      importRemovedDuplicates_ = _removed;
+  }
+
   /* ----------------------------------------------------------------------
    add an element - only called at mesh construction
    i.e. only used to construct local elements
@@ -170,7 +177,7 @@
     }
     rBound_.add(rb);
 
-    if(autoRemoveDuplicates_)
+    if(autoRemoveDuplicates_ && !importRemovedDuplicates_)
     {
         for(int i = 0; i < n; i++)
         {
@@ -130,7 +130,7 @@ namespace LAMMPS_NS
         virtual int pushElemListToBuffer(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> * properties, double *dlo, double *dhi, bool scale,bool translate, bool rotate);
         virtual int popElemListFromBuffer(int first, int n, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate);
         virtual int pushElemListToBufferReverse(int first, int n, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate);
-        virtual int popElemListFromBufferReverse(int n, int *list, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate);
+        virtual int popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> * properties, double *dlo, double *dhi, bool scale,bool translate, bool rotate);
 
         virtual int elemBufSize(int operation, std::list<std::string> * properties, bool scale,bool translate,bool rotate);
         virtual int pushElemToBuffer(int i, double *buf,int operation,bool scale,bool translate,bool rotate);
@@ -157,6 +157,11 @@ namespace LAMMPS_NS
         int checkBorderElement (const int, const int, const int, const double, const double) const;
         int checkBorderElementLeft (const int, const int, const double, const double) const;
         int checkBorderElementRight(const int, const int, const double, const double) const;
+        int checkBorderElementWedge(const int, const int) const;
+
+        // wrap data handed to the containers for each swap
+        inline double* wrapLo(const int iswap);
+        inline double* wrapHi(const int iswap);
 
         // lo-level parallelization
         int pushExchange(int dim);
@@ -223,6 +228,12 @@ namespace LAMMPS_NS
 
         int *pbc_flag_;              // general flag for sending atoms thru PBC
         int **pbc_;                  // dimension flags for PBC adjustments
+
+        // domain wedge: ghosts across the periodic faces are rotated copies
+        // wedge_lo_ = point on wedge axis, wedge_hi_ = cos, sin of wedge angle
+        // and first in-plane dim, see IS_GHOST_WRAP_ROT_* in container_base.h
+        class DomainWedge *domain_wedge_;
+        double wedge_lo_[3], wedge_hi_[3];
   };
 
   // *************************************
@@ -77,7 +77,8 @@
     sendwraplist_(0),
     maxsendlist_(0),
     pbc_flag_(0),
-    pbc_(0)
+    pbc_(0),
+    domain_wedge_(0)
   {
       // initialize comm buffers & exchange memory
       
@@ -380,6 +381,31 @@
        // maxneed_ summed accross all processors
        MPI_Max_Vector(maxneed_,3,this->world);
 
+       // wedge domain: one swap pair across the periodic faces,
+       // elements are selected by their distance to the faces
+
+       domain_wedge_ = dynamic_cast<DomainWedge*>(this->domain);
+       if(domain_wedge_)
+       {
+           if(this->isMoving())
+               this->error->all(FLERR,"Moving meshes are not supported with '-domain wedge', "
+                                      "use the surface_vel or surface_ang_vel option of fix mesh/surface instead");
+
+           const int iphi = domain_wedge_->index_phi();
+           double c[2];
+           domain_wedge_->center(c);
+
+           maxneed_[iphi] = 1;
+           sendneed_[iphi][0] = sendneed_[iphi][1] = 1;
+
+           vectorZeroize3D(wedge_lo_);
+           wedge_lo_[iphi] = c[0];
+           wedge_lo_[(iphi+1)%3] = c[1];
+           wedge_hi_[0] = cos(domain_wedge_->angle());
+           wedge_hi_[1] = sin(domain_wedge_->angle());
+           wedge_hi_[2] = static_cast<double>(iphi);
+       }
+
        destroy(sublo_all);
        destroy(subhi_all);
 
@@ -658,7 +684,9 @@
       // perform operations that should be done before setting up parallellism and exchanging elements
       preSetup();
 
-      if(!setupFlag && !this->isMoving() && !this->isDeforming() && !this->domain->box_change) return;
+      // the neighbor cutoff may change during a run (fix adapt/skin)
+      if(!setupFlag && !this->isMoving() && !this->isDeforming() && !this->domain->box_change &&
+         (!doParallellization_ || half_atom_cut_ == this->neighbor->cutneighmax / 2.)) return;
 
       // set-up mesh parallelism
       setup();
@@ -889,10 +917,16 @@
                   
                   sendflag = true;
                   int wrap = 0;
+
+                  // wrap = +/-1 translates across periodic boundaries,
+                  // wrap = +/-2 rotates across the periodic faces of a wedge
+                  const bool wedge_phi = domain_wedge_ && dim == domain_wedge_->index_phi();
                   
                   if(ineed % 2 == 0 && this->comm->myloc[dim] == 0)
                   {
-                      if(this->domain->periodicity[dim] && !this->domain->triclinic && !dynamic_cast<DomainWedge*>(this->domain))
+                      if(wedge_phi)
+                          wrap = 2;
+                      else if(this->domain->periodicity[dim] && !this->domain->triclinic)
                           wrap = 1;
                       else
                           sendflag = false;
@@ -900,7 +934,9 @@
 
                   if(ineed % 2 == 1 && this->comm->myloc[dim] == this->comm->procgrid[dim]-1)
                   {
-                      if(this->domain->periodicity[dim] && !this->domain->triclinic && !dynamic_cast<DomainWedge*>(this->domain))
+                      if(wedge_phi)
+                          wrap = -2;
+                      else if(this->domain->periodicity[dim] && !this->domain->triclinic)
                           wrap = -1;
                       else
                           sendflag = false;
@@ -912,13 +948,17 @@
                       
                       for (int i = nfirst; i < nlast; i++)
                       {
-                          int type = checkBorderElement(ineed, i, dim, lo, hi);
+                          int type = wedge_phi ? checkBorderElementWedge(ineed, i) : checkBorderElement(ineed, i, dim, lo, hi);
                           if(type != NOT_GHOST)
                           {
                               if (nsend >= maxsendlist_[iswap])
                                   grow_list(iswap,nsend);
                               sendlist_[iswap][nsend] = i;
-                              if (wrap == 1)
+                              if (wrap == 2)
+                                  type = IS_GHOST_WRAP_ROT_POS;
+                              else if (wrap == -2)
+                                  type = IS_GHOST_WRAP_ROT_NEG;
+                              else if (wrap == 1)
                               {
                                   switch (dim)
                                   {
@@ -960,7 +1000,7 @@
                   if(nsend*size_border_ > maxsend_)
                     grow_send(nsend*size_border_,0);
 
-                  n = pushElemListToBuffer(nsend, sendlist_[iswap], sendwraplist_[iswap], buf_send_, OPERATION_COMM_BORDERS, NULL, this->domain->boxlo, this->domain->boxhi,dummy,dummy,dummy);
+                  n = pushElemListToBuffer(nsend, sendlist_[iswap], sendwraplist_[iswap], buf_send_, OPERATION_COMM_BORDERS, NULL, wrapLo(iswap), wrapHi(iswap),dummy,dummy,dummy);
 
                   // swap atoms with other proc
                   // no MPI calls except SendRecv if nsend/nrecv = 0
@@ -1062,6 +1102,44 @@
       return NOT_GHOST;
   }
 
+  /* ----------------------------------------------------------------------
+   wedge domain: element is ghost if its center is close to the face that
+   is mapped onto the other face by this swap
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  inline int MultiNodeMeshParallel<NUM_NODES>::checkBorderElementWedge(const int ineed, const int i) const
+  {
+      const double *center = this->center_(i);
+      const double dist = (ineed % 2 == 0) ? -domain_wedge_->dist_face1(center) : -domain_wedge_->dist_face2(center);
+
+      if (dist <= half_atom_cut_ + this->rBound_(i))
+        return IS_GHOST;
+
+      return NOT_GHOST;
+  }
+
+  /* ----------------------------------------------------------------------
+   data passed to the containers to wrap ghost elements of a swap
+   box bounds for periodic boundaries, rotation for wedge faces
+  ------------------------------------------------------------------------- */
+
+  template<int NUM_NODES>
+  inline double* MultiNodeMeshParallel<NUM_NODES>::wrapLo(const int iswap)
+  {
+      if (domain_wedge_ && pbc_[iswap][domain_wedge_->index_phi()])
+          return wedge_lo_;
+      return this->domain->boxlo;
+  }
+
+  template<int NUM_NODES>
+  inline double* MultiNodeMeshParallel<NUM_NODES>::wrapHi(const int iswap)
+  {
+      if (domain_wedge_ && pbc_[iswap][domain_wedge_->index_phi()])
+          return wedge_hi_;
+      return this->domain->boxhi;
+  }
+
   /* ----------------------------------------------------------------------
    communicate properties to ghost elements
   ------------------------------------------------------------------------- */
@@ -1112,7 +1190,7 @@
                     MPI_Irecv(buf_recv_, nrecv, MPI_DOUBLE,recvproc_[iswap],0,this->world,&request);
                 }
 
-                n = pushElemListToBuffer(sendnum_[iswap],sendlist_[iswap], sendwraplist_[iswap],buf_send_,OPERATION_COMM_FORWARD, properties, this->domain->boxlo, this->domain->boxhi,scale,translate,rotate);
+                n = pushElemListToBuffer(sendnum_[iswap],sendlist_[iswap], sendwraplist_[iswap],buf_send_,OPERATION_COMM_FORWARD, properties, wrapLo(iswap), wrapHi(iswap),scale,translate,rotate);
                 
                 if (n)
                     MPI_Send(buf_send_,n,MPI_DOUBLE,sendproc_[iswap],0,this->world);
@@ -1125,7 +1203,7 @@
           }
           else
           {
-              n = pushElemListToBuffer(sendnum_[iswap], sendlist_[iswap], sendwraplist_[iswap], buf_send_, OPERATION_COMM_FORWARD, properties, this->domain->boxlo, this->domain->boxhi, scale, translate, rotate);
+              n = pushElemListToBuffer(sendnum_[iswap], sendlist_[iswap], sendwraplist_[iswap], buf_send_, OPERATION_COMM_FORWARD, properties, wrapLo(iswap), wrapHi(iswap), scale, translate, rotate);
 
               // note buf_recv_ not used in this case (just use buf_send_ as receive buffer
               n = popElemListFromBuffer(firstrecv_[iswap], recvnum_[iswap], buf_send_, OPERATION_COMM_FORWARD, properties, scale, translate, rotate);
@@ -1186,13 +1264,13 @@
               if (size_reverse_recv_[iswap] && size_this)
                   MPI_Wait(&request,&status);
 
-              n = popElemListFromBufferReverse(sendnum_[iswap], sendlist_[iswap], buf_recv_, OPERATION_COMM_REVERSE, properties, scale, translate, rotate);
+              n = popElemListFromBufferReverse(sendnum_[iswap], sendlist_[iswap], sendwraplist_[iswap], buf_recv_, OPERATION_COMM_REVERSE, properties, wrapLo(iswap), wrapHi(iswap), scale, translate, rotate);
           }
           else
           {
               n = pushElemListToBufferReverse(firstrecv_[iswap], recvnum_[iswap], buf_send_, OPERATION_COMM_REVERSE, properties, scale, translate, rotate);
               // note buf_recv_ not used in this case (just use buf_send_ as receive buffer
-              n = popElemListFromBufferReverse(sendnum_[iswap], sendlist_[iswap], buf_send_, OPERATION_COMM_REVERSE, properties, scale, translate, rotate);
+              n = popElemListFromBufferReverse(sendnum_[iswap], sendlist_[iswap], sendwraplist_[iswap], buf_send_, OPERATION_COMM_REVERSE, properties, wrapLo(iswap), wrapHi(iswap), scale, translate, rotate);
           }
       }
   }
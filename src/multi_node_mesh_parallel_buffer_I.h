@@ -367,7 +367,7 @@
   ------------------------------------------------------------------------- */
 
   template<int NUM_NODES>
-  int MultiNodeMeshParallel<NUM_NODES>::popElemListFromBufferReverse(int, int*, double*, int operation, std::list<std::string> * properties, bool, bool, bool)
+  int MultiNodeMeshParallel<NUM_NODES>::popElemListFromBufferReverse(int, int*, int*, double*, int operation, std::list<std::string> * properties, double*, double*, bool, bool, bool)
   {
       int nrecv = 0;
 
@@ -126,6 +126,8 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   binsizeflag = 0;
   build_once = 0;
   cluster_check = 0;
+  localflag = 0;
+  localize = 0;
 
   cutneighmax = 0;
   cutneighsq = NULL;
@@ -140,6 +142,15 @@ Neighbor::Neighbor(LAMMPS *lmp) : Pointers(lmp)
   xhold = NULL;
   rhold = NULL; 
 
+  // coords and IDs at last build of the lists of this proc
+
+  maxhold_local = 0;
+  xhold_local = NULL;
+  taghold = NULL;
+  nlocal_hold = nghost_hold = -1;
+  skin_hold = 0.0;
+  nkeep = 0;
+
   // binning
 
   maxhead = 0;
@@ -213,6 +224,8 @@ Neighbor::~Neighbor()
 
   memory->destroy(xhold);
   memory->destroy(rhold); 
+  memory->destroy(xhold_local);
+  memory->destroy(taghold);
 
   memory->destroy(binhead);
   memory->destroy(bins);
@@ -283,14 +296,6 @@ void Neighbor::init()
     bboxhi = domain->boxhi_bound;
   }
 
-  // set neighbor cutoffs (force cutoff + skin)
-  // trigger determines when atoms migrate and neighbor lists are rebuilt
-  //   needs to be non-zero for migration distance check
-  //   even if pair = NULL and no neighbor lists are used
-  // cutneigh = force cutoff + skin if cutforce > 0, else cutneigh = 0
-  // cutneighghost = pair cutghost if it requests it, else same as cutneigh
-
-  triggersq = 0.25*skin*skin;
   boxcheck = 0;
   if (domain->box_change && (domain->xperiodic || domain->yperiodic ||
                              (dimension == 3 && domain->zperiodic)))
@@ -304,38 +309,7 @@ void Neighbor::init()
     cuttypesq = new double[n+1];
   }
 
-  double cutoff,delta,cut;
-  cutneighmin = BIG;
-  cutneighmax = 0.0;
-
-  for (i = 1; i <= n; i++) {
-    cuttype[i] = cuttypesq[i] = 0.0;
-    for (j = 1; j <= n; j++) {
-      if (force->pair) cutoff = sqrt(force->pair->cutsq[i][j]);
-      else cutoff = 0.0;
-      if (cutoff > 0.0) delta = skin;
-      else delta = 0.0;
-      cut = cutoff + delta;
-
-      cutneighsq[i][j] = cut*cut;
-      cuttype[i] = MAX(cuttype[i],cut);
-      cuttypesq[i] = MAX(cuttypesq[i],cut*cut);
-      cutneighmin = MIN(cutneighmin,cut);
-      cutneighmax = MAX(cutneighmax,cut);
-
-      if (force->pair && force->pair->ghostneigh) {
-        cut = force->pair->cutghost[i][j] + skin;
-        cutneighghostsq[i][j] = cut*cut;
-      } else cutneighghostsq[i][j] = cut*cut;
-    }
-  }
-  cutneighmaxsq = cutneighmax * cutneighmax;
-
-  if(atom->radius_flag) {
-    double maxrd,minrd;
-    modify->max_min_rad(maxrd,minrd);
-    cutneighmin = MIN(cutneighmin,2*minrd+skin);
-  }
+  set_cutneigh();
 
   // check other classes that can induce reneighboring in decide()
   // don't check if build_once is set
@@ -435,6 +409,31 @@ void Neighbor::init()
     }
   }
 
+  // localized builds keep the lists of a proc whose owned and ghost atoms
+  // did not move, check_distance() needs current ghost coords for that,
+  // which Verlet communicates before decide()
+  // lists stored with a changing box, radii or topology are not kept
+
+  localize = 0;
+  nkeep = 0;
+  if (localflag) {
+    if (dist_check && !build_once && !boxcheck && !includegroup &&
+        !atom->molecular && !atom->radvary_flag && atom->tag_enable &&
+        update->whichflag == 1 &&
+        strcmp(update->integrate_style,"verlet") == 0)
+      localize = 1;
+    else if (me == 0)
+      error->warning(FLERR,"Neighbor localize setting is ignored for this run");
+  }
+  if (!localize) {
+    memory->destroy(xhold_local);
+    memory->destroy(taghold);
+    maxhold_local = 0;
+    xhold_local = NULL;
+    taghold = NULL;
+    nlocal_hold = nghost_hold = -1;
+  }
+
   if (style != NSQ) {
     if (maxbin == 0) {
       maxbin = atom->nmax;
@@ -1454,6 +1453,27 @@ int Neighbor::check_distance()
       
   }
 
+  // localized builds: the lists of this proc may be older than the last
+  // build, so also check owned and ghost atoms against their coords when
+  // the lists were built, a changed # of atoms also requires a build
+
+  if (localize && nlocal_hold >= 0 && flag == 0) {
+    if (atom->nlocal != nlocal_hold || atom->nghost != nghost_hold) flag = 1;
+    else {
+      int nall = atom->nlocal + atom->nghost;
+      for (int i = 0; i < nall; i++) {
+        delx = x[i][0] - xhold_local[i][0];
+        dely = x[i][1] - xhold_local[i][1];
+        delz = x[i][2] - xhold_local[i][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+        if (rsq > triggersq) {
+          flag = 1;
+          break;
+        }
+      }
+    }
+  }
+
   int flagall;
   MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
   if (flagall && ago == MAX(every,delay)) ndanger++;
@@ -1552,6 +1572,17 @@ void Neighbor::build(int topoflag)
   if (atom->nlocal+atom->nghost > NEIGHMASK)
     error->one(FLERR,"Too many local+ghost atoms for neighbor list");
 
+  // localized builds: keep the lists of this proc if still valid
+  // exchange and borders were done on all procs nevertheless
+  // atoms are binned anyway, mesh and wall neighbor lists
+  // are built from bins and binhead after this
+
+  if (localize && keep_lists()) {
+    nkeep++;
+    if (style != NSQ) bin_atoms();
+    return;
+  }
+
   // invoke building of pair and molecular neighbor lists
   // only for pairwise lists with buildflag set
 
@@ -1559,6 +1590,71 @@ void Neighbor::build(int topoflag)
     (this->*pair_build[blist[i]])(lists[blist[i]]);
 
   if (atom->molecular && topoflag) build_topology();
+
+  if (localize) store_hold_local();
+  else nlocal_hold = nghost_hold = -1;
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if the pairwise lists of this proc are still valid
+   requires the same owned and ghost atoms in the same order as at the
+     last build of the lists, none of them moved the trigger distance
+     since then and the skin did not change
+   lists are always built during setup of a run
+------------------------------------------------------------------------- */
+
+int Neighbor::keep_lists()
+{
+  if (nlocal_hold < 0 || update->setupflag || skin != skin_hold) return 0;
+
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+  if (nlocal != nlocal_hold || nall != nlocal_hold + nghost_hold) return 0;
+
+  double **x = atom->x;
+  int *tag = atom->tag;
+  double delx,dely,delz;
+
+  for (int i = 0; i < nall; i++) {
+    if (tag[i] != taghold[i]) return 0;
+    delx = x[i][0] - xhold_local[i][0];
+    dely = x[i][1] - xhold_local[i][1];
+    delz = x[i][2] - xhold_local[i][2];
+    if (delx*delx + dely*dely + delz*delz > triggersq) return 0;
+  }
+
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   store coords and IDs of owned and ghost atoms after a build of the lists
+------------------------------------------------------------------------- */
+
+void Neighbor::store_hold_local()
+{
+  double **x = atom->x;
+  int *tag = atom->tag;
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  if (nall > maxhold_local) {
+    maxhold_local = atom->nmax;
+    memory->destroy(xhold_local);
+    memory->destroy(taghold);
+    memory->create(xhold_local,maxhold_local,3,"neigh:xhold_local");
+    memory->create(taghold,maxhold_local,"neigh:taghold");
+  }
+
+  for (int i = 0; i < nall; i++) {
+    xhold_local[i][0] = x[i][0];
+    xhold_local[i][1] = x[i][1];
+    xhold_local[i][2] = x[i][2];
+    taghold[i] = tag[i];
+  }
+
+  nlocal_hold = nlocal;
+  nghost_hold = nall - nlocal;
+  skin_hold = skin;
 }
 
 /* ----------------------------------------------------------------------
@@ -1852,6 +1948,73 @@ double Neighbor::bin_largest_distance(int i, int j, int k)
   return (delx*delx + dely*dely + delz*delz);
 }
 
+/* ----------------------------------------------------------------------
+   set neighbor cutoffs (force cutoff + skin)
+   trigger determines when atoms migrate and neighbor lists are rebuilt
+     needs to be non-zero for migration distance check
+     even if pair = NULL and no neighbor lists are used
+   cutneigh = force cutoff + skin if cutforce > 0, else cutneigh = 0
+   cutneighghost = pair cutghost if it requests it, else same as cutneigh
+------------------------------------------------------------------------- */
+
+void Neighbor::set_cutneigh()
+{
+  int i,j;
+  int n = atom->ntypes;
+
+  triggersq = 0.25*skin*skin;
+
+  double cutoff,delta,cut;
+  cutneighmin = BIG;
+  cutneighmax = 0.0;
+
+  for (i = 1; i <= n; i++) {
+    cuttype[i] = cuttypesq[i] = 0.0;
+    for (j = 1; j <= n; j++) {
+      if (force->pair) cutoff = sqrt(force->pair->cutsq[i][j]);
+      else cutoff = 0.0;
+      if (cutoff > 0.0) delta = skin;
+      else delta = 0.0;
+      cut = cutoff + delta;
+
+      cutneighsq[i][j] = cut*cut;
+      cuttype[i] = MAX(cuttype[i],cut);
+      cuttypesq[i] = MAX(cuttypesq[i],cut*cut);
+      cutneighmin = MIN(cutneighmin,cut);
+      cutneighmax = MAX(cutneighmax,cut);
+
+      if (force->pair && force->pair->ghostneigh) {
+        cut = force->pair->cutghost[i][j] + skin;
+        cutneighghostsq[i][j] = cut*cut;
+      } else cutneighghostsq[i][j] = cut*cut;
+    }
+  }
+  cutneighmaxsq = cutneighmax * cutneighmax;
+
+  if(atom->radius_flag) {
+    double maxrd,minrd;
+    modify->max_min_rad(maxrd,minrd);
+    cutneighmin = MIN(cutneighmin,2*minrd+skin);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   change skin distance during a run, only valid on reneighboring steps
+   before the lists are built, caller must update comm and bins
+   a user-chosen bin size is scaled with the neighbor cutoff
+------------------------------------------------------------------------- */
+
+void Neighbor::reset_skin(double newskin)
+{
+  double cutneighmax_old = cutneighmax;
+
+  skin = newskin;
+  set_cutneigh();
+
+  if (binsizeflag && cutneighmax_old > 0.0)
+    binsize_user *= cutneighmax/cutneighmax_old;
+}
+
 /* ----------------------------------------------------------------------
    set neighbor style and skin distance
 ------------------------------------------------------------------------- */
@@ -1931,6 +2094,12 @@ void Neighbor::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) build_once = 0;
       else error->all(FLERR,"Illegal neigh_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"localize") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) localflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) localflag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"page") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       old_pgsize = pgsize;
@@ -2189,7 +2358,9 @@ bigint Neighbor::memory_usage()
 {
   bigint bytes = 0;
   bytes += memory->usage(xhold,maxhold,3);
-  bytes += memory->usage(rhold,maxhold); 
+  bytes += memory->usage(rhold,maxhold);
+  bytes += memory->usage(xhold_local,maxhold_local,3);
+  bytes += memory->usage(taghold,maxhold_local);
 
   if (style != NSQ) {
     bytes += memory->usage(bins,maxbin);
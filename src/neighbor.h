@@ -62,6 +62,9 @@ class Neighbor : protected Pointers {
   
   friend class FixNeighlistMesh;
   friend class OneLevelGrid;
+  friend class PrimitiveWall;
+  friend class FixWallRegion;
+  friend class FixAdaptSkin;
   
   friend class FixHeatGranRad;
   friend class FixLiquidTrackingInstant;
@@ -77,6 +80,7 @@ class Neighbor : protected Pointers {
   int oneatom;                     // max # of neighbors for one atom
   int includegroup;                // only build pairwise lists for this group
   int build_once;                  // 1 if only build lists once per run
+  int localize;                    // 1 if procs keep lists of unmoved atoms
   int cudable;                     // GPU <-> CPU communication flag for CUDA
 
   double skin;                     // skin distance
@@ -87,6 +91,7 @@ class Neighbor : protected Pointers {
 
   bigint ncalls;                   // # of times build has been called
   bigint ndanger;                  // # of dangerous builds
+  bigint nkeep;                    // # of builds this proc kept its lists
   bigint lastcall;                 // timestep of last neighbor::build() call
 
   bigint last_setup_bins_timestep;
@@ -123,6 +128,7 @@ class Neighbor : protected Pointers {
   int decide();                                 // decide whether to build or not
   virtual int check_distance();                 // check max distance moved since last build
   void setup_bins();                            // setup bins based on box and cutoff
+  void reset_skin(double);                      // change skin during a run
   virtual void build(int topoflag=1);           // create all neighbor lists (pair,bond)
   virtual void build_topology();                // create all topology neighbor lists
   void build_one(int);                          // create a single neighbor list
@@ -169,6 +175,14 @@ class Neighbor : protected Pointers {
   double boxlo_hold[3],boxhi_hold[3];  // box size at last neighbor build
   double corners_hold[8][3];           // box corners at last neighbor build
 
+  int localflag;                       // 1 if user requested localize
+  double **xhold_local;                // own+ghost coords at last list build
+  int *taghold;                        // own+ghost IDs at last list build
+  int maxhold_local;                   // size of xhold_local, taghold
+  int nlocal_hold,nghost_hold;         // # of own/ghost atoms at last build
+                                       // nlocal_hold = -1 if not stored
+  double skin_hold;                    // skin at last list build
+
   int nbinx,nbiny,nbinz;           // # of global bins
   int *bins;                       // ptr to next atom in each bin
   int maxbin;                      // size of bins array
@@ -228,6 +242,9 @@ class Neighbor : protected Pointers {
   int *glist;                  // lists to grow atom arrays every reneigh
   int *slist;                  // lists to grow stencil arrays every reneigh
 
+  void set_cutneigh();                  // set cutoffs and trigger from skin
+  int keep_lists();                     // 1 if lists of this proc are valid
+  void store_hold_local();              // store atoms at last list build
   void bin_atoms();                     // bin all atoms
   double bin_distance(int, int, int);   // distance between binx
   double bin_largest_distance(int, int, int); 
@@ -479,4 +496,10 @@ E: Neigh_modify exclude molecule requires atom attribute molecule
 
 Self-explanatory.
 
+W: Neighbor localize setting is ignored for this run
+
+Localized builds require neigh_modify check yes, run_style verlet,
+atoms without bonds and varying radii and a box that does not change.
+All lists are built at every rebuild instead.
+
 */
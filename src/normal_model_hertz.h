@@ -64,9 +64,10 @@ namespace ContactModels
   public:
     NormalModel(LAMMPS * lmp, IContactHistorySetup* hsetup, class ContactModelBase *c) :
       NormalModelBase(lmp, hsetup, c),
-      Yeff(NULL),
-      Geff(NULL),
-      betaeff(NULL),
+      knCoeff(NULL),
+      ktCoeff(NULL),
+      gammanCoeff(NULL),
+      gammatCoeff(NULL),
       limitForce(false),
       displayedSettings(false),
       heating(false),
@@ -149,15 +150,35 @@ namespace ContactModels
       registry.registerProperty("Geff", &MODEL_PARAMS::createGeff,"model hertz");
       registry.registerProperty("betaeff", &MODEL_PARAMS::createBetaEff,"model hertz");
 
-      registry.connect("Yeff", Yeff,"model hertz");
-      registry.connect("Geff", Geff,"model hertz");
-      registry.connect("betaeff", betaeff,"model hertz");
+      // per-type-pair prefactors of kn, kt, gamman, gammat
+
+      registry.registerProperty("hertzKnCoefficient", &MODEL_PARAMS::createHertzKnCoefficient,"model hertz");
+      registry.registerProperty("hertzKtCoefficient", &MODEL_PARAMS::createHertzKtCoefficient,"model hertz");
+      registry.registerProperty("hertzGammanCoefficient", &MODEL_PARAMS::createHertzGammanCoefficient,"model hertz");
+      registry.registerProperty("hertzGammatCoefficient", &MODEL_PARAMS::createHertzGammatCoefficient,"model hertz");
+
+      registry.connect("hertzKnCoefficient", knCoeff,"model hertz");
+      registry.connect("hertzKtCoefficient", ktCoeff,"model hertz");
+      registry.connect("hertzGammanCoefficient", gammanCoeff,"model hertz");
+      registry.connect("hertzGammatCoefficient", gammatCoeff,"model hertz");
 
       // enlarge contact distance flag in case of elastic energy computation
       // to ensure that surfaceClose is called after a contact
       if (elasticpotflag_)
           //set neighbor contact_distance_factor here
           neighbor->register_contact_dist_factor(1.01);
+
+      // settings are displayed here since surfacesIntersect may be
+      // called by several threads, see FixWallGran::post_force_mesh_omp
+      if(!displayedSettings)
+      {
+        displayedSettings = true;
+
+        /*
+        if(limitForce)
+            if(0 == comm->me) fprintf(screen," NormalModel<HERTZ_STIFFNESS>: will limit normal force.\n");
+        */
+      }
     }
 
     // effective exponent for stress-strain relationship
@@ -228,24 +249,14 @@ namespace ContactModels
         sidata.contact_history[overlap_offset_] = sidata.deltan;
       const double deltan = disable_when_bonded_ ? fmax(sidata.deltan-sidata.contact_history[overlap_offset_], 0.0) : sidata.deltan;
 
-      const double Sn=2.*Yeff[itype][jtype]*sqrtval;
-      const double St=8.*Geff[itype][jtype]*sqrtval;
+      // type-only factors are tabulated, see MODEL_PARAMS::createHertz*Coefficient
+      const double sqrtvalMeff = sqrt(sqrtval*meff);
 
-      double kn=4./3.*Yeff[itype][jtype]*sqrtval;
-      double kt=St;
-      const double sqrtFiveOverSix = 0.91287092917527685576161630466800355658790782499663875;
-      const double gamman=-2.*sqrtFiveOverSix*betaeff[itype][jtype]*sqrt(Sn*meff);
-      const double gammat= tangential_damping ? -2.*sqrtFiveOverSix*betaeff[itype][jtype]*sqrt(St*meff) : 0.0;
+      double kn=knCoeff[itype][jtype]*sqrtval;
+      double kt=ktCoeff[itype][jtype]*sqrtval;
+      const double gamman=gammanCoeff[itype][jtype]*sqrtvalMeff;
+      const double gammat= tangential_damping ? gammatCoeff[itype][jtype]*sqrtvalMeff : 0.0;
       
-      if(!displayedSettings)
-      {
-        displayedSettings = true;
-
-        /*
-        if(limitForce)
-            if(0 == comm->me) fprintf(screen," NormalModel<HERTZ_STIFFNESS>: will limit normal force.\n");
-        */
-      }
       // convert Kn and Kt from pressure units to force/distance^2
       kn /= force->nktv2p;
       kt /= force->nktv2p;
@@ -415,9 +426,10 @@ namespace ContactModels
     void endPass(SurfacesIntersectData&, ForceData&, ForceData&){}
 
   protected:
-    double ** Yeff;
-    double ** Geff;
-    double ** betaeff;
+    double ** knCoeff;
+    double ** ktCoeff;
+    double ** gammanCoeff;
+    double ** gammatCoeff;
 
     bool tangential_damping;
     bool limitForce;
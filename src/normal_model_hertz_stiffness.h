@@ -94,6 +94,18 @@ namespace ContactModels
       // error checks on coarsegraining
       if(force->cg_active())
         error->cg(FLERR,"model hertz/stiffness");
+
+      // settings are displayed here since surfacesIntersect may be
+      // called by several threads, see FixWallGran::post_force_mesh_omp
+      if(!displayedSettings)
+      {
+        displayedSettings = true;
+
+        /*
+        if(limitForce)
+            if(0 == comm->me) fprintf(screen," NormalModel<HERTZ_STIFFNESS>: will limit normal force.\n");
+        */
+      }
     }
 
     // effective exponent for stress-strain relationship
@@ -121,15 +133,6 @@ namespace ContactModels
       const double gamman = polyhertz*meff*gamma_n[itype][jtype];
       const double gammat = tangential_damping ? polyhertz*meff*gamma_t[itype][jtype] : 0.0;
 
-      if(!displayedSettings)
-      {
-        displayedSettings = true;
-
-        /*
-        if(limitForce)
-            if(0 == comm->me) fprintf(screen," NormalModel<HERTZ_STIFFNESS>: will limit normal force.\n");
-        */
-      }
       // convert Kn and Kt from pressure units to force/distance^2
       kn /= force->nktv2p;
       kt /= force->nktv2p;
@@ -71,6 +71,9 @@ namespace ContactModels
       coeffRestLog(NULL),
       coeffMu(NULL),
       coeffStc(NULL),
+      knCoeff(NULL),
+      dampingFactor(NULL),
+      coeffRestMaxLog(NULL),
       charVel(0.0),
       viscous(false),
       tangential_damping(false),
@@ -159,6 +162,11 @@ namespace ContactModels
       registry.connect("Geff", Geff,"model hooke");
       registry.connect("charVel", charVel,"model hooke");
 
+      // per-type-pair prefactor of kn, see MODEL_PARAMS::createHookeKnCoefficient
+
+      registry.registerProperty("hookeKnCoefficient", &MODEL_PARAMS::createHookeKnCoefficient);
+      registry.connect("hookeKnCoefficient", knCoeff,"model hooke");
+
       if(viscous) {
         registry.registerProperty("coeffMu", &MODEL_PARAMS::createCoeffMu);
         registry.registerProperty("coeffStc", &MODEL_PARAMS::createCoeffStc);
@@ -167,11 +175,17 @@ namespace ContactModels
         registry.connect("coeffMu", coeffMu,"model hooke viscous");
         registry.connect("coeffStc", coeffStc,"model hooke viscous");
         registry.connect("coeffRestMax", coeffRestMax,"model hooke viscous");
+
+        registry.registerProperty("coeffRestMaxLog", &MODEL_PARAMS::createCoeffRestMaxLog);
+        registry.connect("coeffRestMaxLog", coeffRestMaxLog,"model hooke viscous");
         //registry.connect("log(coeffRestMax)+coeffStc", logRestMaxPlusStc);
       } else {
         registry.registerProperty("coeffRestLog", &MODEL_PARAMS::createCoeffRestLog);
 
         registry.connect("coeffRestLog", coeffRestLog,"model hooke viscous");
+
+        registry.registerProperty("hookeDampingFactor", &MODEL_PARAMS::createHookeDampingFactor);
+        registry.connect("hookeDampingFactor", dampingFactor,"model hooke");
       }
 
       // error checks on coarsegraining
@@ -183,6 +197,23 @@ namespace ContactModels
       if (elasticpotflag_)
           //set neighbor contact_distance_factor here
           neighbor->register_contact_dist_factor(1.01);
+
+      // settings are displayed here since surfacesIntersect may be
+      // called by several threads, see FixWallGran::post_force_mesh_omp
+      if(!displayedSettings)
+      {
+        displayedSettings = true;
+        /*
+        if(ktToKn)
+            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will use user-modified ktToKn of 2/7.\n");
+        if(tangential_damping)
+            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will apply tangential damping.\n");
+        if(viscous)
+            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will apply damping based on Stokes number.\n");
+        if(limitForce)
+            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will limit normal force.\n");
+        */
+      }
     }
 
     // effective exponent for stress-strain relationship
@@ -239,39 +270,27 @@ namespace ContactModels
         reff = sidata.reff;
 #endif
       const double meff=sidata.meff;
-      double coeffRestLogChosen;
 
       const double sqrtval = sqrt(reff);
 
-      if(!displayedSettings)
-      {
-        displayedSettings = true;
-        /*
-        if(ktToKn)
-            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will use user-modified ktToKn of 2/7.\n");
-        if(tangential_damping)
-            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will apply tangential damping.\n");
-        if(viscous)
-            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will apply damping based on Stokes number.\n");
-        if(limitForce)
-            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE>: will limit normal force.\n");
-        */
-      }
+      // type-only factors are tabulated, see MODEL_PARAMS::createHookeKnCoefficient
+      double kn = knCoeff[itype][jtype]*sqrtval*pow(meff/sqrtval,0.2);
+      double kt = kn;
+      if(ktToKn) kt *= 0.285714286; //2//7
+
+      double gamman;
       if (viscous)  {
          // Stokes Number from MW Schmeeckle (2001)
          const double stokes=sidata.meff*sidata.vn/(6.0*M_PI*coeffMu[itype][jtype]*reff*reff);
          // Empirical from Legendre (2006)
-         coeffRestLogChosen=log(coeffRestMax[itype][jtype])+coeffStc[itype][jtype]/stokes;
+         const double coeffRestLogChosen=coeffRestMaxLog[itype][jtype]+coeffStc[itype][jtype]/stokes;
+         const double coeffRestLogChosenSq = coeffRestLogChosen*coeffRestLogChosen;
+         //const double gamman=sqrt(4.*meff*kn/(1.+(M_PI/coeffRestLogChosen)*(M_PI/coeffRestLogChosen)));
+         gamman=sqrt(4.*meff*kn*coeffRestLogChosenSq/(coeffRestLogChosenSq+M_PI*M_PI));
       } else {
-         coeffRestLogChosen=coeffRestLog[itype][jtype];
+         // dampingFactor = 4 log(e)^2 / (log(e)^2 + pi^2)
+         gamman=sqrt(meff*kn*dampingFactor[itype][jtype]);
       }
-
-      double kn = 16./15.*sqrtval*(Yeff[itype][jtype])*pow(15.*meff*charVel*charVel/(16.*sqrtval*Yeff[itype][jtype]),0.2);
-      double kt = kn;
-      if(ktToKn) kt *= 0.285714286; //2//7
-      const double coeffRestLogChosenSq = coeffRestLogChosen*coeffRestLogChosen;
-      //const double gamman=sqrt(4.*meff*kn/(1.+(M_PI/coeffRestLogChosen)*(M_PI/coeffRestLogChosen)));
-      const double gamman=sqrt(4.*meff*kn*coeffRestLogChosenSq/(coeffRestLogChosenSq+M_PI*M_PI));
       const double gammat = tangential_damping ? gamman : 0.0;
 
       // convert Kn and Kt from pressure units to force/distance^2
@@ -452,6 +471,9 @@ namespace ContactModels
     double ** coeffRestLog;
     double ** coeffMu;
     double ** coeffStc;
+    double ** knCoeff;
+    double ** dampingFactor;
+    double ** coeffRestMaxLog;
     double charVel;
 
     bool viscous;
@@ -104,8 +104,7 @@ namespace ContactModels
     {
       // use these values from HOOKE implementation
       bool & viscous = NormalModel<HOOKE>::viscous;
-      double ** & Yeff = NormalModel<HOOKE>::Yeff;
-      double & charVel = NormalModel<HOOKE>::charVel;
+      double ** & knCoeff = NormalModel<HOOKE>::knCoeff;
       bool & tangential_damping = NormalModel<HOOKE>::tangential_damping;
       Force * & force = NormalModel<HOOKE>::force;
 
@@ -124,19 +123,19 @@ namespace ContactModels
 
       if (viscous)  {
         double ** & coeffMu = NormalModel<HOOKE>::coeffMu;
-        double ** & coeffRestMax = NormalModel<HOOKE>::coeffRestMax;
         double ** & coeffStc = NormalModel<HOOKE>::coeffStc;
+        double ** & coeffRestMaxLog = NormalModel<HOOKE>::coeffRestMaxLog;
         // Stokes Number from MW Schmeeckle (2001)
         const double stokes=sidata.meff*sidata.vn/(6.0*M_PI*coeffMu[itype][jtype]*reff*reff);
         // Empirical from Legendre (2006)
-        coeffRestLogChosen=log(coeffRestMax[itype][jtype])+coeffStc[itype][jtype]/stokes;
+        coeffRestLogChosen=coeffRestMaxLog[itype][jtype]+coeffStc[itype][jtype]/stokes;
       } else {
         double ** & coeffRestLog = NormalModel<HOOKE>::coeffRestLog;
         coeffRestLogChosen=coeffRestLog[itype][jtype];
       }
 
       const double sqrtval = sqrt(reff);
-      double kn = 16./15.*sqrtval*(Yeff[itype][jtype])*pow(15.*meff*charVel*charVel/(16.*sqrtval*Yeff[itype][jtype]),0.2);
+      double kn = knCoeff[itype][jtype]*sqrtval*pow(meff/sqrtval,0.2);
       double kt = kn;
       const double gamman = sqrt(4.*meff*kn/(1.+(M_PI/coeffRestLogChosen)*(M_PI/coeffRestLogChosen)));
       const double gammat = tangential_damping ? gamman : 0.0;
@@ -150,6 +150,18 @@ namespace ContactModels
       if (elasticpotflag_)
           //set neighbor contact_distance_factor here
           neighbor->register_contact_dist_factor(1.01);
+
+      // settings are displayed here since surfacesIntersect may be
+      // called by several threads, see FixWallGran::post_force_mesh_omp
+      if(!displayedSettings)
+      {
+        displayedSettings = true;
+
+        /*
+        if(limitForce)
+            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE_STIFFNESS>: will limit normal force.\n");
+        */
+      }
     }
 
     // effective exponent for stress-strain relationship
@@ -204,15 +216,6 @@ namespace ContactModels
       double kt = k_t[itype][jtype];
       double gamman, gammat;
 
-      if(!displayedSettings)
-      {
-        displayedSettings = true;
-
-        /*
-        if(limitForce)
-            if(0 == comm->me) fprintf(screen," NormalModel<HOOKE_STIFFNESS>: will limit normal force.\n");
-        */
-      }
       if(absolute_damping)
       {
         gamman = gamma_n[itype][jtype];
@@ -75,6 +75,7 @@
 #include "fix_property_global.h"
 #include "fix_property_atom.h"
 #include "fix_contact_property_atom.h"
+#include "fix_subcycle_gran.h"
 #include "compute_pair_gran_local.h"
 #include "pair_gran.h"
 
@@ -119,6 +120,7 @@ PairGran::PairGran(LAMMPS *lmp) : Pair(lmp)
   store_contact_forces_every_ = 1;
   fix_contact_forces_stress_ = NULL;
   store_contact_forces_stress_ = false;
+  fix_subcycle_ = NULL;
   fix_store_multicontact_data_ = NULL;
   store_multicontact_data_ = false;
 
@@ -251,6 +253,10 @@ void PairGran::init_style()
   if(modify->n_fixes_style("rigid") > 1)
     error->warning(FLERR,"Pair gran does currently not support more than one fix rigid. This may result in under-damping.");
 
+  // check if contacts are sub-cycled
+
+  fix_subcycle_ = static_cast<FixSubcycleGran*>(modify->find_fix_style("subcycle/gran",0));
+
   dt = update->dt;
 
   // if shear history is stored:
@@ -148,6 +148,9 @@ public:
   class FixContactPropertyAtom * fix_store_multicontact_delta()
   { return fix_store_multicontact_data_; }
 
+  class FixSubcycleGran * fix_subcycle() const
+  { return fix_subcycle_; }
+
   class FixRigid* fr_pair() const
   { return fix_rigid; }
 
@@ -260,6 +263,9 @@ public:
   // storage for simplistic pressure computation via normal forces
   class FixPropertyAtom *fix_sum_normal_force_;
 
+  // sub-cycling of contacts, NULL if none
+  class FixSubcycleGran *fix_subcycle_;
+
   // storage of rigid body masses for use in granular interactions
 
   class FixRigid *fix_rigid; // ptr to rigid body fix, NULL if none
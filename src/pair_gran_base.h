@@ -48,6 +48,8 @@
 #define PAIR_GRAN_BASE_H_
 
 #include <vector>
+#include <cfloat>
+#include <cmath>
 #include "contact_interface.h"
 #include "math_extra_liggghts.h"
 
@@ -59,7 +61,10 @@
 #include "pair_gran.h"
 #include "neighbor.h"
 #include "neigh_list.h"
+#include "domain.h"
+#include "memory.h"
 #include "fix_contact_property_atom.h"
+#include "fix_subcycle_gran.h"
 #include "os_specific.h"
 #include "fix_insert_stream_predefined.h"
 
@@ -79,6 +84,12 @@ class Granular : private Pointers, public IGranularPairStyle {
   ForceData * aligned_j_forces;
   ContactModel cmodel;
 
+  // mixed precision: float copy of positions relative to the center of
+  // the subdomain and radii, 4 floats per atom
+  bool mixed_precision;
+  float *xr_compact;
+  int nmax_compact;
+
   inline void force_update(double relax,double *const f, double *const torque,
       const ForceData & forces)
   {
@@ -94,7 +105,10 @@ public:
     aligned_sidata(aligned_malloc<SurfacesIntersectData>(32)),
     aligned_i_forces(aligned_malloc<ForceData>(32)),
     aligned_j_forces(aligned_malloc<ForceData>(32)),
-    cmodel(lmp, parent,false /*is_wall*/, hash)
+    cmodel(lmp, parent,false /*is_wall*/, hash),
+    mixed_precision(false),
+    xr_compact(NULL),
+    nmax_compact(0)
   {
   }
 
@@ -102,6 +116,7 @@ public:
     aligned_free(aligned_sidata);
     aligned_free(aligned_i_forces);
     aligned_free(aligned_j_forces);
+    memory->destroy(xr_compact);
   }
 
   int64_t hashcode()
@@ -109,6 +124,7 @@ public:
 
   virtual void settings(int nargs, char ** args, IContactHistorySetup *hsetup) {
     Settings settings(lmp);
+    settings.registerOnOff("mixedPrecision", mixed_precision, false);
     cmodel.registerSettings(settings);
     bool success = settings.parseArguments(nargs, args);
     cmodel.postSettings(hsetup);
@@ -184,6 +200,42 @@ public:
     return cmodel.stressStrainExponent();
   }
 
+  /* ----------------------------------------------------------------------
+     refresh float copy of positions and radii of owned and ghost atoms
+     returns upper bound for the rounding error of distances
+  ------------------------------------------------------------------------- */
+
+  float refresh_compact(double **x, double *radius, const int nall)
+  {
+    if (nall > nmax_compact) {
+      nmax_compact = atom->nmax;
+      memory->destroy(xr_compact);
+      memory->create(xr_compact,4*nmax_compact,"pair:xr_compact");
+    }
+
+    const double ox = 0.5*(domain->sublo[0] + domain->subhi[0]);
+    const double oy = 0.5*(domain->sublo[1] + domain->subhi[1]);
+    const double oz = 0.5*(domain->sublo[2] + domain->subhi[2]);
+    double extent = 0.;
+
+    for (int i = 0; i < nall; i++) {
+      const double dx = x[i][0] - ox;
+      const double dy = x[i][1] - oy;
+      const double dz = x[i][2] - oz;
+      float * const xr = &xr_compact[4*i];
+      xr[0] = static_cast<float>(dx);
+      xr[1] = static_cast<float>(dy);
+      xr[2] = static_cast<float>(dz);
+      xr[3] = static_cast<float>(radius[i]);
+      extent = std::max(extent,MathExtraLiggghts::max(fabs(dx),fabs(dy),fabs(dz),radius[i]));
+    }
+
+    // each value is rounded by at most half an ulp of extent,
+    // generous margin for rounding in the float distance computation
+
+    return static_cast<float>(16.*FLT_EPSILON*extent);
+  }
+
   virtual void compute_force(PairGran * pg, int eflag, int vflag, int addflag)
   {
     if (eflag || vflag)
@@ -220,6 +272,7 @@ public:
     const bool store_contact_forces = pg->storeContactForces();
     const bool store_contact_forces_stress = pg->storeContactForcesStress();
     const int freeze_group_bit = pg->freeze_group_bit();
+    const FixSubcycleGran * const fix_subcycle = pg->fix_subcycle();
 
     const double contactDistanceMultiplier = neighbor->contactDistanceFactor*neighbor->contactDistanceFactor;
 
@@ -250,6 +303,22 @@ public:
 
     cmodel.beginPass(sidata, i_forces, j_forces);
 
+    // mixed precision: pairs that are certainly out of contact distance
+    // are skipped based on the float copy, which needs half the memory
+    // bandwidth; all others take the double path, so results are unchanged
+    // not used if radii are expanded per contact or history is copied
+
+    bool prefilter = mixed_precision && !pg->storeSumDelta() && fix_insert.empty();
+#ifdef SUPERQUADRIC_ACTIVE_FLAG
+    if (superquadric_flag) prefilter = false;
+#endif
+    float tol_f = 0.f;
+    float cdf_f = 0.f;
+    if (prefilter) {
+      tol_f = refresh_compact(x, radius, nlocal + atom->nghost);
+      cdf_f = static_cast<float>(neighbor->contactDistanceFactor*(1. + 1e-5));
+    }
+
     // loop over neighbors of my atoms
 
     for (int ii = 0; ii < inum; ii++) {
@@ -262,6 +331,7 @@ public:
       double * const all_contact_hist = first_contact_hist ? first_contact_hist[i] : NULL;
       int * const jlist = firstneigh[i];
       const int jnum = numneigh[i];
+      const float * const xri = prefilter ? &xr_compact[4*i] : NULL;
 
       sidata.i = i;
       #ifdef SUPERQUADRIC_ACTIVE_FLAG
@@ -276,6 +346,18 @@ public:
       for (int jj = 0; jj < jnum; jj++) {
         const int j = jlist[jj] & NEIGHMASK;
 
+        // contacts evaluated in another pass of the sub-cycling keep their history untouched
+        if (fix_subcycle && fix_subcycle->skip_pair(mask[i],mask[j])) continue;
+
+        if (prefilter) {
+          const float * const xrj = &xr_compact[4*j];
+          const float delx_f = xri[0] - xrj[0];
+          const float dely_f = xri[1] - xrj[1];
+          const float delz_f = xri[2] - xrj[2];
+          const float cut_f = cdf_f*(xri[3] + xrj[3]) + tol_f;
+          if (delx_f*delx_f + dely_f*dely_f + delz_f*delz_f > cut_f*cut_f) continue;
+        }
+
         const double delx = xtmp - x[j][0];
         const double dely = ytmp - x[j][1];
         const double delz = ztmp - x[j][2];
@@ -493,10 +575,11 @@ public:
     if (pg->cpl() && addflag)
         pg->cpl_pair_finalize();
 
+    // comm at the next sync point of the integrator
     if(store_contact_forces)
-        pg->fix_contact_forces()->do_forward_comm();
+        pg->fix_contact_forces()->queue_forward_comm();
     if(store_contact_forces_stress)
-        pg->fix_contact_forces_stress()->do_forward_comm();
+        pg->fix_contact_forces_stress()->queue_forward_comm();
   }
 };
 
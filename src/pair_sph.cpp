@@ -62,6 +62,7 @@
 #include "sph_kernels.h"
 #include "fix_property_atom.h"
 #include "fix_property_global.h"
+#include "fix_sph_density_fused.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -84,6 +85,7 @@ PairSph::PairSph(LAMMPS *lmp) : Pair(lmp)
     slComType = NULL;
 
     fix_fgradP_ = NULL;
+    fix_fused_ = NULL;
 
     mass_type = atom->avec->mass_type; // get flag for mass per type
 
@@ -234,9 +236,12 @@ void PairSph::init_style()
 
   // check for fixes
   int ifix_p = -1, ifix_d = -1;
+  fix_fused_ = NULL;
   for (int ifix = 0; ifix < modify->nfix; ifix++)
   {
     if (strncmp("sph/density",modify->fix[ifix]->style,11) == 0) ifix_d = ifix;
+    if (strcmp("sph/density/fused",modify->fix[ifix]->style) == 0)
+      fix_fused_ = static_cast<FixSphDensityFused*>(modify->fix[ifix]);
     if (strcmp("sph/pressure",modify->fix[ifix]->style) == 0) ifix_p = ifix;
   }
   if (ifix_d == -1) error->all(FLERR,"Pair sph requires a fix sph/density");
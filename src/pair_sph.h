@@ -109,6 +109,9 @@ class PairSph : public Pair {
   // storage for force part caused by pressure gradient (grad P / rho):
   class FixPropertyAtom* fix_fgradP_;
   double **fgradP_;
+
+  // provides kernel values of the current step, NULL if not used
+  class FixSphDensityFused *fix_fused_;
 };
 
 }
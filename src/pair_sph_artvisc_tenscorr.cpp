@@ -59,6 +59,7 @@
 #include "memory.h"
 #include "error.h"
 #include "sph_kernels.h"
+#include "fix_sph_density_fused.h"
 #include "timer.h"
 
 using namespace LAMMPS_NS;
@@ -266,8 +267,17 @@ void PairSphArtviscTenscorr::allocate_properties(int size)
 
 void PairSphArtviscTenscorr::compute(int eflag, int vflag)
 {
-  if (mass_type) compute_eval<1>(eflag,vflag);
-  else compute_eval<0>(eflag,vflag);
+  // re-use kernel values of fix sph/density/fused if available
+
+  const bool cached = fix_fused_ && fix_fused_->pair_cache_valid(list,kernel_id);
+
+  if (mass_type) {
+    if (cached) compute_eval<1,1>(eflag,vflag);
+    else compute_eval<1,0>(eflag,vflag);
+  } else {
+    if (cached) compute_eval<0,1>(eflag,vflag);
+    else compute_eval<0,0>(eflag,vflag);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -330,7 +340,7 @@ void PairSphArtviscTenscorr::read_restart_settings(FILE *fp, const int major, co
    template compute
 ------------------------------------------------------------------------- */
 
-template <int MASSFLAG>
+template <int MASSFLAG, int CACHED>
 void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
 {
   double sli,slCom,imass,jmass;
@@ -363,6 +373,9 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
   int * const numneigh = list->numneigh;
   int ** const firstneigh = list->firstneigh;
 
+  const SphPairData * const cache = CACHED ? fix_fused_->pair_cache() : NULL;
+  const int * const cache_offset = CACHED ? fix_fused_->pair_cache_offset() : NULL;
+
   // loop over neighbors of my atoms
   // depend on mass_type
 
@@ -381,6 +394,7 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
     const double ztmp = x[i][2];
     int * const jlist = firstneigh[i];
     const int jnum = numneigh[i];
+    const SphPairData * const data = CACHED ? &cache[cache_offset[ii]] : NULL;
 
     const double rhoi = rho[i];
     const double pi = p[i];
@@ -405,12 +419,15 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
       const double delz = ztmp - x[j][2];
       const double rsq = delx*delx + dely*dely + delz*delz;
 
-      if (!MASSFLAG) {
+      if (!CACHED && !MASSFLAG) {
         const double radj = radius[j];
         rcom = interpDist(radi,radj);
       }
 
-      if ((MASSFLAG && rsq < cutsq[itype][jtype]) || (!MASSFLAG && rsq < rcom*rcom)) {
+      // cached pairs are within the same cutoff as below if rinv > 0
+
+      if ((CACHED && data[jj].rinv > 0.) ||
+          (!CACHED && MASSFLAG && rsq < cutsq[itype][jtype]) || (!CACHED && !MASSFLAG && rsq < rcom*rcom)) {
 
         if (MASSFLAG) {
           jmass = mass[jtype];
@@ -427,16 +444,22 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
         //cut = slCom*SPH_KERNEL_NS::sph_kernel_cut(kernel_id);
 
         // get distance and normalized distance
-        const double r = sqrt(rsq);
-        if (r == 0.) {
-          printf("Particle %i and %i are at same position (%f, %f, %f)",i,j,xtmp,ytmp,ztmp);
-          error->one(FLERR,"Zero distance between SPH particles!");
-        }
-        const double rinv = 1./r;
-        const double s = r * slComInv;
+        double rinv,s = 0.,gradWmag;
+        if (CACHED) {
+          rinv = data[jj].rinv;
+          gradWmag = data[jj].gradWmag;
+        } else {
+          const double r = sqrt(rsq);
+          if (r == 0.) {
+            printf("Particle %i and %i are at same position (%f, %f, %f)",i,j,xtmp,ytmp,ztmp);
+            error->one(FLERR,"Zero distance between SPH particles!");
+          }
+          rinv = 1./r;
+          s = r * slComInv;
 
-        // calculate value for magnitude of grad W
-        const double gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+          // calculate value for magnitude of grad W
+          gradWmag = SPH_KERNEL_NS::sph_kernel_der(kernel_id,s,slCom,slComInv);
+        }
 
         // artificial viscosity
         artVisc = 0.0;
@@ -481,7 +504,8 @@ void PairSphArtviscTenscorr::compute_eval(int eflag, int vflag)
           }
 
           //TODO: Is fAB4 in this form ok?!
-          const double fAB =  SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv) * wDeltaPinv;
+          const double W = CACHED ? data[jj].W : SPH_KERNEL_NS::sph_kernel(kernel_id,s,slCom,slComInv);
+          const double fAB =  W * wDeltaPinv;
           const double fAB2 = fAB * fAB;
           fAB4 = fAB2 * fAB2;
         }
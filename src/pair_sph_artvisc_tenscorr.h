@@ -70,7 +70,7 @@ class PairSphArtviscTenscorr : public PairSph {
 
  protected:
   void allocate();
-  template <int> void compute_eval(int, int);
+  template <int,int> void compute_eval(int, int);
 
   int     artVisc_flag, tensCorr_flag; // flags for additional styles
 
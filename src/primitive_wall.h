@@ -44,8 +44,10 @@
 #ifndef LMP_PRIMITIVE_WALL
 #define LMP_PRIMITIVE_WALL
 
+#include <cmath>
 #include "container.h"
 #include "neighbor.h"
+#include "update.h"
 #include "primitive_wall_definitions.h"
 
 namespace LAMMPS_NS
@@ -60,7 +62,8 @@ namespace LAMMPS_NS
       public:
 
         PrimitiveWall(LAMMPS *lmp,PRIMITIVE_WALL_DEFINITIONS::WallType wType_, int nParam_, double *param_)
-        : Pointers(lmp), neighlist("neighlist"), wType(wType_), nParam(nParam_)
+        : Pointers(lmp), neighlist("neighlist"), binlist("binlist"), wType(wType_), nParam(nParam_),
+          lastBinUpdate_(-1), binTreshold_(-1.), binRadius_(-1.)
         {
             param = new double[nParam];
             for(int i=0;i<nParam;i++)
@@ -78,6 +81,7 @@ namespace LAMMPS_NS
         inline void setContactHistorySize(int nPart);
 
         inline void buildNeighList(double neighCutoff, double **x, double *r, int nPart);
+        inline int nBinsNearWall() { return binlist.size(); }
 
         inline double resolveContact(double *x, double r, double *delta);
         inline bool resolveNeighlist(double *x, double r, double treshold);
@@ -88,12 +92,23 @@ namespace LAMMPS_NS
         inline int isNear(int iPart,double treshold);
 
       private:
+        inline bool useBins();
+        inline void buildBinList(double treshold, double rBin);
+
         ScalarContainer<int> neighlist;
+
+        // bins of the neighbor binning that are within reach of the wall
+        ScalarContainer<int> binlist;
+
         PRIMITIVE_WALL_DEFINITIONS::WallType wType;
 
         double *param;
         int nParam;
 
+        // state the bin list was built for
+        bigint lastBinUpdate_;
+        double binTreshold_, binRadius_;
+
   };
 
   /*
@@ -126,14 +141,86 @@ namespace LAMMPS_NS
     return neighlist.size();
   }
 
+  /*
+   * neighbor list build uses the bins of the pairwise neighbor list if
+   * available, so only particles in bins close to the wall are checked
+   */
+
+  bool PrimitiveWall::useBins()
+  {
+    return neighbor->style == 1 && neighbor->bins && neighbor->binhead && !neighbor->includegroup;
+  }
+
+  void PrimitiveWall::buildBinList(double treshold, double rBin)
+  {
+    binlist.clearContainer();
+
+    const double dx = 0.5*neighbor->binsizex;
+    const double dy = 0.5*neighbor->binsizey;
+    const double dz = 0.5*neighbor->binsizez;
+    const double maxdiag = sqrt(dx*dx+dy*dy+dz*dz);
+    const int mbinx = neighbor->mbinx;
+    const int mbiny = neighbor->mbiny;
+    const int mbins = neighbor->mbins;
+    double center[3];
+
+    for(int iBin = 0; iBin < mbins; iBin++)
+    {
+      const int ix = iBin % mbinx;
+      const int iy = (iBin / mbinx) % mbiny;
+      const int iz = iBin / (mbinx*mbiny);
+      neighbor->bin_center(ix,iy,iz,center);
+
+      // a particle in this bin may touch the wall
+      if(resolveNeighlist(center,maxdiag+rBin,treshold))
+        binlist.add(iBin);
+    }
+
+    lastBinUpdate_ = update->ntimestep;
+    binTreshold_ = treshold;
+    binRadius_ = rBin;
+  }
+
   void PrimitiveWall::buildNeighList(double treshold, double **x, double *r, int nPart)
   {
     neighlist.clearContainer();
-    for(int iPart=0;iPart<nPart;iPart++)
+
+    if(!useBins())
+    {
+      for(int iPart=0;iPart<nPart;iPart++)
+      {
+        
+        if(resolveNeighlist(x[iPart],r?r[iPart]:0.,treshold))
+          neighlist.add(iPart);
+      }
+      return;
+    }
+
+    // manually trigger binning if no pairwise neigh lists exist
+    if(0 == neighbor->n_blist())
+      neighbor->bin_atoms();
+
+    // max particle radius as assumed by the pairwise neighbor list
+    const double rBin = r ? 0.5*(neighbor->cutneighmax - neighbor->skin) : 0.;
+
+    // update bins close to wall if binning or cutoff changed,
+    // or if the timestep was reset to an earlier value since
+    if(neighbor->last_setup_bins_timestep >= lastBinUpdate_ || update->ntimestep < lastBinUpdate_ ||
+       treshold != binTreshold_ || rBin != binRadius_)
+      buildBinList(treshold,rBin);
+
+    const int *bins = neighbor->bins;
+    const int *binhead = neighbor->binhead;
+    const int nBins = binlist.size();
+
+    for(int i = 0; i < nBins; i++)
     {
-      
-      if(resolveNeighlist(x[iPart],r?r[iPart]:0.,treshold))
-        neighlist.add(iPart);
+      // owned atoms are at the front of each bin
+      for(int iPart = binhead[binlist(i)]; iPart >= 0 && iPart < nPart; iPart = bins[iPart])
+      {
+        if(resolveNeighlist(x[iPart],r?r[iPart]:0.,treshold))
+          neighlist.add(iPart);
+      }
     }
   }
 
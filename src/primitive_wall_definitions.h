@@ -197,7 +197,8 @@ namespace LAMMPS_NS
         double dy,dz;
         double dMax = r + treshold;
         double dist = calcRadialDistance(pos,param,dy,dz) - *param;
-        return (dMax < dist || -dMax < dist);
+        double absdist = (dist > 0.0) ? dist : -dist;
+        return (absdist <= dMax);
       }
 
     };
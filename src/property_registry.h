@@ -49,6 +49,7 @@
 #include "pointers.h"
 #include "lammps.h"
 #include "fix_property_global.h"
+#include <cstdlib>
 #include <map>
 #include <set>
 #include <string>
@@ -126,25 +127,39 @@ class MatrixProperty : public Property<double**>
 public:
   int rows;
   int cols;
+  int stride;
+
+  // rows are padded to a multiple of 8 doubles (one cache line) and
+  // share one contiguous block, aligned to LAMMPS_MEMALIGN if defined,
+  // so a row of per-type-pair coefficients can be read with unit stride
 
   MatrixProperty(const int N, const int M) :
     rows(N),
-    cols(M)
+    cols(M),
+    stride(((M+7)/8)*8),
+    array(NULL)
   {
-    double * array = new double[N*M];
+#if defined(LAMMPS_MEMALIGN)
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, LAMMPS_MEMALIGN, N*stride*sizeof(double)))
+      ptr = NULL;
+    array = (double *) ptr;
+#else
+    array = (double *) malloc(N*stride*sizeof(double));
+#endif
     data = new double*[N];
 
     for(int row = 0; row < N; row++) {
-      data[row] = &array[row*M];
+      data[row] = &array[row*stride];
 
-      for(int col = 0; col < M; col++) {
+      for(int col = 0; col < stride; col++) {
         data[row][col] = 0.0;
       }
     }
   }
 
   virtual ~MatrixProperty() {
-    delete [] data[0];
+    free(array);
     delete [] data;
   }
 
@@ -162,6 +177,9 @@ public:
     }
     fprintf(out, "]");
   }
+
+private:
+  double * array;
 };
 
 // -------------------------------------------------------------------
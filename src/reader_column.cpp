@@ -0,0 +1,245 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include "reader_column.h"
+#include "dump_custom_column.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+ReaderColumn::ReaderColumn(LAMMPS *lmp) :
+  ReaderNative(lmp),
+  frame_start(0),
+  next_frame(0),
+  natoms(0),
+  nread(0),
+  maxcbuf(0),
+  cbuf(NULL)
+{
+}
+
+/* ---------------------------------------------------------------------- */
+
+ReaderColumn::~ReaderColumn()
+{
+  memory->destroy(cbuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ReaderColumn::open_file(const char *file)
+{
+  Reader::open_file(file);
+  if (compressed) error->one(FLERR,"Column dump files can not be read compressed");
+  next_frame = 0;
+}
+
+/* ----------------------------------------------------------------------
+   read and return time stamp of the next frame
+   frames are located via the frame size stored in each header
+   if no frame follows, return 1 so caller can open next file
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+int ReaderColumn::read_time(bigint &ntimestep)
+{
+  char magic[COLUMN_DUMP_MAGIC_LEN];
+
+  seek(next_frame);
+  if (fread(magic,1,COLUMN_DUMP_MAGIC_LEN,fp) != COLUMN_DUMP_MAGIC_LEN) return 1;
+  if (memcmp(magic,COLUMN_DUMP_MAGIC,COLUMN_DUMP_MAGIC_LEN) != 0)
+    error->one(FLERR,"Dump file is incorrectly formatted");
+
+  bigint frame_bytes;
+  read_bytes(&ntimestep,sizeof(bigint));
+  read_bytes(&natoms,sizeof(bigint));
+  read_bytes(&frame_bytes,sizeof(bigint));
+  if (natoms < 0 || frame_bytes <= 0)
+    error->one(FLERR,"Dump file is incorrectly formatted");
+
+  frame_start = next_frame;
+  next_frame += frame_bytes;
+
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   skip snapshot from timestamp onward
+   nothing to do, next read_time() seeks to the next frame
+------------------------------------------------------------------------- */
+
+void ReaderColumn::skip()
+{
+}
+
+/* ----------------------------------------------------------------------
+   read remaining header info, see ReaderNative::read_header()
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+bigint ReaderColumn::read_header(double box[3][3], int &triclinic,
+                                 int fieldinfo, int nfield,
+                                 int *fieldtype, char **fieldlabel,
+                                 int scaleflag, int wrapflag, int &fieldflag,
+                                 int &xflag, int &yflag, int &zflag)
+{
+  int boundary[6],ncol;
+  double bounds[9];
+
+  read_bytes(&triclinic,sizeof(int));
+  read_bytes(boundary,6*sizeof(int));
+  read_bytes(bounds,9*sizeof(double));
+  read_bytes(&ncol,sizeof(int));
+
+  box[0][0] = bounds[0];
+  box[0][1] = bounds[1];
+  box[1][0] = bounds[2];
+  box[1][1] = bounds[3];
+  box[2][0] = bounds[4];
+  box[2][1] = bounds[5];
+  box[0][2] = bounds[6];
+  box[1][2] = bounds[7];
+  box[2][2] = bounds[8];
+
+  ctype.resize(ncol);
+  cname.resize(ncol);
+  coffset.resize(ncol);
+
+  for (int i = 0; i < ncol; i++) {
+    int n;
+    read_bytes(&ctype[i],sizeof(int));
+    read_bytes(&n,sizeof(int));
+    if (n <= 0) error->one(FLERR,"Dump file is incorrectly formatted");
+    char *name = new char[n+1];
+    read_bytes(name,n);
+    name[n] = '\0';
+    cname[i] = name;
+    delete [] name;
+    read_bytes(&coffset[i],sizeof(bigint));
+  }
+
+  nread = 0;
+
+  if (!fieldinfo) return natoms;
+
+  // match requested fields to column names like the native reader does
+
+  nwords = ncol;
+  char **labels = new char*[ncol];
+  for (int i = 0; i < ncol; i++)
+    labels[i] = const_cast<char*>(cname[i].c_str());
+
+  match_fields(ncol,labels,nfield,fieldtype,fieldlabel,scaleflag,wrapflag,
+               xflag,yflag,zflag);
+
+  delete [] labels;
+
+  fieldflag = 0;
+  for (int i = 0; i < nfield; i++)
+    if (fieldindex[i] < 0) fieldflag = -1;
+
+  return natoms;
+}
+
+/* ----------------------------------------------------------------------
+   read values of next N atoms from dump file
+   only the columns of the requested fields are read
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+void ReaderColumn::read_atoms(int n, int nfield, double **fields)
+{
+  if (nread + n > natoms) error->one(FLERR,"Unexpected end of dump file");
+
+  for (int m = 0; m < nfield; m++) {
+    int icol = fieldindex[m];
+    int size = sizeof(double);
+    if (ctype[icol] == COLUMN_INT32) size = sizeof(int);
+    else if (ctype[icol] == COLUMN_FLOAT32) size = sizeof(float);
+
+    if (n*size > maxcbuf) {
+      maxcbuf = n*size;
+      memory->destroy(cbuf);
+      memory->create(cbuf,maxcbuf,"read_dump:cbuf");
+    }
+
+    seek(frame_start + coffset[icol] + nread*size);
+    read_bytes(cbuf,n*size);
+
+    if (ctype[icol] == COLUMN_INT32) {
+      int *values = (int *) cbuf;
+      for (int i = 0; i < n; i++) fields[i][m] = values[i];
+    } else if (ctype[icol] == COLUMN_FLOAT32) {
+      float *values = (float *) cbuf;
+      for (int i = 0; i < n; i++) fields[i][m] = values[i];
+    } else {
+      double *values = (double *) cbuf;
+      for (int i = 0; i < n; i++) fields[i][m] = values[i];
+    }
+  }
+
+  nread += n;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ReaderColumn::read_bytes(void *ptr, int n)
+{
+  if (n > 0 && fread(ptr,1,n,fp) != (size_t) n)
+    error->one(FLERR,"Unexpected end of dump file");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ReaderColumn::seek(bigint offset)
+{
+#ifdef _WIN32
+  if (_fseeki64(fp,offset,SEEK_SET))
+#else
+  if (fseeko(fp,offset,SEEK_SET))
+#endif
+    error->one(FLERR,"Unexpected end of dump file");
+}
@@ -59,7 +59,7 @@ namespace LAMMPS_NS {
 class ReaderNative : public Reader {
  public:
   ReaderNative(class LAMMPS *);
-  ~ReaderNative();
+  virtual ~ReaderNative();
 
   int read_time(bigint &);
   void skip();
@@ -67,14 +67,18 @@ class ReaderNative : public Reader {
                      int, int, int &, int &, int &, int &);
   void read_atoms(int, int, double **);
 
+protected:
+  int nwords;              // # of per-atom columns in dump file
+  int *fieldindex;         // which column each requested field maps to
+
+  void match_fields(int, char **, int, int *, char **, int, int,
+                    int &, int &, int &);
+  int find_label(const char *, int, char **);
+
 private:
   char *line;              // line read from dump file
-
-  int nwords;              // # of per-atom columns in dump file
   char **words;            // ptrs to values in parsed per-atom line
-  int *fieldindex;         //
 
-  int find_label(const char *, int, char **);
   void read_lines(int);
 };
 
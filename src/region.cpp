@@ -707,5 +707,15 @@ int Region::bbox_extends_outside_box()
     double min[3],max[3];
     vectorConstruct3D(min,extent_xlo+SMALL,extent_ylo+SMALL,extent_zlo+SMALL);
     vectorConstruct3D(max,extent_xhi-SMALL,extent_yhi-SMALL,extent_zhi-SMALL);
+
+    // corners of the bbox are generally not inside a wedge, compare to box bounds
+    if(domain->is_wedge)
+    {
+        for(int idim = 0; idim < 3; idim++)
+            if(min[idim] < domain->boxlo[idim] || max[idim] > domain->boxhi[idim])
+                return 1;
+        return 0;
+    }
+
     return (!(domain->is_in_domain(min)) || !(domain->is_in_domain(max)));
 }
@@ -97,8 +97,8 @@ RegWedge::RegWedge(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg)
   } else if (axis == 'y') {
     if(strcmp(arg[iarg++],"center"))
         error->all(FLERR,"Illegal region wegde command, expecting keyword 'center'");
-    c1 = xscale*atof(arg[iarg++]);
-    c2 = zscale*atof(arg[iarg++]);
+    c1 = zscale*atof(arg[iarg++]);
+    c2 = xscale*atof(arg[iarg++]);
     if(strcmp(arg[iarg++],"radius"))
         error->all(FLERR,"Illegal region wegde command, expecting keyword 'radius'");
     radius = xscale*atof(arg[iarg++]);
@@ -192,7 +192,7 @@ RegWedge::RegWedge(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg)
   if (radius <= 0.0) error->all(FLERR,"Illegal region cylinder command");
   if (dang < 5.0*M_PI/180.0) error->all(FLERR,"Wedge too flat. Wedge-angle has "
                                         "to be >= 5.0 degrees");
-  if (dang > 180.0) error->all(FLERR, "Maximum wedge-angle of 180 "
+  if (dang > M_PI) error->all(FLERR, "Maximum wedge-angle of 180 "
                                           "deg exceeded");
 
   // calculate helper variables
@@ -272,12 +272,12 @@ RegWedge::RegWedge(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg)
       extent_zhi = c2 + bmax;
     }
     if (axis == 'y') {
-      extent_xlo = c1 + bmin;
-      extent_xhi = c1 + bmax;
+      extent_xlo = c2 + bmin;
+      extent_xhi = c2 + bmax;
       extent_ylo = lo;
       extent_yhi = hi;
-      extent_zlo = c2 + amin;
-      extent_zhi = c2 + amax;
+      extent_zlo = c1 + amin;
+      extent_zhi = c1 + amax;
     }
     if (axis == 'z') {
       extent_xlo = c1 + amin;
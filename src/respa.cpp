@@ -393,6 +393,7 @@ void Respa::setup()
   for (int ilevel = 0; ilevel < nlevels; ilevel++) {
     force_clear(newton[ilevel]);
     modify->setup_pre_force_respa(vflag,ilevel);
+    comm->flush_comm_fix();
     if (level_pair == ilevel && pair_compute_flag)
       force->pair->compute(eflag,vflag);
     if (level_inner == ilevel && pair_compute_flag)
@@ -418,6 +419,7 @@ void Respa::setup()
   }
 
   modify->setup(vflag);
+  comm->flush_comm_fix();
   sum_flevel_f();
   output->setup();
   update->setupflag = 0;
@@ -461,6 +463,7 @@ void Respa::setup_minimal(int flag)
   for (int ilevel = 0; ilevel < nlevels; ilevel++) {
     force_clear(newton[ilevel]);
     modify->setup_pre_force_respa(vflag,ilevel);
+    comm->flush_comm_fix();
     if (level_pair == ilevel && pair_compute_flag)
       force->pair->compute(eflag,vflag);
     if (level_inner == ilevel && pair_compute_flag)
@@ -486,6 +489,7 @@ void Respa::setup_minimal(int flag)
   }
 
   modify->setup(vflag);
+  comm->flush_comm_fix();
   sum_flevel_f();
   update->setupflag = 0;
 }
@@ -599,6 +603,7 @@ void Respa::recurse(int ilevel)
     force_clear(newton[ilevel]);
     if (modify->n_pre_force_respa)
       modify->pre_force_respa(vflag,ilevel,iloop);
+    comm->flush_comm_fix();
 
     timer->stamp();
     if (level_pair == ilevel && pair_compute_flag) {
@@ -645,6 +650,7 @@ void Respa::recurse(int ilevel)
 
     if (modify->n_post_force_respa)
       modify->post_force_respa(vflag,ilevel,iloop);
+    comm->flush_comm_fix();
     modify->final_integrate_respa(ilevel,iloop);
   }
 
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+    This is the
+
+    ██╗     ██╗ ██████╗  ██████╗  ██████╗ ██╗  ██╗████████╗███████╗
+    ██║     ██║██╔════╝ ██╔════╝ ██╔════╝ ██║  ██║╚══██╔══╝██╔════╝
+    ██║     ██║██║  ███╗██║  ███╗██║  ███╗███████║   ██║   ███████╗
+    ██║     ██║██║   ██║██║   ██║██║   ██║██╔══██║   ██║   ╚════██║
+    ███████╗██║╚██████╔╝╚██████╔╝╚██████╔╝██║  ██║   ██║   ███████║
+    ╚══════╝╚═╝ ╚═════╝  ╚═════╝  ╚═════╝ ╚═╝  ╚═╝   ╚═╝   ╚══════╝®
+
+    DEM simulation engine, released by
+    DCS Computing Gmbh, Linz, Austria
+    http://www.dcs-computing.com, office@dcs-computing.com
+
+    LIGGGHTS® is part of CFDEM®project:
+    http://www.liggghts.com | http://www.cfdem.com
+
+    Core developer and main author:
+    Christoph Kloss, christoph.kloss@dcs-computing.com
+
+    LIGGGHTS® is open-source, distributed under the terms of the GNU Public
+    License, version 2 or later. It is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+    of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. You should have
+    received a copy of the GNU General Public License along with LIGGGHTS®.
+    If not, see http://www.gnu.org/licenses . See also top-level README
+    and LICENSE files.
+
+    LIGGGHTS® and CFDEM® are registered trade marks of DCS Computing GmbH,
+    the producer of the LIGGGHTS® software and the CFDEM®coupling software
+    See http://www.cfdem.com/terms-trademark-policy for details.
+
+-------------------------------------------------------------------------
+    Contributing author and copyright for this file:
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
+
+    Copyright 2012-     DCS Computing GmbH, Linz
+    Copyright 2009-2012 JKU Linz
+------------------------------------------------------------------------- */
+
+#include <string.h>
+#include <string>
+#include "snapshot.h"
+#include "domain.h"
+#include "modify.h"
+#include "comm.h"
+#include "fix_snapshot.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+Snapshot::Snapshot(LAMMPS *lmp) : Pointers(lmp) {}
+
+/* ----------------------------------------------------------------------
+   snapshot save|restore|delete ID
+   state is held by an internal fix with ID snapshot_ID
+------------------------------------------------------------------------- */
+
+void Snapshot::command(int narg, char **arg)
+{
+  if (domain->box_exist == 0)
+    error->all(FLERR,"Snapshot command before simulation box is defined");
+  if (narg != 2) error->all(FLERR,"Illegal snapshot command");
+
+  std::string fixid = std::string("snapshot_") + arg[1];
+  FixSnapshot *fix = static_cast<FixSnapshot*>
+    (modify->find_fix_id_style(fixid.c_str(),"SNAPSHOT"));
+
+  if (strcmp(arg[0],"save") == 0) {
+    if (!fix) {
+      char **fixarg = new char*[3];
+      fixarg[0] = (char *) fixid.c_str();
+      fixarg[1] = (char *) "all";
+      fixarg[2] = (char *) "SNAPSHOT";
+      modify->add_fix(3,fixarg);
+      delete [] fixarg;
+      fix = static_cast<FixSnapshot*>
+        (modify->find_fix_id_style(fixid.c_str(),"SNAPSHOT"));
+    }
+    if (comm->me == 0 && screen)
+      fprintf(screen,"Saving snapshot %s ...\n",arg[1]);
+    fix->save();
+  } else if (strcmp(arg[0],"restore") == 0) {
+    if (!fix) error->all(FLERR,"Snapshot ID does not exist");
+    if (comm->me == 0 && screen)
+      fprintf(screen,"Restoring snapshot %s ...\n",arg[1]);
+    fix->restore();
+  } else if (strcmp(arg[0],"delete") == 0) {
+    if (!fix) error->all(FLERR,"Snapshot ID does not exist");
+    modify->delete_fix(fixid.c_str());
+  } else error->all(FLERR,"Illegal snapshot command");
+}
@@ -32,46 +32,54 @@
 
 -------------------------------------------------------------------------
     Contributing author and copyright for this file:
-
-    Christoph Kloss (DCS Computing GmbH, Linz)
-    Christoph Kloss (JKU Linz)
-    Stefan Amberger (JKU Linz)
+    (if not contributing author is listed, this file has been contributed
+    by the core developer)
 
     Copyright 2012-     DCS Computing GmbH, Linz
     Copyright 2009-2012 JKU Linz
 ------------------------------------------------------------------------- */
 
-#ifndef DOMAIN_WEDGE_H
-#define DOMAIN_WEDGE_H
+#ifdef COMMAND_CLASS
+
+CommandStyle(snapshot,Snapshot)
+
+#else
+
+#ifndef LMP_SNAPSHOT_H
+#define LMP_SNAPSHOT_H
 
-#include "domain.h"
+#include "pointers.h"
 
 namespace LAMMPS_NS {
 
-class DomainWedge : public Domain
-{
+class Snapshot : protected Pointers {
+ public:
+  Snapshot(class LAMMPS *);
+  void command(int, char **);
+};
+
+}
+
+#endif
+#endif
 
-  public:
+/* ERROR/WARNING messages:
 
-    DomainWedge(class LAMMPS *lmp) : Domain(lmp) {};
-    void set_domain(class RegWedge *rw) {}
+E: Snapshot command before simulation box is defined
 
-    inline int index_axis()
-    { return 0; }
+Self-explanatory.
 
-    inline int index_phi()
-    { return 0; }
+E: Illegal snapshot command
 
-    inline void n1(double *_n1)
-    { }
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.
 
-    inline void n2(double *_n2)
-    { }
+E: Snapshot ID does not exist
 
-    inline void center(double *_c)
-    { }
-};
+A snapshot can only be restored or deleted after it was saved.
 
-}
+E: Snapshot does not support fix multisphere
 
-#endif
+Rigid bodies are not captured by a snapshot.
+
+*/
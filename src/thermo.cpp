@@ -350,17 +350,23 @@ void Thermo::compute(int flag)
   for (i = 0; i < ncompute; i++)
     if (compute_which[i] == SCALAR) {
       if (!(computes[i]->invoked_flag & INVOKED_SCALAR)) {
+        computes[i]->begin_time_recording();
         computes[i]->compute_scalar();
+        computes[i]->end_time_recording();
         computes[i]->invoked_flag |= INVOKED_SCALAR;
       }
     } else if (compute_which[i] == VECTOR) {
       if (!(computes[i]->invoked_flag & INVOKED_VECTOR)) {
+        computes[i]->begin_time_recording();
         computes[i]->compute_vector();
+        computes[i]->end_time_recording();
         computes[i]->invoked_flag |= INVOKED_VECTOR;
       }
     } else if (compute_which[i] == ARRAY) {
       if (!(computes[i]->invoked_flag & INVOKED_ARRAY)) {
+        computes[i]->begin_time_recording();
         computes[i]->compute_array();
+        computes[i]->end_time_recording();
         computes[i]->invoked_flag |= INVOKED_ARRAY;
       }
     }
@@ -978,7 +984,9 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(kin_eng->invoked_flag & INVOKED_SCALAR)) {
+      kin_eng->begin_time_recording();
       kin_eng->compute_scalar();
+      kin_eng->end_time_recording();
       kin_eng->invoked_flag |= INVOKED_SCALAR;
     }
     compute_ke();
@@ -994,7 +1002,9 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(erot->invoked_flag & INVOKED_SCALAR)) {
+      erot->begin_time_recording();
       erot->compute_scalar();
+      erot->end_time_recording();
       erot->invoked_flag |= INVOKED_SCALAR;
     }
     compute_erot();
@@ -44,15 +44,24 @@
 ------------------------------------------------------------------------- */
 
 #include <mpi.h>
+#include <string.h>
 #include "timer.h"
 #include "memory.h"
 #include "modify.h"
+#include "fix.h"
+#include "compute.h"
+#include "comm.h"
+#include "update.h"
+#include "error.h"
 
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
-Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
+Timer::Timer(LAMMPS *lmp) : Pointers(lmp),
+  timeline_every(0),
+  fp_timeline(NULL),
+  timeline_json(0)
 {
   memory->create(array,TIME_N,"array");
 }
@@ -62,6 +71,7 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
 Timer::~Timer()
 {
   memory->destroy(array);
+  if (fp_timeline) fclose(fp_timeline);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -73,6 +83,11 @@ void Timer::init()
   if(modify->timing) {
     for (int i = 0; i < modify->nfix; i++) modify->fix[i]->reset_time_recording();
   }
+
+  for (int i = 0; i < modify->ncompute; i++) {
+    modify->compute[i]->set_time_recording(modify->timing);
+    modify->compute[i]->reset_time_recording();
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -119,3 +134,142 @@ double Timer::elapsed(int which)
   double current_time = MPI_Wtime();
   return (current_time - array[which]);
 }
+
+/* ---------------------------------------------------------------------- */
+
+const char *Timer::fix_hook_name(int hook)
+{
+  static const char *names[TIME_FIX_N] = {
+    "pre_initial_integrate","initial_integrate","post_integrate",
+    "pre_exchange","pre_neighbor","pre_force","post_force",
+    "pre_final_integrate","final_integrate","end_of_step","thermo_energy",
+    "other"};
+  if (hook < 0 || hook >= TIME_FIX_N) return "unknown";
+  return names[hook];
+}
+
+/* ----------------------------------------------------------------------
+   write fix and compute times to file every N steps
+   file ending in .json = one JSON object per line, else CSV
+------------------------------------------------------------------------- */
+
+void Timer::set_timeline(int every, const char *file)
+{
+  if (fp_timeline) fclose(fp_timeline);
+  fp_timeline = NULL;
+  timeline_every = every;
+
+  if (every == 0) return;
+
+  const char *suffix = file + strlen(file) - strlen(".json");
+  timeline_json = (suffix > file && strcmp(suffix,".json") == 0) ? 1 : 0;
+
+  if (comm->me == 0) {
+    fp_timeline = fopen(file,"w");
+    if (fp_timeline == NULL) {
+      char str[512];
+      sprintf(str,"Cannot open timing timeline file %s",file);
+      error->one(FLERR,str);
+    }
+    if (!timeline_json)
+      fprintf(fp_timeline,"step,kind,id,style,hook,min,avg,max\n");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   min/avg/max over procs of the recorded fix hook and compute times
+   fix hook times first (nfix*TIME_FIX_N values), then compute times
+------------------------------------------------------------------------- */
+
+void Timer::modify_stats(double *tmin, double *tavg, double *tmax, double &tloop)
+{
+  const int nfix = modify->nfix;
+  const int n = nfix*TIME_FIX_N + modify->ncompute;
+  double *local = new double[n+1];
+
+  for (int i = 0; i < nfix; i++)
+    for (int j = 0; j < TIME_FIX_N; j++)
+      local[i*TIME_FIX_N+j] = modify->fix[i]->get_recorded_time(j);
+  for (int i = 0; i < modify->ncompute; i++)
+    local[nfix*TIME_FIX_N+i] = modify->compute[i]->get_recorded_time();
+  local[n] = elapsed(TIME_LOOP);
+
+  MPI_Allreduce(local,tmin,n+1,MPI_DOUBLE,MPI_MIN,world);
+  MPI_Allreduce(local,tmax,n+1,MPI_DOUBLE,MPI_MAX,world);
+  MPI_Allreduce(local,tavg,n+1,MPI_DOUBLE,MPI_SUM,world);
+  for (int i = 0; i <= n; i++) tavg[i] /= comm->nprocs;
+  tloop = tavg[n];
+
+  delete [] local;
+}
+
+/* ----------------------------------------------------------------------
+   write one timeline entry, times are cumulative since start of run
+   entries which are zero on all procs are omitted
+------------------------------------------------------------------------- */
+
+void Timer::write_timeline()
+{
+  const int nfix = modify->nfix;
+  const int n = nfix*TIME_FIX_N + modify->ncompute;
+  double *tmin = new double[n+1];
+  double *tavg = new double[n+1];
+  double *tmax = new double[n+1];
+  double tloop;
+
+  modify_stats(tmin,tavg,tmax,tloop);
+
+  if (fp_timeline) {
+    const bigint step = update->ntimestep;
+    int first = 1;
+
+    if (timeline_json)
+      fprintf(fp_timeline,"{\"step\": " BIGINT_FORMAT ", \"loop\": %g, \"fix\": [",
+              step,tloop);
+
+    for (int i = 0; i < nfix; i++) {
+      Fix *fix = modify->fix[i];
+      for (int j = 0; j < TIME_FIX_N; j++) {
+        const int k = i*TIME_FIX_N+j;
+        if (tmax[k] == 0.0) continue;
+        if (timeline_json) {
+          fprintf(fp_timeline,"%s{\"id\": \"%s\", \"style\": \"%s\", \"hook\": \"%s\", "
+                  "\"min\": %g, \"avg\": %g, \"max\": %g}",
+                  first ? "" : ", ",fix->id,fix->style,fix_hook_name(j),
+                  tmin[k],tavg[k],tmax[k]);
+          first = 0;
+        } else
+          fprintf(fp_timeline,BIGINT_FORMAT ",fix,%s,%s,%s,%g,%g,%g\n",
+                  step,fix->id,fix->style,fix_hook_name(j),
+                  tmin[k],tavg[k],tmax[k]);
+      }
+    }
+
+    if (timeline_json) fprintf(fp_timeline,"], \"compute\": [");
+    first = 1;
+
+    for (int i = 0; i < modify->ncompute; i++) {
+      Compute *compute = modify->compute[i];
+      const int k = nfix*TIME_FIX_N+i;
+      if (tmax[k] == 0.0) continue;
+      if (timeline_json) {
+        fprintf(fp_timeline,"%s{\"id\": \"%s\", \"style\": \"%s\", "
+                "\"min\": %g, \"avg\": %g, \"max\": %g}",
+                first ? "" : ", ",compute->id,compute->style,
+                tmin[k],tavg[k],tmax[k]);
+        first = 0;
+      } else
+        fprintf(fp_timeline,BIGINT_FORMAT ",compute,%s,%s,,%g,%g,%g\n",
+                step,compute->id,compute->style,tmin[k],tavg[k],tmax[k]);
+    }
+
+    if (timeline_json) fprintf(fp_timeline,"]}\n");
+    else fprintf(fp_timeline,BIGINT_FORMAT ",loop,,,,%g,%g,%g\n",
+                 step,tmin[n],tloop,tmax[n]);
+    fflush(fp_timeline);
+  }
+
+  delete [] tmin;
+  delete [] tavg;
+  delete [] tmax;
+}
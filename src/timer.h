@@ -46,11 +46,20 @@
 #ifndef LMP_TIMER_H
 #define LMP_TIMER_H
 
+#include <stdio.h>
 #include "pointers.h"
 
 enum{TIME_LOOP,TIME_PAIR,TIME_BOND,TIME_KSPACE,TIME_NEIGHBOR,
      TIME_COMM,TIME_OUTPUT,TIME_MODIFY,TIME_N};
 
+// fix hooks which are timed separately if modify_timing is on
+
+enum{TIME_FIX_PRE_INITIAL_INTEGRATE,TIME_FIX_INITIAL_INTEGRATE,
+     TIME_FIX_POST_INTEGRATE,TIME_FIX_PRE_EXCHANGE,TIME_FIX_PRE_NEIGHBOR,
+     TIME_FIX_PRE_FORCE,TIME_FIX_POST_FORCE,TIME_FIX_PRE_FINAL_INTEGRATE,
+     TIME_FIX_FINAL_INTEGRATE,TIME_FIX_END_OF_STEP,TIME_FIX_THERMO_ENERGY,
+     TIME_FIX_OTHER,TIME_FIX_N};
+
 namespace LAMMPS_NS {
 
 class Timer : protected Pointers {
@@ -66,8 +75,19 @@ class Timer : protected Pointers {
   void barrier_stop(int);
   double elapsed(int);
 
+  static const char *fix_hook_name(int);
+  void modify_stats(double *, double *, double *, double &);
+
+  // periodic export of fix and compute times
+  void set_timeline(int, const char *);
+  void write_timeline();
+  int timeline_every;        // write timeline every this many steps, 0 = off
+
  private:
   double previous_time;
+
+  FILE *fp_timeline;         // timeline file, only open on proc 0
+  int timeline_json;         // 1 = JSON lines, 0 = CSV
 };
 
 }
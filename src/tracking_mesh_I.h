@@ -259,11 +259,11 @@
   }
 
   template<int NUM_NODES>
-  int TrackingMesh<NUM_NODES>::popElemListFromBufferReverse(int n, int *list, double *buf, int operation, std::list<std::string> * properties, bool scale,bool translate, bool rotate)
+  int TrackingMesh<NUM_NODES>::popElemListFromBufferReverse(int n, int *list, int *wraplist, double *buf, int operation, std::list<std::string> * properties, double *dlo, double *dhi, bool scale,bool translate, bool rotate)
   {
     int nsend = 0;
-    nsend += MultiNodeMeshParallel<NUM_NODES>::popElemListFromBufferReverse(n,list,&buf[nsend],operation, properties, scale,translate,rotate);
-    nsend += customValues_.popElemListFromBufferReverse(n,list,&buf[nsend],operation, properties, scale,translate,rotate);
+    nsend += MultiNodeMeshParallel<NUM_NODES>::popElemListFromBufferReverse(n,list,wraplist,&buf[nsend],operation, properties, dlo, dhi, scale,translate,rotate);
+    nsend += customValues_.popElemListFromBufferReverse(n,list,wraplist,&buf[nsend],operation, properties, dlo, dhi, scale,translate,rotate);
     return nsend;
   }
 
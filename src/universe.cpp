@@ -54,6 +54,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "universe.h"
+#include "ensemble.h"
 #include "version.h"
 #include "version_liggghts.h" 
 #include "error.h"
@@ -92,6 +93,8 @@ Universe::Universe(LAMMPS *lmp, MPI_Comm communicator) : Pointers(lmp)
   for (int i = 0; i < nprocs; i++) uni2orig[i] = i;
 
   universe_id = 0; 
+
+  ensemble = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -104,6 +107,7 @@ Universe::~Universe()
   memory->destroy(uni2orig);
   delete []version; 
   if(universe_id) delete []universe_id; 
+  delete ensemble;
 }
 
 /* ----------------------------------------------------------------------
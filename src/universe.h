@@ -75,6 +75,8 @@ class Universe : protected Pointers {
 
   char *universe_id;       
 
+  class EnsembleTable *ensemble;  // parameter table of ensemble command
+
   Universe(class LAMMPS *, MPI_Comm);
   ~Universe();
   void reorder(char *, char *);
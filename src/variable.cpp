@@ -972,7 +972,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+            compute->begin_time_recording();
             compute->compute_scalar();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_SCALAR;
           }
 
@@ -997,7 +999,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+            compute->begin_time_recording();
             compute->compute_vector();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
 
@@ -1025,7 +1029,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
+            compute->begin_time_recording();
             compute->compute_array();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
 
@@ -1048,7 +1054,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+            compute->begin_time_recording();
             compute->compute_peratom();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1068,7 +1076,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+            compute->begin_time_recording();
             compute->compute_peratom();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1094,7 +1104,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+            compute->begin_time_recording();
             compute->compute_peratom();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1122,7 +1134,9 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current. Use the update_on_run_end option for computes to avoid this.");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
+            compute->begin_time_recording();
             compute->compute_peratom();
+            compute->end_time_recording();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -3202,7 +3216,9 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
             error->all(FLERR,
                        "Compute used in variable between runs is not current. Use the update_on_run_end option for computes to avoid this.");
         } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+          compute->begin_time_recording();
           compute->compute_vector();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         nvec = compute->size_vector;
@@ -3216,7 +3232,9 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
             error->all(FLERR,
                        "Compute used in variable between runs is not current. Use the update_on_run_end option for computes to avoid this.");
         } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
+          compute->begin_time_recording();
           compute->compute_array();
+          compute->end_time_recording();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         nvec = compute->size_array_rows;
@@ -172,6 +172,7 @@ void Verlet::setup()
   force_clear();
   
   modify->setup_pre_force(vflag);
+  comm->flush_comm_fix();
 
   if (pair_compute_flag) force->pair->compute(eflag,vflag);
   else if (force->pair) force->pair->compute_dummy(eflag,vflag);
@@ -192,6 +193,7 @@ void Verlet::setup()
   if (force->newton) comm->reverse_comm();
 
   modify->setup(vflag);
+  comm->flush_comm_fix();
   
   output->setup();
   
@@ -234,6 +236,7 @@ void Verlet::setup_minimal(int flag)
   ev_set(update->ntimestep);
   force_clear();
   modify->setup_pre_force(vflag);
+  comm->flush_comm_fix();
 
   if (pair_compute_flag) force->pair->compute(eflag,vflag);
   else if (force->pair) force->pair->compute_dummy(eflag,vflag);
@@ -254,6 +257,7 @@ void Verlet::setup_minimal(int flag)
   if (force->newton) comm->reverse_comm();
 
   modify->setup(vflag);
+  comm->flush_comm_fix();
   update->setupflag = 0;
 }
 
@@ -295,13 +299,22 @@ void Verlet::run(int n)
     if (n_post_integrate) modify->post_integrate();
 
     // regular communication vs neighbor list rebuild
+    // localized neighbor builds need current ghost coords in decide()
 
-    nflag = neighbor->decide();
-
-    if (nflag == 0) {
+    if (neighbor->localize) {
       timer->stamp();
       comm->forward_comm();
       timer->stamp(TIME_COMM);
+    }
+
+    nflag = neighbor->decide();
+
+    if (nflag == 0) {
+      if (!neighbor->localize) {
+        timer->stamp();
+        comm->forward_comm();
+        timer->stamp(TIME_COMM);
+      }
     } else {
       
       if (n_pre_exchange) modify->pre_exchange();
@@ -337,6 +350,10 @@ void Verlet::run(int n)
     force_clear();
     if (n_pre_force) modify->pre_force(vflag);
 
+    // sync point for Fix comm queued since the last one
+
+    comm->flush_comm_fix();
+
     timer->stamp();
 
     if (pair_compute_flag) {
@@ -369,6 +386,8 @@ void Verlet::run(int n)
     if (n_post_force) modify->post_force(vflag);
     
     if (n_pre_final_integrate) modify->pre_final_integrate();
+
+    comm->flush_comm_fix();
     
     modify->final_integrate();
     
@@ -381,6 +400,12 @@ void Verlet::run(int n)
       output->write(ntimestep);
       timer->stamp(TIME_OUTPUT);
     }
+
+    if (timer->timeline_every && ntimestep % timer->timeline_every == 0) {
+      timer->stamp();
+      timer->write_timeline();
+      timer->stamp(TIME_OUTPUT);
+    }
     
     if (SignalHandler::request_quit && !SignalHandler::request_write_restart)
         break;